@@ -20,10 +20,18 @@
 using namespace uml;
 
 
+
 //**************************************************************************
 //  CONSTANTS
 //**************************************************************************
 
+// use GCC's labels-as-values extension to jump directly between handlers
+#if defined(__GNUC__)
+#define USE_THREADED_DISPATCH   1
+#else
+#define USE_THREADED_DISPATCH   0
+#endif
+
 // define a bit to match each possible condition, starting at bit 12
 #define ZBIT            (0x1000 << (COND_Z & 15))
 #define NZBIT           (0x1000 << (COND_NZ & 15))
@@ -128,6 +136,19 @@ enum
 	OP_FFRI8,
 	OP_FFRFS,
 	OP_FFRFD,
+
+	// 32-bit forms whose last source is an immediate stored inline
+	OP_MOVi,
+	OP_ADDi,
+	OP_SUBi,
+	OP_ANDi,
+	OP_ORi,
+	OP_XORi,
+	OP_SHLi,
+	OP_SHRi,
+	OP_SARi,
+	OP_CMPi,
+	OP_TESTi
 };
 
 
@@ -154,6 +175,33 @@ enum
 #define MAKE_OPCODE_FULL(op, size, condition, flags, pwords) \
 	(MAKE_OPCODE_SHORT(op, size, (condition | flags)) | ((condition != COND_ALWAYS) ? (0x1000 << ((condition) & 15)) : 0) | ((pwords) << 28))
 
+// number of instruction words used to encode the opcode itself; in threaded
+// mode, the opcode is preceded by the address of its handler
+#if USE_THREADED_DISPATCH
+#define OPCODE_WORDS                2
+#else
+#define OPCODE_WORDS                1
+#endif
+
+// label each opcode's handler so that it can be reached directly
+#if USE_THREADED_DISPATCH
+#define OPCODE_LABEL(op, size, cond) op##_##size##_##cond
+#define OPCODE_CASE(op, size, cond) case MAKE_OPCODE_SHORT(op, size, cond): OPCODE_LABEL(op, size, cond)
+#else
+#define OPCODE_CASE(op, size, cond) case MAKE_OPCODE_SHORT(op, size, cond)
+#endif
+
+// finish a handler; when threading, each handler fetches and jumps to the next
+// one itself so that every handler ends in its own indirect branch
+#if USE_THREADED_DISPATCH
+#define OPCODE_DISPATCH()           do { opcode = inst[1].i; void *handler = inst[0].v; inst += OPCODE_WORDS; goto *handler; } while (0)
+#define OPCODE_NEXT                 do { inst += OPCODE_GET_PWORDS(opcode); OPCODE_DISPATCH(); } while (0)
+#define OPCODE_JUMP                 OPCODE_DISPATCH()
+#else
+#define OPCODE_NEXT                 break
+#define OPCODE_JUMP                 continue
+#endif
+
 // extract various parts of the opcode
 #define OPCODE_GET_SHORT(op)        ((op) & 0xfff)
 #define OPCODE_PASS_CONDITION(op,f) (((op) & s_condition_map[f]) != 0)
@@ -164,6 +212,10 @@ enum
 #define PARAM0                      (*inst[0].puint32)
 #define PARAM1                      (*inst[1].puint32)
 #define PARAM2                      (*inst[2].puint32)
+
+// inline immediate parameters
+#define IPARAM1                     (inst[1].i)
+#define IPARAM2                     (inst[2].i)
 #define PARAM3                      (*inst[3].puint32)
 
 #define DPARAM0                     (*inst[0].puint64)
@@ -203,6 +255,89 @@ enum
 #define FLAGS64_NZCV_ADD(r,a,b)     (FLAGS64_NZ(r) | FLAGS64_C_ADD(a,b) | FLAGS64_V_ADD(r,a,b))
 #define FLAGS64_NZCV_SUB(r,a,b)     (FLAGS64_NZ(r) | FLAGS64_C_SUB(a,b) | FLAGS64_V_SUB(r,a,b))
 
+// list of every opcode/size/condition combination handled by execute_code;
+// this must be kept in sync with the OPCODE_CASE labels there
+#define DRCBEC_OPCODE_LIST(X) \
+	X(OP_HANDLE, 4, 0) X(OP_HASH, 4, 0) X(OP_LABEL, 4, 0) X(OP_COMMENT, 4, 0) \
+	X(OP_MAPVAR, 4, 0) X(OP_DEBUG, 4, 0) X(OP_HASHJMP, 4, 0) X(OP_EXIT, 4, 1) \
+	X(OP_EXIT, 4, 0) X(OP_JMP, 4, 1) X(OP_JMP, 4, 0) X(OP_CALLH, 4, 1) \
+	X(OP_CALLH, 4, 0) X(OP_RET, 4, 1) X(OP_RET, 4, 0) X(OP_EXH, 4, 1) \
+	X(OP_EXH, 4, 0) X(OP_CALLC, 4, 1) X(OP_CALLC, 4, 0) X(OP_RECOVER, 4, 0) \
+	X(OP_SETFMOD, 4, 0) X(OP_GETFMOD, 4, 0) X(OP_GETEXP, 4, 0) X(OP_GETFLGS, 4, 0) \
+	X(OP_SAVE, 4, 0) X(OP_RESTORE, 4, 0) X(OP_RESTORE, 4, 1) X(OP_LOAD1, 4, 0) \
+	X(OP_LOAD1x2, 4, 0) X(OP_LOAD1x4, 4, 0) X(OP_LOAD1x8, 4, 0) X(OP_LOAD2x1, 4, 0) \
+	X(OP_LOAD2, 4, 0) X(OP_LOAD2x4, 4, 0) X(OP_LOAD2x8, 4, 0) X(OP_LOAD4x1, 4, 0) \
+	X(OP_LOAD4x2, 4, 0) X(OP_LOAD4, 4, 0) X(OP_LOAD4x8, 4, 0) X(OP_LOADS1, 4, 0) \
+	X(OP_LOADS1x2, 4, 0) X(OP_LOADS1x4, 4, 0) X(OP_LOADS1x8, 4, 0) X(OP_LOADS2x1, 4, 0) \
+	X(OP_LOADS2, 4, 0) X(OP_LOADS2x4, 4, 0) X(OP_LOADS2x8, 4, 0) X(OP_LOADS4x1, 4, 0) \
+	X(OP_LOADS4x2, 4, 0) X(OP_LOADS4, 4, 0) X(OP_LOADS4x8, 4, 0) X(OP_STORE1, 4, 0) \
+	X(OP_STORE1x2, 4, 0) X(OP_STORE1x4, 4, 0) X(OP_STORE1x8, 4, 0) X(OP_STORE2x1, 4, 0) \
+	X(OP_STORE2, 4, 0) X(OP_STORE2x4, 4, 0) X(OP_STORE2x8, 4, 0) X(OP_STORE4x1, 4, 0) \
+	X(OP_STORE4x2, 4, 0) X(OP_STORE4, 4, 0) X(OP_STORE4x8, 4, 0) X(OP_READ1, 4, 0) \
+	X(OP_READ2, 4, 0) X(OP_READ4, 4, 0) X(OP_READM2, 4, 0) X(OP_READM4, 4, 0) \
+	X(OP_WRITE1, 4, 0) X(OP_WRITE2, 4, 0) X(OP_WRITE4, 4, 0) X(OP_WRITEM2, 4, 0) \
+	X(OP_WRITEM4, 4, 0) X(OP_CARRY, 4, 1) X(OP_MOV, 4, 1) X(OP_MOV, 4, 0) \
+	X(OP_SET, 4, 1) X(OP_SEXT1, 4, 0) X(OP_SEXT1, 4, 1) X(OP_SEXT2, 4, 0) \
+	X(OP_SEXT2, 4, 1) X(OP_ROLAND, 4, 0) X(OP_ROLAND, 4, 1) X(OP_ROLINS, 4, 0) \
+	X(OP_ROLINS, 4, 1) X(OP_ADD, 4, 0) X(OP_ADD, 4, 1) X(OP_ADDC, 4, 0) \
+	X(OP_ADDC, 4, 1) X(OP_SUB, 4, 0) X(OP_SUB, 4, 1) X(OP_SUBB, 4, 0) \
+	X(OP_SUBB, 4, 1) X(OP_CMP, 4, 1) X(OP_MULU, 4, 0) X(OP_MULU, 4, 1) \
+	X(OP_MULS, 4, 0) X(OP_MULS, 4, 1) X(OP_DIVU, 4, 0) X(OP_DIVU, 4, 1) \
+	X(OP_DIVS, 4, 0) X(OP_DIVS, 4, 1) X(OP_AND, 4, 0) X(OP_AND, 4, 1) \
+	X(OP_TEST, 4, 1) X(OP_OR, 4, 0) X(OP_OR, 4, 1) X(OP_XOR, 4, 0) \
+	X(OP_XOR, 4, 1) X(OP_LZCNT, 4, 0) X(OP_LZCNT, 4, 1) X(OP_BSWAP, 4, 0) \
+	X(OP_BSWAP, 4, 1) X(OP_SHL, 4, 0) X(OP_SHL, 4, 1) X(OP_SHR, 4, 0) \
+	X(OP_SHR, 4, 1) X(OP_SAR, 4, 0) X(OP_SAR, 4, 1) X(OP_ROL, 4, 0) \
+	X(OP_ROL, 4, 1) X(OP_ROLC, 4, 0) X(OP_ROLC, 4, 1) X(OP_ROR, 4, 0) \
+	X(OP_ROR, 4, 1) X(OP_RORC, 4, 0) X(OP_RORC, 4, 1) X(OP_LOAD1, 8, 0) \
+	X(OP_LOAD1x2, 8, 0) X(OP_LOAD1x4, 8, 0) X(OP_LOAD1x8, 8, 0) X(OP_LOAD2x1, 8, 0) \
+	X(OP_LOAD2, 8, 0) X(OP_LOAD2x4, 8, 0) X(OP_LOAD2x8, 8, 0) X(OP_LOAD4x1, 8, 0) \
+	X(OP_LOAD4x2, 8, 0) X(OP_LOAD4, 8, 0) X(OP_LOAD4x8, 8, 0) X(OP_LOAD8x1, 8, 0) \
+	X(OP_LOAD8x2, 8, 0) X(OP_LOAD8x4, 8, 0) X(OP_LOAD8, 8, 0) X(OP_LOADS1, 8, 0) \
+	X(OP_LOADS1x2, 8, 0) X(OP_LOADS1x4, 8, 0) X(OP_LOADS1x8, 8, 0) X(OP_LOADS2x1, 8, 0) \
+	X(OP_LOADS2, 8, 0) X(OP_LOADS2x4, 8, 0) X(OP_LOADS2x8, 8, 0) X(OP_LOADS4x1, 8, 0) \
+	X(OP_LOADS4x2, 8, 0) X(OP_LOADS4, 8, 0) X(OP_LOADS4x8, 8, 0) X(OP_LOADS8x1, 8, 0) \
+	X(OP_LOADS8x2, 8, 0) X(OP_LOADS8x4, 8, 0) X(OP_LOADS8, 8, 0) X(OP_STORE1, 8, 0) \
+	X(OP_STORE1x2, 8, 0) X(OP_STORE1x4, 8, 0) X(OP_STORE1x8, 8, 0) X(OP_STORE2x1, 8, 0) \
+	X(OP_STORE2, 8, 0) X(OP_STORE2x4, 8, 0) X(OP_STORE2x8, 8, 0) X(OP_STORE4x1, 8, 0) \
+	X(OP_STORE4x2, 8, 0) X(OP_STORE4, 8, 0) X(OP_STORE4x8, 8, 0) X(OP_STORE8x1, 8, 0) \
+	X(OP_STORE8x2, 8, 0) X(OP_STORE8x4, 8, 0) X(OP_STORE8, 8, 0) X(OP_READ1, 8, 0) \
+	X(OP_READ2, 8, 0) X(OP_READ4, 8, 0) X(OP_READ8, 8, 0) X(OP_READM2, 8, 0) \
+	X(OP_READM4, 8, 0) X(OP_READM8, 8, 0) X(OP_WRITE1, 8, 0) X(OP_WRITE2, 8, 0) \
+	X(OP_WRITE4, 8, 0) X(OP_WRITE8, 8, 0) X(OP_WRITEM2, 8, 0) X(OP_WRITEM4, 8, 0) \
+	X(OP_WRITEM8, 8, 0) X(OP_CARRY, 8, 0) X(OP_MOV, 8, 1) X(OP_MOV, 8, 0) \
+	X(OP_SET, 8, 1) X(OP_SEXT1, 8, 0) X(OP_SEXT1, 8, 1) X(OP_SEXT2, 8, 0) \
+	X(OP_SEXT2, 8, 1) X(OP_SEXT4, 8, 0) X(OP_SEXT4, 8, 1) X(OP_ROLAND, 8, 0) \
+	X(OP_ROLAND, 8, 1) X(OP_ROLINS, 8, 0) X(OP_ROLINS, 8, 1) X(OP_ADD, 8, 0) \
+	X(OP_ADD, 8, 1) X(OP_ADDC, 8, 0) X(OP_ADDC, 8, 1) X(OP_SUB, 8, 0) \
+	X(OP_SUB, 8, 1) X(OP_SUBB, 8, 0) X(OP_SUBB, 8, 1) X(OP_CMP, 8, 1) \
+	X(OP_MULU, 8, 0) X(OP_MULU, 8, 1) X(OP_MULS, 8, 0) X(OP_MULS, 8, 1) \
+	X(OP_DIVU, 8, 0) X(OP_DIVU, 8, 1) X(OP_DIVS, 8, 0) X(OP_DIVS, 8, 1) \
+	X(OP_AND, 8, 0) X(OP_AND, 8, 1) X(OP_TEST, 8, 1) X(OP_OR, 8, 0) \
+	X(OP_OR, 8, 1) X(OP_XOR, 8, 0) X(OP_XOR, 8, 1) X(OP_LZCNT, 8, 0) \
+	X(OP_LZCNT, 8, 1) X(OP_BSWAP, 8, 0) X(OP_BSWAP, 8, 1) X(OP_SHL, 8, 0) \
+	X(OP_SHL, 8, 1) X(OP_SHR, 8, 0) X(OP_SHR, 8, 1) X(OP_SAR, 8, 0) \
+	X(OP_SAR, 8, 1) X(OP_ROL, 8, 0) X(OP_ROL, 8, 1) X(OP_ROLC, 8, 0) \
+	X(OP_ROLC, 8, 1) X(OP_ROR, 8, 0) X(OP_ROR, 8, 1) X(OP_RORC, 8, 0) \
+	X(OP_RORC, 8, 1) X(OP_FLOAD, 4, 0) X(OP_FSTORE, 4, 0) X(OP_FREAD, 4, 0) \
+	X(OP_FWRITE, 4, 0) X(OP_FMOV, 4, 1) X(OP_FMOV, 4, 0) X(OP_FTOI4T, 4, 0) \
+	X(OP_FTOI4R, 4, 0) X(OP_FTOI4F, 4, 0) X(OP_FTOI4C, 4, 0) X(OP_FTOI4, 4, 0) \
+	X(OP_FTOI8T, 4, 0) X(OP_FTOI8R, 4, 0) X(OP_FTOI8F, 4, 0) X(OP_FTOI8C, 4, 0) \
+	X(OP_FTOI8, 4, 0) X(OP_FFRI4, 4, 0) X(OP_FFRI8, 4, 0) X(OP_FFRFD, 4, 0) \
+	X(OP_FADD, 4, 0) X(OP_FSUB, 4, 0) X(OP_FCMP, 4, 1) X(OP_FMUL, 4, 0) \
+	X(OP_FDIV, 4, 0) X(OP_FNEG, 4, 0) X(OP_FABS, 4, 0) X(OP_FSQRT, 4, 0) \
+	X(OP_FRECIP, 4, 0) X(OP_FRSQRT, 4, 0) X(OP_FLOAD, 8, 0) X(OP_FSTORE, 8, 0) \
+	X(OP_FREAD, 8, 0) X(OP_FWRITE, 8, 0) X(OP_FMOV, 8, 1) X(OP_FMOV, 8, 0) \
+	X(OP_FTOI4T, 8, 0) X(OP_FTOI4R, 8, 0) X(OP_FTOI4F, 8, 0) X(OP_FTOI4C, 8, 0) \
+	X(OP_FTOI4, 8, 0) X(OP_FTOI8T, 8, 0) X(OP_FTOI8R, 8, 0) X(OP_FTOI8F, 8, 0) \
+	X(OP_FTOI8C, 8, 0) X(OP_FTOI8, 8, 0) X(OP_FFRI4, 8, 0) X(OP_FFRI8, 8, 0) \
+	X(OP_FFRFS, 8, 0) X(OP_FRNDS, 8, 0) X(OP_FADD, 8, 0) X(OP_FSUB, 8, 0) \
+	X(OP_FCMP, 8, 1) X(OP_FMUL, 8, 0) X(OP_FDIV, 8, 0) X(OP_FNEG, 8, 0) \
+	X(OP_FABS, 8, 0) X(OP_FSQRT, 8, 0) X(OP_FRECIP, 8, 0) X(OP_FRSQRT, 8, 0) \
+	X(OP_MOVi, 4, 0) X(OP_ADDi, 4, 0) X(OP_SUBi, 4, 0) X(OP_ANDi, 4, 0) X(OP_ORi, 4, 0) \
+	X(OP_XORi, 4, 0) X(OP_SHLi, 4, 0) X(OP_SHRi, 4, 0) X(OP_SARi, 4, 0) X(OP_CMPi, 4, 1) \
+	X(OP_TESTi, 4, 1)
+
 
 
 //**************************************************************************
@@ -240,6 +375,8 @@ union drcbec_instruction
 
 UINT64 drcbe_c::s_immediate_zero = 0;
 
+void *drcbe_c::s_handler_table[0x1000];
+
 const UINT32 drcbe_c::s_condition_map[] =
 {
 	/* ..... */     NCBIT | NVBIT | NZBIT | NSBIT | NUBIT | ABIT  | GBIT  | GEBIT,
@@ -293,6 +430,9 @@ drcbe_c::drcbe_c(drcuml_state &drcuml, device_t &device, drc_cache &cache, UINT3
 		m_labels(cache),
 		m_fixup_delegate(FUNC(drcbe_c::fixup_label), this)
 {
+	// make sure the handler table is populated before we generate any code
+	if (USE_THREADED_DISPATCH && s_handler_table[0] == NULL)
+		execute_code(NULL);
 }
 
 
@@ -329,7 +469,7 @@ void drcbe_c::generate(drcuml_block &block, const instruction *instlist, UINT32
 	m_map.block_begin(block);
 
 	// begin codegen; fail if we can't
-	drccodeptr *cachetop = m_cache.begin_codegen(numinst * sizeof(drcbec_instruction) * 4);
+	drccodeptr *cachetop = m_cache.begin_codegen(numinst * sizeof(drcbec_instruction) * (3 + OPCODE_WORDS));
 	if (cachetop == NULL)
 		block.abort();
 
@@ -374,7 +514,7 @@ void drcbe_c::generate(drcuml_block &block, const instruction *instlist, UINT32
 
 			// JMP instructions need to resolve their labels
 			case OP_JMP:
-				(dst++)->i = MAKE_OPCODE_FULL(opcode, inst.size(), inst.condition(), inst.flags(), 1);
+				output_opcode(&dst, MAKE_OPCODE_FULL(opcode, inst.size(), inst.condition(), inst.flags(), 1));
 				dst->inst = (drcbec_instruction *)m_labels.get_codeptr(inst.param(0).label(), m_fixup_delegate, dst);
 				dst++;
 				break;
@@ -424,10 +564,43 @@ void drcbe_c::generate(drcuml_block &block, const instruction *instlist, UINT32
 				if (opcode == OP_FFRFLT)
 					opcode = (opcode_t)(OP_FFRFS + (inst.param(2).size() - 2));
 
+				// specialise common 32-bit forms whose last source is an immediate; the
+				// value is stored directly in its parameter slot instead of behind a pointer
+				int inlineparam = -1;
+				if (inst.size() == 4 && inst.condition() == COND_ALWAYS && inst.numparams() > 0 && inst.param(inst.numparams() - 1).is_immediate())
+				{
+					opcode_t immop = opcode;
+					if (inst.flags() == 0)
+						switch (opcode)
+						{
+							case OP_MOV:    immop = (opcode_t)OP_MOVi;    break;
+							case OP_ADD:    immop = (opcode_t)OP_ADDi;    break;
+							case OP_SUB:    immop = (opcode_t)OP_SUBi;    break;
+							case OP_AND:    immop = (opcode_t)OP_ANDi;    break;
+							case OP_OR:     immop = (opcode_t)OP_ORi;     break;
+							case OP_XOR:    immop = (opcode_t)OP_XORi;    break;
+							case OP_SHL:    immop = (opcode_t)OP_SHLi;    break;
+							case OP_SHR:    immop = (opcode_t)OP_SHRi;    break;
+							case OP_SAR:    immop = (opcode_t)OP_SARi;    break;
+							default:                            break;
+						}
+					else if (opcode == OP_CMP)
+						immop = (opcode_t)OP_CMPi;
+					else if (opcode == OP_TEST)
+						immop = (opcode_t)OP_TESTi;
+					if (immop != opcode)
+					{
+						opcode = immop;
+						inlineparam = inst.numparams() - 1;
+					}
+				}
+
 				// count how many bytes of immediates we need
 				int immedbytes = 0;
 				for (int pnum = 0; pnum < inst.numparams(); pnum++)
-					if (inst.param(pnum).is_mapvar() ||
+					if (pnum == inlineparam)
+						continue;
+					else if (inst.param(pnum).is_mapvar() ||
 						(inst.param(pnum).is_immediate() && inst.param(pnum).immediate() != 0) ||
 						(inst.param(pnum).is_size_space() && inst.param(pnum).space() != 0))
 						immedbytes += psize[pnum];
@@ -436,14 +609,17 @@ void drcbe_c::generate(drcuml_block &block, const instruction *instlist, UINT32
 				int immedwords = (immedbytes + sizeof(drcbec_instruction) - 1) / sizeof(drcbec_instruction);
 
 				// first item is the opcode, size, condition flags and length
-				(dst++)->i = MAKE_OPCODE_FULL(opcode, inst.size(), inst.condition(), inst.flags(), inst.numparams() + immedwords);
+				output_opcode(&dst, MAKE_OPCODE_FULL(opcode, inst.size(), inst.condition(), inst.flags(), inst.numparams() + immedwords));
 
 				// immediates start after parameters
 				void *immed = dst + inst.numparams();
 
 				// output each of the parameters
 				for (int pnum = 0; pnum < inst.numparams(); pnum++)
-					output_parameter(&dst, &immed, psize[pnum], inst.param(pnum));
+					if (pnum == inlineparam)
+						(dst++)->i = (UINT32)inst.param(pnum).immediate();
+					else
+						output_parameter(&dst, &immed, psize[pnum], inst.param(pnum));
 
 				// point past the end of the immediates
 				dst += immedwords;
@@ -492,8 +668,30 @@ void drcbe_c::get_info(drcbe_info &info)
 
 int drcbe_c::execute(code_handle &entry)
 {
-	// get the entry point
-	const drcbec_instruction *inst = (const drcbec_instruction *)entry.codeptr();
+	return execute_code((const drcbec_instruction *)entry.codeptr());
+}
+
+
+//-------------------------------------------------
+//  execute_code - execute generated code starting
+//  at the given instruction; a NULL instruction
+//  populates the threaded handler table instead
+//-------------------------------------------------
+
+int drcbe_c::execute_code(const drcbec_instruction *inst)
+{
+#if USE_THREADED_DISPATCH
+	// record the address of each handler; anything not listed is unexpected
+	if (inst == NULL)
+	{
+		for (int opnum = 0; opnum < ARRAY_LENGTH(s_handler_table); opnum++)
+			s_handler_table[opnum] = &&unexpected_opcode;
+#define SET_HANDLER(op, size, cond) s_handler_table[MAKE_OPCODE_SHORT(op, size, cond)] = &&OPCODE_LABEL(op, size, cond);
+		DRCBEC_OPCODE_LIST(SET_HANDLER)
+#undef SET_HANDLER
+		return 0;
+	}
+#endif
 	assert_in_cache(m_cache, inst);
 
 	// loop while we have cycles
@@ -504,28 +702,35 @@ int drcbe_c::execute(code_handle &entry)
 	int shift;
 	UINT8 flags = 0;
 	UINT8 sp = 0;
+	UINT32 opcode;
+#if USE_THREADED_DISPATCH
+	// enter the first handler; from then on each handler dispatches its successor
+	OPCODE_DISPATCH();
+#endif
 	while (true)
 	{
-		UINT32 opcode = (inst++)->i;
+#if !USE_THREADED_DISPATCH
+		opcode = (inst++)->i;
+#endif
 
 		switch (OPCODE_GET_SHORT(opcode))
 		{
 			// ----------------------- Control Flow Operations -----------------------
 
-			case MAKE_OPCODE_SHORT(OP_HANDLE, 4, 0):    // HANDLE  handle
-			case MAKE_OPCODE_SHORT(OP_HASH, 4, 0):      // HASH    mode,pc
-			case MAKE_OPCODE_SHORT(OP_LABEL, 4, 0):     // LABEL   imm
-			case MAKE_OPCODE_SHORT(OP_COMMENT, 4, 0):   // COMMENT string
-			case MAKE_OPCODE_SHORT(OP_MAPVAR, 4, 0):    // MAPVAR  mapvar,value
+			OPCODE_CASE(OP_HANDLE, 4, 0):     // HANDLE  handle
+			OPCODE_CASE(OP_HASH, 4, 0):       // HASH    mode,pc
+			OPCODE_CASE(OP_LABEL, 4, 0):      // LABEL   imm
+			OPCODE_CASE(OP_COMMENT, 4, 0):    // COMMENT string
+			OPCODE_CASE(OP_MAPVAR, 4, 0):     // MAPVAR  mapvar,value
 
 				// these opcodes should be processed at compile-time only
 				fatalerror("Unexpected opcode\n");
 
-			case MAKE_OPCODE_SHORT(OP_DEBUG, 4, 0):     // DEBUG   pc
+			OPCODE_CASE(OP_DEBUG, 4, 0):      // DEBUG   pc
 				debugger_instruction_hook(&m_device, PARAM0);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_HASHJMP, 4, 0):   // HASHJMP mode,pc,handle
+			OPCODE_CASE(OP_HASHJMP, 4, 0):    // HASHJMP mode,pc,handle
 				sp = 0;
 				newinst = (const drcbec_instruction *)m_hash.get_codeptr(PARAM0, PARAM1);
 				if (newinst == NULL)
@@ -537,373 +742,373 @@ int drcbe_c::execute(code_handle &entry)
 				}
 				assert_in_cache(m_cache, newinst);
 				inst = newinst;
-				continue;
+				OPCODE_JUMP;
 
-			case MAKE_OPCODE_SHORT(OP_EXIT, 4, 1):      // EXIT    src1[,c]
+			OPCODE_CASE(OP_EXIT, 4, 1):       // EXIT    src1[,c]
 				if (OPCODE_FAIL_CONDITION(opcode, flags))
-					break;
+					OPCODE_NEXT;
 				// fall through...
 
-			case MAKE_OPCODE_SHORT(OP_EXIT, 4, 0):
+			OPCODE_CASE(OP_EXIT, 4, 0):
 				return PARAM0;
 
-			case MAKE_OPCODE_SHORT(OP_JMP, 4, 1):       // JMP     imm[,c]
+			OPCODE_CASE(OP_JMP, 4, 1):        // JMP     imm[,c]
 				if (OPCODE_FAIL_CONDITION(opcode, flags))
-					break;
+					OPCODE_NEXT;
 				// fall through...
 
-			case MAKE_OPCODE_SHORT(OP_JMP, 4, 0):
+			OPCODE_CASE(OP_JMP, 4, 0):
 				newinst = inst[0].inst;
 				assert_in_cache(m_cache, newinst);
 				inst = newinst;
-				continue;
+				OPCODE_JUMP;
 
-			case MAKE_OPCODE_SHORT(OP_CALLH, 4, 1):     // CALLH   handle[,c]
+			OPCODE_CASE(OP_CALLH, 4, 1):      // CALLH   handle[,c]
 				if (OPCODE_FAIL_CONDITION(opcode, flags))
-					break;
+					OPCODE_NEXT;
 				// fall through...
 
-			case MAKE_OPCODE_SHORT(OP_CALLH, 4, 0):
+			OPCODE_CASE(OP_CALLH, 4, 0):
 				assert(sp < ARRAY_LENGTH(callstack));
 				newinst = (const drcbec_instruction *)inst[0].handle->codeptr();
 				assert_in_cache(m_cache, newinst);
 				callstack[sp++] = inst + OPCODE_GET_PWORDS(opcode);
 				inst = newinst;
-				continue;
+				OPCODE_JUMP;
 
-			case MAKE_OPCODE_SHORT(OP_RET, 4, 1):       // RET     [c]
+			OPCODE_CASE(OP_RET, 4, 1):        // RET     [c]
 				if (OPCODE_FAIL_CONDITION(opcode, flags))
-					break;
+					OPCODE_NEXT;
 				// fall through...
 
-			case MAKE_OPCODE_SHORT(OP_RET, 4, 0):
+			OPCODE_CASE(OP_RET, 4, 0):
 				assert(sp > 0);
 				newinst = callstack[--sp];
 				assert_in_cache(m_cache, newinst);
 				inst = newinst;
-				continue;
+				OPCODE_JUMP;
 
-			case MAKE_OPCODE_SHORT(OP_EXH, 4, 1):       // EXH     handle,param[,c]
+			OPCODE_CASE(OP_EXH, 4, 1):        // EXH     handle,param[,c]
 				if (OPCODE_FAIL_CONDITION(opcode, flags))
-					break;
+					OPCODE_NEXT;
 				// fall through...
 
-			case MAKE_OPCODE_SHORT(OP_EXH, 4, 0):
+			OPCODE_CASE(OP_EXH, 4, 0):
 				assert(sp < ARRAY_LENGTH(callstack));
 				newinst = (const drcbec_instruction *)inst[0].handle->codeptr();
 				assert_in_cache(m_cache, newinst);
 				m_state.exp = PARAM1;
 				callstack[sp++] = inst;
 				inst = newinst;
-				continue;
+				OPCODE_JUMP;
 
-			case MAKE_OPCODE_SHORT(OP_CALLC, 4, 1):     // CALLC   func,ptr[,c]
+			OPCODE_CASE(OP_CALLC, 4, 1):      // CALLC   func,ptr[,c]
 				if (OPCODE_FAIL_CONDITION(opcode, flags))
-					break;
+					OPCODE_NEXT;
 				// fall through...
 
-			case MAKE_OPCODE_SHORT(OP_CALLC, 4, 0):
+			OPCODE_CASE(OP_CALLC, 4, 0):
 				(*inst[0].cfunc)(inst[1].v);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_RECOVER, 4, 0):   // RECOVER dst,mapvar
+			OPCODE_CASE(OP_RECOVER, 4, 0):    // RECOVER dst,mapvar
 				assert(sp > 0);
 				PARAM0 = m_map.get_value((drccodeptr)callstack[0], MAPVAR_M0 + PARAM1);
-				break;
+				OPCODE_NEXT;
 
 
 			// ----------------------- Internal Register Operations -----------------------
 
-			case MAKE_OPCODE_SHORT(OP_SETFMOD, 4, 0):   // SETFMOD src
+			OPCODE_CASE(OP_SETFMOD, 4, 0):    // SETFMOD src
 				m_state.fmod = PARAM0;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_GETFMOD, 4, 0):   // GETFMOD dst
+			OPCODE_CASE(OP_GETFMOD, 4, 0):    // GETFMOD dst
 				PARAM0 = m_state.fmod;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_GETEXP, 4, 0):    // GETEXP  dst
+			OPCODE_CASE(OP_GETEXP, 4, 0):     // GETEXP  dst
 				PARAM0 = m_state.exp;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_GETFLGS, 4, 0):   // GETFLGS dst[,f]
+			OPCODE_CASE(OP_GETFLGS, 4, 0):    // GETFLGS dst[,f]
 				PARAM0 = flags & PARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SAVE, 4, 0):      // SAVE    dst
+			OPCODE_CASE(OP_SAVE, 4, 0):       // SAVE    dst
 				*inst[0].state = m_state;
 				inst[0].state->flags = flags;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_RESTORE, 4, 0):   // RESTORE dst
-			case MAKE_OPCODE_SHORT(OP_RESTORE, 4, 1):   // RESTORE dst
+			OPCODE_CASE(OP_RESTORE, 4, 0):    // RESTORE dst
+			OPCODE_CASE(OP_RESTORE, 4, 1):    // RESTORE dst
 				m_state = *inst[0].state;
 				flags = inst[0].state->flags;
-				break;
+				OPCODE_NEXT;
 
 
 			// ----------------------- 32-Bit Integer Operations -----------------------
 
-			case MAKE_OPCODE_SHORT(OP_LOAD1, 4, 0):     // LOAD    dst,base,index,BYTE
+			OPCODE_CASE(OP_LOAD1, 4, 0):      // LOAD    dst,base,index,BYTE
 				PARAM0 = inst[1].puint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD1x2, 4, 0):   // LOAD    dst,base,index,BYTE_x2
+			OPCODE_CASE(OP_LOAD1x2, 4, 0):    // LOAD    dst,base,index,BYTE_x2
 				PARAM0 = *(UINT8 *)&inst[1].puint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD1x4, 4, 0):   // LOAD    dst,base,index,BYTE_x4
+			OPCODE_CASE(OP_LOAD1x4, 4, 0):    // LOAD    dst,base,index,BYTE_x4
 				PARAM0 = *(UINT8 *)&inst[1].puint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD1x8, 4, 0):   // LOAD    dst,base,index,BYTE_x8
+			OPCODE_CASE(OP_LOAD1x8, 4, 0):    // LOAD    dst,base,index,BYTE_x8
 				PARAM0 = *(UINT8 *)&inst[1].puint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD2x1, 4, 0):   // LOAD    dst,base,index,WORD_x1
+			OPCODE_CASE(OP_LOAD2x1, 4, 0):    // LOAD    dst,base,index,WORD_x1
 				PARAM0 = *(UINT16 *)&inst[1].puint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD2, 4, 0):     // LOAD    dst,base,index,WORD
+			OPCODE_CASE(OP_LOAD2, 4, 0):      // LOAD    dst,base,index,WORD
 				PARAM0 = inst[1].puint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD2x4, 4, 0):   // LOAD    dst,base,index,WORD_x4
+			OPCODE_CASE(OP_LOAD2x4, 4, 0):    // LOAD    dst,base,index,WORD_x4
 				PARAM0 = *(UINT16 *)&inst[1].puint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD2x8, 4, 0):   // LOAD    dst,base,index,WORD_x8
+			OPCODE_CASE(OP_LOAD2x8, 4, 0):    // LOAD    dst,base,index,WORD_x8
 				PARAM0 = *(UINT16 *)&inst[1].puint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD4x1, 4, 0):   // LOAD    dst,base,index,DWORD_x1
+			OPCODE_CASE(OP_LOAD4x1, 4, 0):    // LOAD    dst,base,index,DWORD_x1
 				PARAM0 = *(UINT32 *)&inst[1].puint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD4x2, 4, 0):   // LOAD    dst,base,index,DWORD_x2
+			OPCODE_CASE(OP_LOAD4x2, 4, 0):    // LOAD    dst,base,index,DWORD_x2
 				PARAM0 = *(UINT32 *)&inst[1].puint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD4, 4, 0):     // LOAD    dst,base,index,DWORD
+			OPCODE_CASE(OP_LOAD4, 4, 0):      // LOAD    dst,base,index,DWORD
 				PARAM0 = inst[1].puint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD4x8, 4, 0):   // LOAD    dst,base,index,DWORD_x8
+			OPCODE_CASE(OP_LOAD4x8, 4, 0):    // LOAD    dst,base,index,DWORD_x8
 				PARAM0 = *(UINT32 *)&inst[1].puint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS1, 4, 0):    // LOADS   dst,base,index,BYTE
+			OPCODE_CASE(OP_LOADS1, 4, 0):     // LOADS   dst,base,index,BYTE
 				PARAM0 = inst[1].pint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS1x2, 4, 0):  // LOADS   dst,base,index,BYTE_x2
+			OPCODE_CASE(OP_LOADS1x2, 4, 0):   // LOADS   dst,base,index,BYTE_x2
 				PARAM0 = *(INT8 *)&inst[1].pint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS1x4, 4, 0):  // LOADS   dst,base,index,BYTE_x4
+			OPCODE_CASE(OP_LOADS1x4, 4, 0):   // LOADS   dst,base,index,BYTE_x4
 				PARAM0 = *(INT8 *)&inst[1].pint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS1x8, 4, 0):  // LOADS   dst,base,index,BYTE_x8
+			OPCODE_CASE(OP_LOADS1x8, 4, 0):   // LOADS   dst,base,index,BYTE_x8
 				PARAM0 = *(INT8 *)&inst[1].pint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS2x1, 4, 0):  // LOADS   dst,base,index,WORD_x1
+			OPCODE_CASE(OP_LOADS2x1, 4, 0):   // LOADS   dst,base,index,WORD_x1
 				PARAM0 = *(INT16 *)&inst[1].pint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS2, 4, 0):    // LOADS   dst,base,index,WORD
+			OPCODE_CASE(OP_LOADS2, 4, 0):     // LOADS   dst,base,index,WORD
 				PARAM0 = inst[1].pint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS2x4, 4, 0):  // LOADS   dst,base,index,WORD_x4
+			OPCODE_CASE(OP_LOADS2x4, 4, 0):   // LOADS   dst,base,index,WORD_x4
 				PARAM0 = *(INT16 *)&inst[1].pint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS2x8, 4, 0):  // LOADS   dst,base,index,WORD_x8
+			OPCODE_CASE(OP_LOADS2x8, 4, 0):   // LOADS   dst,base,index,WORD_x8
 				PARAM0 = *(INT16 *)&inst[1].pint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS4x1, 4, 0):  // LOADS   dst,base,index,DWORD_x1
+			OPCODE_CASE(OP_LOADS4x1, 4, 0):   // LOADS   dst,base,index,DWORD_x1
 				PARAM0 = *(INT32 *)&inst[1].pint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS4x2, 4, 0):  // LOADS   dst,base,index,DWORD_x2
+			OPCODE_CASE(OP_LOADS4x2, 4, 0):   // LOADS   dst,base,index,DWORD_x2
 				PARAM0 = *(INT32 *)&inst[1].pint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS4, 4, 0):    // LOADS   dst,base,index,DWORD
+			OPCODE_CASE(OP_LOADS4, 4, 0):     // LOADS   dst,base,index,DWORD
 				PARAM0 = inst[1].pint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS4x8, 4, 0):  // LOADS   dst,base,index,DWORD_x8
+			OPCODE_CASE(OP_LOADS4x8, 4, 0):   // LOADS   dst,base,index,DWORD_x8
 				PARAM0 = *(INT32 *)&inst[1].pint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE1, 4, 0):    // STORE   dst,base,index,BYTE
+			OPCODE_CASE(OP_STORE1, 4, 0):     // STORE   dst,base,index,BYTE
 				inst[0].puint8[PARAM1] = PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE1x2, 4, 0):  // STORE   dst,base,index,BYTE_x2
+			OPCODE_CASE(OP_STORE1x2, 4, 0):   // STORE   dst,base,index,BYTE_x2
 				*(UINT8 *)&inst[0].puint16[PARAM1] = PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE1x4, 4, 0):  // STORE   dst,base,index,BYTE_x4
+			OPCODE_CASE(OP_STORE1x4, 4, 0):   // STORE   dst,base,index,BYTE_x4
 				*(UINT8 *)&inst[0].puint32[PARAM1] = PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE1x8, 4, 0):  // STORE   dst,base,index,BYTE_x8
+			OPCODE_CASE(OP_STORE1x8, 4, 0):   // STORE   dst,base,index,BYTE_x8
 				*(UINT8 *)&inst[0].puint64[PARAM1] = PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE2x1, 4, 0):  // STORE   dst,base,index,WORD_x1
+			OPCODE_CASE(OP_STORE2x1, 4, 0):   // STORE   dst,base,index,WORD_x1
 				*(UINT16 *)&inst[0].puint8[PARAM1] = PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE2, 4, 0):    // STORE   dst,base,index,WORD
+			OPCODE_CASE(OP_STORE2, 4, 0):     // STORE   dst,base,index,WORD
 				inst[0].puint16[PARAM1] = PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE2x4, 4, 0):  // STORE   dst,base,index,WORD_x4
+			OPCODE_CASE(OP_STORE2x4, 4, 0):   // STORE   dst,base,index,WORD_x4
 				*(UINT16 *)&inst[0].puint32[PARAM1] = PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE2x8, 4, 0):  // STORE   dst,base,index,WORD_x8
+			OPCODE_CASE(OP_STORE2x8, 4, 0):   // STORE   dst,base,index,WORD_x8
 				*(UINT16 *)&inst[0].puint64[PARAM1] = PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE4x1, 4, 0):  // STORE   dst,base,index,DWORD_x1
+			OPCODE_CASE(OP_STORE4x1, 4, 0):   // STORE   dst,base,index,DWORD_x1
 				*(UINT32 *)&inst[0].puint8[PARAM1] = PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE4x2, 4, 0):  // STORE   dst,base,index,DWORD_x2
+			OPCODE_CASE(OP_STORE4x2, 4, 0):   // STORE   dst,base,index,DWORD_x2
 				*(UINT32 *)&inst[0].puint16[PARAM1] = PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE4, 4, 0):    // STORE   dst,base,index,DWORD
+			OPCODE_CASE(OP_STORE4, 4, 0):     // STORE   dst,base,index,DWORD
 				inst[0].puint32[PARAM1] = PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE4x8, 4, 0):  // STORE   dst,base,index,DWORD_x8
+			OPCODE_CASE(OP_STORE4x8, 4, 0):   // STORE   dst,base,index,DWORD_x8
 				*(UINT32 *)&inst[0].puint64[PARAM1] = PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_READ1, 4, 0):     // READ    dst,src1,space_BYTE
+			OPCODE_CASE(OP_READ1, 4, 0):      // READ    dst,src1,space_BYTE
 				PARAM0 = m_space[PARAM2]->read_byte(PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_READ2, 4, 0):     // READ    dst,src1,space_WORD
+			OPCODE_CASE(OP_READ2, 4, 0):      // READ    dst,src1,space_WORD
 				PARAM0 = m_space[PARAM2]->read_word(PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_READ4, 4, 0):     // READ    dst,src1,space_DWORD
+			OPCODE_CASE(OP_READ4, 4, 0):      // READ    dst,src1,space_DWORD
 				PARAM0 = m_space[PARAM2]->read_dword(PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_READM2, 4, 0):    // READM   dst,src1,mask,space_WORD
+			OPCODE_CASE(OP_READM2, 4, 0):     // READM   dst,src1,mask,space_WORD
 				PARAM0 = m_space[PARAM3]->read_word(PARAM1, PARAM2);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_READM4, 4, 0):    // READM   dst,src1,mask,space_DWORD
+			OPCODE_CASE(OP_READM4, 4, 0):     // READM   dst,src1,mask,space_DWORD
 				PARAM0 = m_space[PARAM3]->read_dword(PARAM1, PARAM2);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_WRITE1, 4, 0):    // WRITE   dst,src1,space_BYTE
+			OPCODE_CASE(OP_WRITE1, 4, 0):     // WRITE   dst,src1,space_BYTE
 				m_space[PARAM2]->write_byte(PARAM0, PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_WRITE2, 4, 0):    // WRITE   dst,src1,space_WORD
+			OPCODE_CASE(OP_WRITE2, 4, 0):     // WRITE   dst,src1,space_WORD
 				m_space[PARAM2]->write_word(PARAM0, PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_WRITE4, 4, 0):    // WRITE   dst,src1,space_DWORD
+			OPCODE_CASE(OP_WRITE4, 4, 0):     // WRITE   dst,src1,space_DWORD
 				m_space[PARAM2]->write_dword(PARAM0, PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_WRITEM2, 4, 0):   // WRITEM  dst,src1,mask,space_WORD
+			OPCODE_CASE(OP_WRITEM2, 4, 0):    // WRITEM  dst,src1,mask,space_WORD
 				m_space[PARAM3]->write_word(PARAM0, PARAM1, PARAM2);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_WRITEM4, 4, 0):   // WRITEM  dst,src1,mask,space_DWORD
+			OPCODE_CASE(OP_WRITEM4, 4, 0):    // WRITEM  dst,src1,mask,space_DWORD
 				m_space[PARAM3]->write_dword(PARAM0, PARAM1, PARAM2);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_CARRY, 4, 1):     // CARRY   src,bitnum
+			OPCODE_CASE(OP_CARRY, 4, 1):      // CARRY   src,bitnum
 				flags = (flags & ~FLAG_C) | ((PARAM0 >> (PARAM1 & 31)) & FLAG_C);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_MOV, 4, 1):       // MOV     dst,src[,c]
+			OPCODE_CASE(OP_MOV, 4, 1):        // MOV     dst,src[,c]
 				if (OPCODE_FAIL_CONDITION(opcode, flags))
-					break;
+					OPCODE_NEXT;
 				// fall through...
 
-			case MAKE_OPCODE_SHORT(OP_MOV, 4, 0):
+			OPCODE_CASE(OP_MOV, 4, 0):
 				PARAM0 = PARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SET, 4, 1):       // SET     dst,c
+			OPCODE_CASE(OP_SET, 4, 1):        // SET     dst,c
 				PARAM0 = OPCODE_FAIL_CONDITION(opcode, flags) ? 0 : 1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SEXT1, 4, 0):     // SEXT1   dst,src
+			OPCODE_CASE(OP_SEXT1, 4, 0):      // SEXT1   dst,src
 				PARAM0 = (INT8)PARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SEXT1, 4, 1):
+			OPCODE_CASE(OP_SEXT1, 4, 1):
 				temp32 = (INT8)PARAM1;
 				flags = FLAGS32_NZ(temp32);
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SEXT2, 4, 0):     // SEXT2   dst,src
+			OPCODE_CASE(OP_SEXT2, 4, 0):      // SEXT2   dst,src
 				PARAM0 = (INT16)PARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SEXT2, 4, 1):
+			OPCODE_CASE(OP_SEXT2, 4, 1):
 				temp32 = (INT16)PARAM1;
 				flags = FLAGS32_NZ(temp32);
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROLAND, 4, 0):    // ROLAND  dst,src,count,mask[,f]
+			OPCODE_CASE(OP_ROLAND, 4, 0):     // ROLAND  dst,src,count,mask[,f]
 				shift = PARAM2 & 31;
 				PARAM0 = ((PARAM1 << shift) | (PARAM1 >> (32 - shift))) & PARAM3;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROLAND, 4, 1):
+			OPCODE_CASE(OP_ROLAND, 4, 1):
 				shift = PARAM2 & 31;
 				temp32 = ((PARAM1 << shift) | (PARAM1 >> (32 - shift))) & PARAM3;
 				flags = FLAGS32_NZ(temp32);
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROLINS, 4, 0):    // ROLINS  dst,src,count,mask[,f]
+			OPCODE_CASE(OP_ROLINS, 4, 0):     // ROLINS  dst,src,count,mask[,f]
 				shift = PARAM2 & 31;
 				PARAM0 = (PARAM0 & ~PARAM3) | (((PARAM1 << shift) | (PARAM1 >> (32 - shift))) & PARAM3);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROLINS, 4, 1):
+			OPCODE_CASE(OP_ROLINS, 4, 1):
 				shift = PARAM2 & 31;
 				temp32 = (PARAM0 & ~PARAM3) | (((PARAM1 << shift) | (PARAM1 >> (32 - shift))) & PARAM3);
 				flags = FLAGS32_NZ(temp32);
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ADD, 4, 0):       // ADD     dst,src1,src2[,f]
+			OPCODE_CASE(OP_ADD, 4, 0):        // ADD     dst,src1,src2[,f]
 				PARAM0 = PARAM1 + PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ADD, 4, 1):
+			OPCODE_CASE(OP_ADD, 4, 1):
 				temp32 = PARAM1 + PARAM2;
 				flags = FLAGS32_NZCV_ADD(temp32, PARAM1, PARAM2);
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ADDC, 4, 0):      // ADDC    dst,src1,src2[,f]
+			OPCODE_CASE(OP_ADDC, 4, 0):       // ADDC    dst,src1,src2[,f]
 				PARAM0 = PARAM1 + PARAM2 + (flags & FLAG_C);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ADDC, 4, 1):
+			OPCODE_CASE(OP_ADDC, 4, 1):
 				temp32 = PARAM1 + PARAM2 + (flags & FLAG_C);
 				if (PARAM2 + 1 != 0)
 					flags = FLAGS32_NZCV_ADD(temp32, PARAM1, PARAM2 + (flags & FLAG_C));
@@ -918,23 +1123,23 @@ int drcbe_c::execute(code_handle &entry)
 						flags = FLAGS32_NZCV_ADD(temp32, PARAM1 + (flags & FLAG_C), PARAM2);
 				}
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SUB, 4, 0):       // SUB     dst,src1,src2[,f]
+			OPCODE_CASE(OP_SUB, 4, 0):        // SUB     dst,src1,src2[,f]
 				PARAM0 = PARAM1 - PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SUB, 4, 1):
+			OPCODE_CASE(OP_SUB, 4, 1):
 				temp32 = PARAM1 - PARAM2;
 				flags = FLAGS32_NZCV_SUB(temp32, PARAM1, PARAM2);
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SUBB, 4, 0):      // SUBB    dst,src1,src2[,f]
+			OPCODE_CASE(OP_SUBB, 4, 0):       // SUBB    dst,src1,src2[,f]
 				PARAM0 = PARAM1 - PARAM2 - (flags & FLAG_C);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SUBB, 4, 1):
+			OPCODE_CASE(OP_SUBB, 4, 1):
 				temp32 = PARAM1 - PARAM2 - (flags & FLAG_C);
 				temp64 = (UINT64)PARAM1 - (UINT64)PARAM2 - (UINT64)(flags & FLAG_C);
 				if (PARAM2 + 1 != 0)
@@ -947,36 +1152,36 @@ int drcbe_c::execute(code_handle &entry)
 					flags |= (((PARAM1) ^ (PARAM2)) & ((PARAM1) ^ (temp64)) & 0x80000000) ? FLAG_V : 0;
 				}
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_CMP, 4, 1):       // CMP     src1,src2[,f]
+			OPCODE_CASE(OP_CMP, 4, 1):        // CMP     src1,src2[,f]
 				temp32 = PARAM0 - PARAM1;
 				flags = FLAGS32_NZCV_SUB(temp32, PARAM0, PARAM1);
 //                printf("CMP: %08x - %08x = flags %x\n", PARAM0, PARAM1, flags);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_MULU, 4, 0):      // MULU    dst,edst,src1,src2[,f]
+			OPCODE_CASE(OP_MULU, 4, 0):       // MULU    dst,edst,src1,src2[,f]
 				temp64 = (UINT64)(UINT32)PARAM2 * (UINT64)(UINT32)PARAM3;
 				PARAM1 = temp64 >> 32;
 				PARAM0 = (UINT32)temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_MULU, 4, 1):
+			OPCODE_CASE(OP_MULU, 4, 1):
 				temp64 = (UINT64)(UINT32)PARAM2 * (UINT64)(UINT32)PARAM3;
 				flags = FLAGS64_NZ(temp64);
 				PARAM1 = temp64 >> 32;
 				PARAM0 = (UINT32)temp64;
 				if (temp64 != (UINT32)temp64)
 					flags |= FLAG_V;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_MULS, 4, 0):      // MULS    dst,edst,src1,src2[,f]
+			OPCODE_CASE(OP_MULS, 4, 0):       // MULS    dst,edst,src1,src2[,f]
 				temp64 = (INT64)(INT32)PARAM2 * (INT64)(INT32)PARAM3;
 				PARAM1 = temp64 >> 32;
 				PARAM0 = (UINT32)temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_MULS, 4, 1):
+			OPCODE_CASE(OP_MULS, 4, 1):
 				temp64 = (INT64)(INT32)PARAM2 * (INT64)(INT32)PARAM3;
 				temp32 = (INT32)temp64;
 				flags = FLAGS32_NZ(temp32);
@@ -984,18 +1189,18 @@ int drcbe_c::execute(code_handle &entry)
 				PARAM0 = (UINT32)temp64;
 				if (temp64 != (INT32)temp64)
 					flags |= FLAG_V;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_DIVU, 4, 0):      // DIVU    dst,edst,src1,src2[,f]
+			OPCODE_CASE(OP_DIVU, 4, 0):       // DIVU    dst,edst,src1,src2[,f]
 				if (PARAM3 != 0)
 				{
 					temp32 = (UINT32)PARAM2 / (UINT32)PARAM3;
 					PARAM1 = (UINT32)PARAM2 % (UINT32)PARAM3;
 					PARAM0 = temp32;
 				}
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_DIVU, 4, 1):
+			OPCODE_CASE(OP_DIVU, 4, 1):
 				if (PARAM3 != 0)
 				{
 					temp32 = (UINT32)PARAM2 / (UINT32)PARAM3;
@@ -1005,18 +1210,18 @@ int drcbe_c::execute(code_handle &entry)
 				}
 				else
 					flags = FLAG_V;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_DIVS, 4, 0):      // DIVS    dst,edst,src1,src2[,f]
+			OPCODE_CASE(OP_DIVS, 4, 0):       // DIVS    dst,edst,src1,src2[,f]
 				if (PARAM3 != 0)
 				{
 					temp32 = (INT32)PARAM2 / (INT32)PARAM3;
 					PARAM1 = (INT32)PARAM2 % (INT32)PARAM3;
 					PARAM0 = temp32;
 				}
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_DIVS, 4, 1):
+			OPCODE_CASE(OP_DIVS, 4, 1):
 				if (PARAM3 != 0)
 				{
 					temp32 = (INT32)PARAM2 / (INT32)PARAM3;
@@ -1026,69 +1231,69 @@ int drcbe_c::execute(code_handle &entry)
 				}
 				else
 					flags = FLAG_V;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_AND, 4, 0):       // AND     dst,src1,src2[,f]
+			OPCODE_CASE(OP_AND, 4, 0):        // AND     dst,src1,src2[,f]
 				PARAM0 = PARAM1 & PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_AND, 4, 1):
+			OPCODE_CASE(OP_AND, 4, 1):
 				temp32 = PARAM1 & PARAM2;
 				flags = FLAGS32_NZ(temp32);
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_TEST, 4, 1):      // TEST    src1,src2[,f]
+			OPCODE_CASE(OP_TEST, 4, 1):       // TEST    src1,src2[,f]
 				temp32 = PARAM0 & PARAM1;
 				flags = FLAGS32_NZ(temp32);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_OR, 4, 0):        // OR      dst,src1,src2[,f]
+			OPCODE_CASE(OP_OR, 4, 0):         // OR      dst,src1,src2[,f]
 				PARAM0 = PARAM1 | PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_OR, 4, 1):
+			OPCODE_CASE(OP_OR, 4, 1):
 				temp32 = PARAM1 | PARAM2;
 				flags = FLAGS32_NZ(temp32);
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_XOR, 4, 0):       // XOR     dst,src1,src2[,f]
+			OPCODE_CASE(OP_XOR, 4, 0):        // XOR     dst,src1,src2[,f]
 				PARAM0 = PARAM1 ^ PARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_XOR, 4, 1):
+			OPCODE_CASE(OP_XOR, 4, 1):
 				temp32 = PARAM1 ^ PARAM2;
 				flags = FLAGS32_NZ(temp32);
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LZCNT, 4, 0):     // LZCNT   dst,src
+			OPCODE_CASE(OP_LZCNT, 4, 0):      // LZCNT   dst,src
 				PARAM0 = count_leading_zeros(PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LZCNT, 4, 1):
+			OPCODE_CASE(OP_LZCNT, 4, 1):
 				temp32 = count_leading_zeros(PARAM1);
 				flags = FLAGS32_NZ(temp32);
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_BSWAP, 4, 0):     // BSWAP   dst,src
+			OPCODE_CASE(OP_BSWAP, 4, 0):      // BSWAP   dst,src
 				temp32 = PARAM1;
 				PARAM0 = FLIPENDIAN_INT32(temp32);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_BSWAP, 4, 1):
+			OPCODE_CASE(OP_BSWAP, 4, 1):
 				temp32 = PARAM1;
 				flags = FLAGS32_NZ(temp32);
 				PARAM0 = FLIPENDIAN_INT32(temp32);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SHL, 4, 0):       // SHL     dst,src,count[,f]
+			OPCODE_CASE(OP_SHL, 4, 0):        // SHL     dst,src,count[,f]
 				PARAM0 = PARAM1 << (PARAM2 & 31);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SHL, 4, 1):
+			OPCODE_CASE(OP_SHL, 4, 1):
 				shift = PARAM2 & 31;
 				temp32 = PARAM1 << shift;
 				if (shift != 0)
@@ -1097,13 +1302,13 @@ int drcbe_c::execute(code_handle &entry)
 					flags |= ((PARAM1 << (shift - 1)) >> 31) & FLAG_C;
 				}
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SHR, 4, 0):       // SHR     dst,src,count[,f]
+			OPCODE_CASE(OP_SHR, 4, 0):        // SHR     dst,src,count[,f]
 				PARAM0 = PARAM1 >> (PARAM2 & 31);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SHR, 4, 1):
+			OPCODE_CASE(OP_SHR, 4, 1):
 				shift = PARAM2 & 31;
 				temp32 = PARAM1 >> shift;
 				if (shift != 0)
@@ -1112,13 +1317,13 @@ int drcbe_c::execute(code_handle &entry)
 					flags |= (PARAM1 >> (shift - 1)) & FLAG_C;
 				}
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SAR, 4, 0):       // SAR     dst,src,count[,f]
+			OPCODE_CASE(OP_SAR, 4, 0):        // SAR     dst,src,count[,f]
 				PARAM0 = (INT32)PARAM1 >> (PARAM2 & 31);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SAR, 4, 1):
+			OPCODE_CASE(OP_SAR, 4, 1):
 				shift = PARAM2 & 31;
 				temp32 = (INT32)PARAM1 >> shift;
 				if (shift != 0)
@@ -1127,14 +1332,14 @@ int drcbe_c::execute(code_handle &entry)
 					flags |= (PARAM1 >> (shift - 1)) & FLAG_C;
 				}
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROL, 4, 0):       // ROL     dst,src,count[,f]
+			OPCODE_CASE(OP_ROL, 4, 0):        // ROL     dst,src,count[,f]
 				shift = PARAM2 & 31;
 				PARAM0 = (PARAM1 << shift) | (PARAM1 >> ((32 - shift) & 31));
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROL, 4, 1):
+			OPCODE_CASE(OP_ROL, 4, 1):
 				shift = PARAM2 & 31;
 				temp32 = (PARAM1 << shift) | (PARAM1 >> ((32 - shift) & 31));
 				if (shift != 0)
@@ -1143,17 +1348,17 @@ int drcbe_c::execute(code_handle &entry)
 					flags |= ((PARAM1 << (shift - 1)) >> 31) & FLAG_C;
 				}
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROLC, 4, 0):      // ROLC    dst,src,count[,f]
+			OPCODE_CASE(OP_ROLC, 4, 0):       // ROLC    dst,src,count[,f]
 				shift = PARAM2 & 31;
 				if (shift > 1)
 					PARAM0 = (PARAM1 << shift) | ((flags & FLAG_C) << (shift - 1)) | (PARAM1 >> (33 - shift));
 				else if (shift == 1)
 					PARAM0 = (PARAM1 << shift) | (flags & FLAG_C);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROLC, 4, 1):
+			OPCODE_CASE(OP_ROLC, 4, 1):
 				shift = PARAM2 & 31;
 				if (shift > 1)
 					temp32 = (PARAM1 << shift) | ((flags & FLAG_C) << (shift - 1)) | (PARAM1 >> (33 - shift));
@@ -1164,30 +1369,30 @@ int drcbe_c::execute(code_handle &entry)
 				flags = FLAGS32_NZ(temp32);
 				if (shift != 0) flags |= ((PARAM1 << (shift - 1)) >> 31) & FLAG_C;
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROR, 4, 0):       // ROR     dst,src,count[,f]
+			OPCODE_CASE(OP_ROR, 4, 0):        // ROR     dst,src,count[,f]
 				shift = PARAM2 & 31;
 				PARAM0 = (PARAM1 >> shift) | (PARAM1 << ((32 - shift) & 31));
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROR, 4, 1):
+			OPCODE_CASE(OP_ROR, 4, 1):
 				shift = PARAM2 & 31;
 				temp32 = (PARAM1 >> shift) | (PARAM1 << ((32 - shift) & 31));
 				flags = FLAGS32_NZ(temp32);
 				if (shift != 0) flags |= (PARAM1 >> (shift - 1)) & FLAG_C;
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_RORC, 4, 0):      // RORC    dst,src,count[,f]
+			OPCODE_CASE(OP_RORC, 4, 0):       // RORC    dst,src,count[,f]
 				shift = PARAM2 & 31;
 				if (shift > 1)
 					PARAM0 = (PARAM1 >> shift) | (((flags & FLAG_C) << 31) >> (shift - 1)) | (PARAM1 << (33 - shift));
 				else if (shift == 1)
 					PARAM0 = (PARAM1 >> shift) | ((flags & FLAG_C) << 31);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_RORC, 4, 1):
+			OPCODE_CASE(OP_RORC, 4, 1):
 				shift = PARAM2 & 31;
 				if (shift > 1)
 					temp32 = (PARAM1 >> shift) | (((flags & FLAG_C) << 31) >> (shift - 1)) | (PARAM1 << (33 - shift));
@@ -1198,407 +1403,407 @@ int drcbe_c::execute(code_handle &entry)
 				flags = FLAGS32_NZ(temp32);
 				if (shift != 0) flags |= (PARAM1 >> (shift - 1)) & FLAG_C;
 				PARAM0 = temp32;
-				break;
+				OPCODE_NEXT;
 
 
 			// ----------------------- 64-Bit Integer Operations -----------------------
 
-			case MAKE_OPCODE_SHORT(OP_LOAD1, 8, 0):     // DLOAD   dst,base,index,BYTE
+			OPCODE_CASE(OP_LOAD1, 8, 0):      // DLOAD   dst,base,index,BYTE
 				DPARAM0 = inst[1].puint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD1x2, 8, 0):   // DLOAD   dst,base,index,BYTE_x2
+			OPCODE_CASE(OP_LOAD1x2, 8, 0):    // DLOAD   dst,base,index,BYTE_x2
 				DPARAM0 = *(UINT8 *)&inst[1].puint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD1x4, 8, 0):   // DLOAD   dst,base,index,BYTE_x4
+			OPCODE_CASE(OP_LOAD1x4, 8, 0):    // DLOAD   dst,base,index,BYTE_x4
 				DPARAM0 = *(UINT8 *)&inst[1].puint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD1x8, 8, 0):   // DLOAD   dst,base,index,BYTE_x8
+			OPCODE_CASE(OP_LOAD1x8, 8, 0):    // DLOAD   dst,base,index,BYTE_x8
 				DPARAM0 = *(UINT8 *)&inst[1].puint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD2x1, 8, 0):   // DLOAD   dst,base,index,WORD_x1
+			OPCODE_CASE(OP_LOAD2x1, 8, 0):    // DLOAD   dst,base,index,WORD_x1
 				DPARAM0 = *(UINT16 *)&inst[1].puint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD2, 8, 0):     // DLOAD   dst,base,index,WORD
+			OPCODE_CASE(OP_LOAD2, 8, 0):      // DLOAD   dst,base,index,WORD
 				DPARAM0 = inst[1].puint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD2x4, 8, 0):   // DLOAD   dst,base,index,WORD_x4
+			OPCODE_CASE(OP_LOAD2x4, 8, 0):    // DLOAD   dst,base,index,WORD_x4
 				DPARAM0 = *(UINT16 *)&inst[1].puint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD2x8, 8, 0):   // DLOAD   dst,base,index,WORD_x8
+			OPCODE_CASE(OP_LOAD2x8, 8, 0):    // DLOAD   dst,base,index,WORD_x8
 				DPARAM0 = *(UINT16 *)&inst[1].puint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD4x1, 8, 0):   // DLOAD   dst,base,index,DWORD_x1
+			OPCODE_CASE(OP_LOAD4x1, 8, 0):    // DLOAD   dst,base,index,DWORD_x1
 				DPARAM0 = *(UINT32 *)&inst[1].puint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD4x2, 8, 0):   // DLOAD   dst,base,index,DWORD_x2
+			OPCODE_CASE(OP_LOAD4x2, 8, 0):    // DLOAD   dst,base,index,DWORD_x2
 				DPARAM0 = *(UINT32 *)&inst[1].puint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD4, 8, 0):     // DLOAD   dst,base,index,DWORD
+			OPCODE_CASE(OP_LOAD4, 8, 0):      // DLOAD   dst,base,index,DWORD
 				DPARAM0 = inst[1].puint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD4x8, 8, 0):   // DLOAD   dst,base,index,DWORD_x8
+			OPCODE_CASE(OP_LOAD4x8, 8, 0):    // DLOAD   dst,base,index,DWORD_x8
 				DPARAM0 = *(UINT32 *)&inst[1].puint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD8x1, 8, 0):   // DLOAD   dst,base,index,QWORD_x1
+			OPCODE_CASE(OP_LOAD8x1, 8, 0):    // DLOAD   dst,base,index,QWORD_x1
 				DPARAM0 = *(UINT64 *)&inst[1].puint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD8x2, 8, 0):   // DLOAD   dst,base,index,QWORD_x2
+			OPCODE_CASE(OP_LOAD8x2, 8, 0):    // DLOAD   dst,base,index,QWORD_x2
 				DPARAM0 = *(UINT64 *)&inst[1].puint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD8x4, 8, 0):   // DLOAD   dst,base,index,QWORD_x4
+			OPCODE_CASE(OP_LOAD8x4, 8, 0):    // DLOAD   dst,base,index,QWORD_x4
 				DPARAM0 = *(UINT64 *)&inst[1].puint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOAD8, 8, 0):     // DLOAD   dst,base,index,QWORD
+			OPCODE_CASE(OP_LOAD8, 8, 0):      // DLOAD   dst,base,index,QWORD
 				DPARAM0 = inst[1].puint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS1, 8, 0):    // DLOADS  dst,base,index,BYTE
+			OPCODE_CASE(OP_LOADS1, 8, 0):     // DLOADS  dst,base,index,BYTE
 				DPARAM0 = inst[1].pint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS1x2, 8, 0):  // DLOADS  dst,base,index,BYTE_x2
+			OPCODE_CASE(OP_LOADS1x2, 8, 0):   // DLOADS  dst,base,index,BYTE_x2
 				DPARAM0 = *(INT8 *)&inst[1].pint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS1x4, 8, 0):  // DLOADS  dst,base,index,BYTE_x4
+			OPCODE_CASE(OP_LOADS1x4, 8, 0):   // DLOADS  dst,base,index,BYTE_x4
 				DPARAM0 = *(INT8 *)&inst[1].pint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS1x8, 8, 0):  // DLOADS  dst,base,index,BYTE_x8
+			OPCODE_CASE(OP_LOADS1x8, 8, 0):   // DLOADS  dst,base,index,BYTE_x8
 				DPARAM0 = *(INT8 *)&inst[1].pint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS2x1, 8, 0):  // DLOADS  dst,base,index,WORD_x1
+			OPCODE_CASE(OP_LOADS2x1, 8, 0):   // DLOADS  dst,base,index,WORD_x1
 				DPARAM0 = *(INT16 *)&inst[1].pint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS2, 8, 0):    // DLOADS  dst,base,index,WORD
+			OPCODE_CASE(OP_LOADS2, 8, 0):     // DLOADS  dst,base,index,WORD
 				DPARAM0 = inst[1].pint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS2x4, 8, 0):  // DLOADS  dst,base,index,WORD_x4
+			OPCODE_CASE(OP_LOADS2x4, 8, 0):   // DLOADS  dst,base,index,WORD_x4
 				DPARAM0 = *(INT16 *)&inst[1].pint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS2x8, 8, 0):  // DLOADS  dst,base,index,WORD_x8
+			OPCODE_CASE(OP_LOADS2x8, 8, 0):   // DLOADS  dst,base,index,WORD_x8
 				DPARAM0 = *(INT16 *)&inst[1].pint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS4x1, 8, 0):  // DLOADS  dst,base,index,DWORD_x1
+			OPCODE_CASE(OP_LOADS4x1, 8, 0):   // DLOADS  dst,base,index,DWORD_x1
 				DPARAM0 = *(INT32 *)&inst[1].pint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS4x2, 8, 0):  // DLOADS  dst,base,index,DWORD_x2
+			OPCODE_CASE(OP_LOADS4x2, 8, 0):   // DLOADS  dst,base,index,DWORD_x2
 				DPARAM0 = *(INT32 *)&inst[1].pint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS4, 8, 0):    // DLOADS  dst,base,index,DWORD
+			OPCODE_CASE(OP_LOADS4, 8, 0):     // DLOADS  dst,base,index,DWORD
 				DPARAM0 = inst[1].pint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS4x8, 8, 0):  // DLOADS  dst,base,index,DWORD_x8
+			OPCODE_CASE(OP_LOADS4x8, 8, 0):   // DLOADS  dst,base,index,DWORD_x8
 				DPARAM0 = *(INT32 *)&inst[1].pint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS8x1, 8, 0):  // DLOADS  dst,base,index,QWORD_x1
+			OPCODE_CASE(OP_LOADS8x1, 8, 0):   // DLOADS  dst,base,index,QWORD_x1
 				DPARAM0 = *(INT64 *)&inst[1].pint8[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS8x2, 8, 0):  // DLOADS  dst,base,index,QWORD_x2
+			OPCODE_CASE(OP_LOADS8x2, 8, 0):   // DLOADS  dst,base,index,QWORD_x2
 				DPARAM0 = *(INT64 *)&inst[1].pint16[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS8x4, 8, 0):  // DLOADS  dst,base,index,QWORD_x4
+			OPCODE_CASE(OP_LOADS8x4, 8, 0):   // DLOADS  dst,base,index,QWORD_x4
 				DPARAM0 = *(INT64 *)&inst[1].pint32[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LOADS8, 8, 0):    // DLOADS  dst,base,index,QWORD
+			OPCODE_CASE(OP_LOADS8, 8, 0):     // DLOADS  dst,base,index,QWORD
 				DPARAM0 = inst[1].pint64[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE1, 8, 0):    // DSTORE  dst,base,index,BYTE
+			OPCODE_CASE(OP_STORE1, 8, 0):     // DSTORE  dst,base,index,BYTE
 				inst[0].puint8[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE1x2, 8, 0):  // DSTORE  dst,base,index,BYTE_x2
+			OPCODE_CASE(OP_STORE1x2, 8, 0):   // DSTORE  dst,base,index,BYTE_x2
 				*(UINT8 *)&inst[0].puint16[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE1x4, 8, 0):  // DSTORE  dst,base,index,BYTE_x4
+			OPCODE_CASE(OP_STORE1x4, 8, 0):   // DSTORE  dst,base,index,BYTE_x4
 				*(UINT8 *)&inst[0].puint32[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE1x8, 8, 0):  // DSTORE  dst,base,index,BYTE_x8
+			OPCODE_CASE(OP_STORE1x8, 8, 0):   // DSTORE  dst,base,index,BYTE_x8
 				*(UINT8 *)&inst[0].puint64[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE2x1, 8, 0):  // DSTORE  dst,base,index,WORD_x1
+			OPCODE_CASE(OP_STORE2x1, 8, 0):   // DSTORE  dst,base,index,WORD_x1
 				*(UINT16 *)&inst[0].puint8[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE2, 8, 0):    // DSTORE  dst,base,index,WORD
+			OPCODE_CASE(OP_STORE2, 8, 0):     // DSTORE  dst,base,index,WORD
 				inst[0].puint16[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE2x4, 8, 0):  // DSTORE  dst,base,index,WORD_x4
+			OPCODE_CASE(OP_STORE2x4, 8, 0):   // DSTORE  dst,base,index,WORD_x4
 				*(UINT16 *)&inst[0].puint32[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE2x8, 8, 0):  // DSTORE  dst,base,index,WORD_x8
+			OPCODE_CASE(OP_STORE2x8, 8, 0):   // DSTORE  dst,base,index,WORD_x8
 				*(UINT16 *)&inst[0].puint64[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE4x1, 8, 0):  // DSTORE  dst,base,index,DWORD_x1
+			OPCODE_CASE(OP_STORE4x1, 8, 0):   // DSTORE  dst,base,index,DWORD_x1
 				*(UINT32 *)&inst[0].puint8[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE4x2, 8, 0):  // DSTORE  dst,base,index,DWORD_x2
+			OPCODE_CASE(OP_STORE4x2, 8, 0):   // DSTORE  dst,base,index,DWORD_x2
 				*(UINT32 *)&inst[0].puint16[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE4, 8, 0):    // DSTORE  dst,base,index,DWORD
+			OPCODE_CASE(OP_STORE4, 8, 0):     // DSTORE  dst,base,index,DWORD
 				inst[0].puint32[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE4x8, 8, 0):  // DSTORE  dst,base,index,DWORD_x8
+			OPCODE_CASE(OP_STORE4x8, 8, 0):   // DSTORE  dst,base,index,DWORD_x8
 				*(UINT32 *)&inst[0].puint64[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE8x1, 8, 0):  // DSTORE  dst,base,index,QWORD_x1
+			OPCODE_CASE(OP_STORE8x1, 8, 0):   // DSTORE  dst,base,index,QWORD_x1
 				*(UINT64 *)&inst[0].puint8[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE8x2, 8, 0):  // DSTORE  dst,base,index,QWORD_x2
+			OPCODE_CASE(OP_STORE8x2, 8, 0):   // DSTORE  dst,base,index,QWORD_x2
 				*(UINT64 *)&inst[0].puint16[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE8x4, 8, 0):  // DSTORE  dst,base,index,QWORD_x4
+			OPCODE_CASE(OP_STORE8x4, 8, 0):   // DSTORE  dst,base,index,QWORD_x4
 				*(UINT64 *)&inst[0].puint32[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_STORE8, 8, 0):    // DSTORE  dst,base,index,QWORD
+			OPCODE_CASE(OP_STORE8, 8, 0):     // DSTORE  dst,base,index,QWORD
 				inst[0].puint64[PARAM1] = DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_READ1, 8, 0):     // DREAD   dst,src1,space_BYTE
+			OPCODE_CASE(OP_READ1, 8, 0):      // DREAD   dst,src1,space_BYTE
 				DPARAM0 = m_space[PARAM2]->read_byte(PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_READ2, 8, 0):     // DREAD   dst,src1,space_WORD
+			OPCODE_CASE(OP_READ2, 8, 0):      // DREAD   dst,src1,space_WORD
 				DPARAM0 = m_space[PARAM2]->read_word(PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_READ4, 8, 0):     // DREAD   dst,src1,space_DWORD
+			OPCODE_CASE(OP_READ4, 8, 0):      // DREAD   dst,src1,space_DWORD
 				DPARAM0 = m_space[PARAM2]->read_dword(PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_READ8, 8, 0):     // DREAD   dst,src1,space_QOWRD
+			OPCODE_CASE(OP_READ8, 8, 0):      // DREAD   dst,src1,space_QOWRD
 				DPARAM0 = m_space[PARAM2]->read_qword(PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_READM2, 8, 0):    // DREADM  dst,src1,mask,space_WORD
+			OPCODE_CASE(OP_READM2, 8, 0):     // DREADM  dst,src1,mask,space_WORD
 				DPARAM0 = m_space[PARAM3]->read_word(PARAM1, PARAM2);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_READM4, 8, 0):    // DREADM  dst,src1,mask,space_DWORD
+			OPCODE_CASE(OP_READM4, 8, 0):     // DREADM  dst,src1,mask,space_DWORD
 				DPARAM0 = m_space[PARAM3]->read_dword(PARAM1, PARAM2);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_READM8, 8, 0):    // DREADM  dst,src1,mask,space_QWORD
+			OPCODE_CASE(OP_READM8, 8, 0):     // DREADM  dst,src1,mask,space_QWORD
 				DPARAM0 = m_space[PARAM3]->read_qword(PARAM1, PARAM2);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_WRITE1, 8, 0):    // DWRITE  dst,src1,space_BYTE
+			OPCODE_CASE(OP_WRITE1, 8, 0):     // DWRITE  dst,src1,space_BYTE
 				m_space[PARAM2]->write_byte(PARAM0, PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_WRITE2, 8, 0):    // DWRITE  dst,src1,space_WORD
+			OPCODE_CASE(OP_WRITE2, 8, 0):     // DWRITE  dst,src1,space_WORD
 				m_space[PARAM2]->write_word(PARAM0, PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_WRITE4, 8, 0):    // DWRITE  dst,src1,space_DWORD
+			OPCODE_CASE(OP_WRITE4, 8, 0):     // DWRITE  dst,src1,space_DWORD
 				m_space[PARAM2]->write_dword(PARAM0, PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_WRITE8, 8, 0):    // DWRITE  dst,src1,space_QWORD
+			OPCODE_CASE(OP_WRITE8, 8, 0):     // DWRITE  dst,src1,space_QWORD
 				m_space[PARAM2]->write_qword(PARAM0, DPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_WRITEM2, 8, 0):   // DWRITEM dst,src1,mask,space_WORD
+			OPCODE_CASE(OP_WRITEM2, 8, 0):    // DWRITEM dst,src1,mask,space_WORD
 				m_space[PARAM3]->write_word(PARAM0, DPARAM1, DPARAM2);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_WRITEM4, 8, 0):   // DWRITEM dst,src1,mask,space_DWORD
+			OPCODE_CASE(OP_WRITEM4, 8, 0):    // DWRITEM dst,src1,mask,space_DWORD
 				m_space[PARAM3]->write_dword(PARAM0, DPARAM1, DPARAM2);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_WRITEM8, 8, 0):   // DWRITEM dst,src1,mask,space_QWORD
+			OPCODE_CASE(OP_WRITEM8, 8, 0):    // DWRITEM dst,src1,mask,space_QWORD
 				m_space[PARAM3]->write_qword(PARAM0, DPARAM1, DPARAM2);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_CARRY, 8, 0):     // DCARRY  src,bitnum
+			OPCODE_CASE(OP_CARRY, 8, 0):      // DCARRY  src,bitnum
 				flags = (flags & ~FLAG_C) | ((DPARAM0 >> (DPARAM1 & 63)) & FLAG_C);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_MOV, 8, 1):       // DMOV    dst,src[,c]
+			OPCODE_CASE(OP_MOV, 8, 1):        // DMOV    dst,src[,c]
 				if (OPCODE_FAIL_CONDITION(opcode, flags))
-					break;
+					OPCODE_NEXT;
 				// fall through...
 
-			case MAKE_OPCODE_SHORT(OP_MOV, 8, 0):
+			OPCODE_CASE(OP_MOV, 8, 0):
 				DPARAM0 = DPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SET, 8, 1):       // DSET    dst,c
+			OPCODE_CASE(OP_SET, 8, 1):        // DSET    dst,c
 				DPARAM0 = OPCODE_FAIL_CONDITION(opcode, flags) ? 0 : 1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SEXT1, 8, 0):     // DSEXT   dst,src,BYTE
+			OPCODE_CASE(OP_SEXT1, 8, 0):      // DSEXT   dst,src,BYTE
 				DPARAM0 = (INT8)PARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SEXT1, 8, 1):
+			OPCODE_CASE(OP_SEXT1, 8, 1):
 				temp64 = (INT8)PARAM1;
 				flags = FLAGS64_NZ(temp64);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SEXT2, 8, 0):     // DSEXT   dst,src,WORD
+			OPCODE_CASE(OP_SEXT2, 8, 0):      // DSEXT   dst,src,WORD
 				DPARAM0 = (INT16)PARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SEXT2, 8, 1):
+			OPCODE_CASE(OP_SEXT2, 8, 1):
 				temp64 = (INT16)PARAM1;
 				flags = FLAGS64_NZ(temp64);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SEXT4, 8, 0):     // DSEXT   dst,src,DWORD
+			OPCODE_CASE(OP_SEXT4, 8, 0):      // DSEXT   dst,src,DWORD
 				DPARAM0 = (INT32)PARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SEXT4, 8, 1):
+			OPCODE_CASE(OP_SEXT4, 8, 1):
 				temp64 = (INT32)PARAM1;
 				flags = FLAGS64_NZ(temp64);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROLAND, 8, 0):    // DROLAND dst,src,count,mask[,f]
+			OPCODE_CASE(OP_ROLAND, 8, 0):     // DROLAND dst,src,count,mask[,f]
 				shift = DPARAM2 & 63;
 				DPARAM0 = ((DPARAM1 << shift) | (DPARAM1 >> (64 - shift))) & DPARAM3;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROLAND, 8, 1):
+			OPCODE_CASE(OP_ROLAND, 8, 1):
 				shift = DPARAM2 & 63;
 				temp64 = ((DPARAM1 << shift) | (DPARAM1 >> (64 - shift))) & DPARAM3;
 				flags = FLAGS64_NZ(temp64);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROLINS, 8, 0):    // DROLINS dst,src,count,mask[,f]
+			OPCODE_CASE(OP_ROLINS, 8, 0):     // DROLINS dst,src,count,mask[,f]
 				shift = DPARAM2 & 63;
 				DPARAM0 = (DPARAM0 & ~DPARAM3) | (((DPARAM1 << shift) | (DPARAM1 >> (64 - shift))) & DPARAM3);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROLINS, 8, 1):
+			OPCODE_CASE(OP_ROLINS, 8, 1):
 				shift = DPARAM2 & 63;
 				temp64 = (DPARAM0 & ~DPARAM3) | (((DPARAM1 << shift) | (DPARAM1 >> (64 - shift))) & DPARAM3);
 				flags = FLAGS64_NZ(temp64);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ADD, 8, 0):       // DADD    dst,src1,src2[,f]
+			OPCODE_CASE(OP_ADD, 8, 0):        // DADD    dst,src1,src2[,f]
 				DPARAM0 = DPARAM1 + DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ADD, 8, 1):
+			OPCODE_CASE(OP_ADD, 8, 1):
 				temp64 = DPARAM1 + DPARAM2;
 				flags = FLAGS64_NZCV_ADD(temp64, DPARAM1, DPARAM2);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ADDC, 8, 0):      // DADDC   dst,src1,src2[,f]
+			OPCODE_CASE(OP_ADDC, 8, 0):       // DADDC   dst,src1,src2[,f]
 				DPARAM0 = DPARAM1 + DPARAM2 + (flags & FLAG_C);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ADDC, 8, 1):
+			OPCODE_CASE(OP_ADDC, 8, 1):
 				temp64 = DPARAM1 + DPARAM2 + (flags & FLAG_C);
 				if (DPARAM2 + 1 != 0)
 					flags = FLAGS64_NZCV_ADD(temp64, DPARAM1, DPARAM2 + (flags & FLAG_C));
 				else
 					flags = FLAGS64_NZCV_ADD(temp64, DPARAM1 + (flags & FLAG_C), DPARAM2);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SUB, 8, 0):       // DSUB    dst,src1,src2[,f]
+			OPCODE_CASE(OP_SUB, 8, 0):        // DSUB    dst,src1,src2[,f]
 				DPARAM0 = DPARAM1 - DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SUB, 8, 1):
+			OPCODE_CASE(OP_SUB, 8, 1):
 				temp64 = DPARAM1 - DPARAM2;
 				flags = FLAGS64_NZCV_SUB(temp64, DPARAM1, DPARAM2);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SUBB, 8, 0):      // DSUBB   dst,src1,src2[,f]
+			OPCODE_CASE(OP_SUBB, 8, 0):       // DSUBB   dst,src1,src2[,f]
 				DPARAM0 = DPARAM1 - DPARAM2 - (flags & FLAG_C);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SUBB, 8, 1):
+			OPCODE_CASE(OP_SUBB, 8, 1):
 				temp64 = DPARAM1 - DPARAM2 - (flags & FLAG_C);
 				if (DPARAM2 + 1 != 0)
 					flags = FLAGS64_NZCV_SUB(temp64, DPARAM1, DPARAM2 + (flags & FLAG_C));
 				else
 					flags = FLAGS64_NZCV_SUB(temp64, DPARAM1 - (flags & FLAG_C), DPARAM2);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_CMP, 8, 1):       // DCMP    src1,src2[,f]
+			OPCODE_CASE(OP_CMP, 8, 1):        // DCMP    src1,src2[,f]
 				temp64 = DPARAM0 - DPARAM1;
 				flags = FLAGS64_NZCV_SUB(temp64, DPARAM0, DPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_MULU, 8, 0):      // DMULU   dst,edst,src1,src2[,f]
+			OPCODE_CASE(OP_MULU, 8, 0):       // DMULU   dst,edst,src1,src2[,f]
 				dmulu(*inst[0].puint64, *inst[1].puint64, DPARAM2, DPARAM3, FALSE);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_MULU, 8, 1):
+			OPCODE_CASE(OP_MULU, 8, 1):
 				flags = dmulu(*inst[0].puint64, *inst[1].puint64, DPARAM2, DPARAM3, TRUE);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_MULS, 8, 0):      // DMULS   dst,edst,src1,src2[,f]
+			OPCODE_CASE(OP_MULS, 8, 0):       // DMULS   dst,edst,src1,src2[,f]
 				dmuls(*inst[0].puint64, *inst[1].puint64, DPARAM2, DPARAM3, FALSE);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_MULS, 8, 1):
+			OPCODE_CASE(OP_MULS, 8, 1):
 				flags = dmuls(*inst[0].puint64, *inst[1].puint64, DPARAM2, DPARAM3, TRUE);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_DIVU, 8, 0):      // DDIVU   dst,edst,src1,src2[,f]
+			OPCODE_CASE(OP_DIVU, 8, 0):       // DDIVU   dst,edst,src1,src2[,f]
 				if (DPARAM3 != 0)
 				{
 					temp64 = (UINT64)DPARAM2 / (UINT64)DPARAM3;
 					DPARAM1 = (UINT64)DPARAM2 % (UINT64)DPARAM3;
 					DPARAM0 = temp64;
 				}
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_DIVU, 8, 1):
+			OPCODE_CASE(OP_DIVU, 8, 1):
 				if (DPARAM3 != 0)
 				{
 					temp64 = (UINT64)DPARAM2 / (UINT64)DPARAM3;
@@ -1608,18 +1813,18 @@ int drcbe_c::execute(code_handle &entry)
 				}
 				else
 					flags = FLAG_V;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_DIVS, 8, 0):      // DDIVS   dst,edst,src1,src2[,f]
+			OPCODE_CASE(OP_DIVS, 8, 0):       // DDIVS   dst,edst,src1,src2[,f]
 				if (DPARAM3 != 0)
 				{
 					temp64 = (INT64)DPARAM2 / (INT64)DPARAM3;
 					DPARAM1 = (INT64)DPARAM2 % (INT64)DPARAM3;
 					DPARAM0 = temp64;
 				}
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_DIVS, 8, 1):
+			OPCODE_CASE(OP_DIVS, 8, 1):
 				if (DPARAM3 != 0)
 				{
 					temp64 = (INT64)DPARAM2 / (INT64)DPARAM3;
@@ -1629,128 +1834,128 @@ int drcbe_c::execute(code_handle &entry)
 				}
 				else
 					flags = FLAG_V;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_AND, 8, 0):       // DAND    dst,src1,src2[,f]
+			OPCODE_CASE(OP_AND, 8, 0):        // DAND    dst,src1,src2[,f]
 				DPARAM0 = DPARAM1 & DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_AND, 8, 1):
+			OPCODE_CASE(OP_AND, 8, 1):
 				temp64 = DPARAM1 & DPARAM2;
 				flags = FLAGS64_NZ(temp64);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_TEST, 8, 1):      // DTEST   src1,src2[,f]
+			OPCODE_CASE(OP_TEST, 8, 1):       // DTEST   src1,src2[,f]
 				temp64 = DPARAM1 & DPARAM2;
 				flags = FLAGS64_NZ(temp64);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_OR, 8, 0):        // DOR     dst,src1,src2[,f]
+			OPCODE_CASE(OP_OR, 8, 0):         // DOR     dst,src1,src2[,f]
 				DPARAM0 = DPARAM1 | DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_OR, 8, 1):
+			OPCODE_CASE(OP_OR, 8, 1):
 				temp64 = DPARAM1 | DPARAM2;
 				flags = FLAGS64_NZ(temp64);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_XOR, 8, 0):       // DXOR    dst,src1,src2[,f]
+			OPCODE_CASE(OP_XOR, 8, 0):        // DXOR    dst,src1,src2[,f]
 				DPARAM0 = DPARAM1 ^ DPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_XOR, 8, 1):
+			OPCODE_CASE(OP_XOR, 8, 1):
 				temp64 = DPARAM1 ^ DPARAM2;
 				flags = FLAGS64_NZ(temp64);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LZCNT, 8, 0):     // DLZCNT  dst,src
+			OPCODE_CASE(OP_LZCNT, 8, 0):      // DLZCNT  dst,src
 				if ((UINT32)(DPARAM1 >> 32) != 0)
 					DPARAM0 = count_leading_zeros(DPARAM1 >> 32);
 				else
 					DPARAM0 = 32 + count_leading_zeros(DPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_LZCNT, 8, 1):
+			OPCODE_CASE(OP_LZCNT, 8, 1):
 				if ((UINT32)(DPARAM1 >> 32) != 0)
 					temp64 = count_leading_zeros(DPARAM1 >> 32);
 				else
 					temp64 = 32 + count_leading_zeros(DPARAM1);
 				flags = FLAGS64_NZ(temp64);
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_BSWAP, 8, 0):     // DBSWAP  dst,src
+			OPCODE_CASE(OP_BSWAP, 8, 0):      // DBSWAP  dst,src
 				temp64 = DPARAM1;
 				DPARAM0 = FLIPENDIAN_INT64(temp64);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_BSWAP, 8, 1):
+			OPCODE_CASE(OP_BSWAP, 8, 1):
 				temp64 = DPARAM1;
 				flags = FLAGS64_NZ(temp64);
 				DPARAM0 = FLIPENDIAN_INT64(temp64);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SHL, 8, 0):       // DSHL    dst,src,count[,f]
+			OPCODE_CASE(OP_SHL, 8, 0):        // DSHL    dst,src,count[,f]
 				DPARAM0 = DPARAM1 << (DPARAM2 & 63);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SHL, 8, 1):
+			OPCODE_CASE(OP_SHL, 8, 1):
 				shift = DPARAM2 & 63;
 				temp64 = DPARAM1 << shift;
 				flags = FLAGS64_NZ(temp64);
 				if (shift != 0) flags |= ((DPARAM1 << (shift - 1)) >> 63) & FLAG_C;
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SHR, 8, 0):       // DSHR    dst,src,count[,f]
+			OPCODE_CASE(OP_SHR, 8, 0):        // DSHR    dst,src,count[,f]
 				DPARAM0 = DPARAM1 >> (DPARAM2 & 63);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SHR, 8, 1):
+			OPCODE_CASE(OP_SHR, 8, 1):
 				shift = DPARAM2 & 63;
 				temp64 = DPARAM1 >> shift;
 				flags = FLAGS64_NZ(temp64);
 				if (shift != 0) flags |= (DPARAM1 >> (shift - 1)) & FLAG_C;
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SAR, 8, 0):       // DSAR    dst,src,count[,f]
+			OPCODE_CASE(OP_SAR, 8, 0):        // DSAR    dst,src,count[,f]
 				DPARAM0 = (INT64)DPARAM1 >> (DPARAM2 & 63);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_SAR, 8, 1):
+			OPCODE_CASE(OP_SAR, 8, 1):
 				shift = DPARAM2 & 63;
 				temp64 = (INT32)DPARAM1 >> shift;
 				flags = FLAGS64_NZ(temp64);
 				if (shift != 0) flags |= (DPARAM1 >> (shift - 1)) & FLAG_C;
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROL, 8, 0):       // DROL    dst,src,count[,f]
+			OPCODE_CASE(OP_ROL, 8, 0):        // DROL    dst,src,count[,f]
 				shift = DPARAM2 & 31;
 				DPARAM0 = (DPARAM1 << shift) | (DPARAM1 >> ((64 - shift) & 63));
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROL, 8, 1):
+			OPCODE_CASE(OP_ROL, 8, 1):
 				shift = DPARAM2 & 63;
 				temp64 = (DPARAM1 << shift) | (DPARAM1 >> ((64 - shift) & 63));
 				flags = FLAGS64_NZ(temp64);
 				if (shift != 0) flags |= ((DPARAM1 << (shift - 1)) >> 63) & FLAG_C;
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROLC, 8, 0):      // DROLC   dst,src,count[,f]
+			OPCODE_CASE(OP_ROLC, 8, 0):       // DROLC   dst,src,count[,f]
 				shift = DPARAM2 & 63;
 				if (shift > 1)
 					DPARAM0 = (DPARAM1 << shift) | ((flags & FLAG_C) << (shift - 1)) | (DPARAM1 >> (65 - shift));
 				else if (shift == 1)
 					DPARAM0 = (DPARAM1 << shift) | (flags & FLAG_C);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROLC, 8, 1):
+			OPCODE_CASE(OP_ROLC, 8, 1):
 				shift = DPARAM2 & 63;
 				if (shift > 1)
 					temp64 = (DPARAM1 << shift) | ((flags & FLAG_C) << (shift - 1)) | (DPARAM1 >> (65 - shift));
@@ -1761,30 +1966,30 @@ int drcbe_c::execute(code_handle &entry)
 				flags = FLAGS64_NZ(temp64);
 				if (shift != 0) flags |= ((DPARAM1 << (shift - 1)) >> 63) & FLAG_C;
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROR, 8, 0):       // DROR    dst,src,count[,f]
+			OPCODE_CASE(OP_ROR, 8, 0):        // DROR    dst,src,count[,f]
 				shift = DPARAM2 & 63;
 				DPARAM0 = (DPARAM1 >> shift) | (DPARAM1 << ((64 - shift) & 63));
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_ROR, 8, 1):
+			OPCODE_CASE(OP_ROR, 8, 1):
 				shift = DPARAM2 & 63;
 				temp64 = (DPARAM1 >> shift) | (DPARAM1 << ((64 - shift) & 63));
 				flags = FLAGS64_NZ(temp64);
 				if (shift != 0) flags |= (DPARAM1 >> (shift - 1)) & FLAG_C;
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_RORC, 8, 0):      // DRORC   dst,src,count[,f]
+			OPCODE_CASE(OP_RORC, 8, 0):       // DRORC   dst,src,count[,f]
 				shift = DPARAM2 & 63;
 				if (shift > 1)
 					DPARAM0 = (DPARAM1 >> shift) | ((((UINT64)flags & FLAG_C) << 63) >> (shift - 1)) | (DPARAM1 << (65 - shift));
 				else if (shift == 1)
 					DPARAM0 = (DPARAM1 >> shift) | (((UINT64)flags & FLAG_C) << 63);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_RORC, 8, 1):
+			OPCODE_CASE(OP_RORC, 8, 1):
 				shift = DPARAM2 & 63;
 				if (shift > 1)
 					temp64 = (DPARAM1 >> shift) | ((((UINT64)flags & FLAG_C) << 63) >> (shift - 1)) | (DPARAM1 << (65 - shift));
@@ -1795,283 +2000,335 @@ int drcbe_c::execute(code_handle &entry)
 				flags = FLAGS64_NZ(temp64);
 				if (shift != 0) flags |= (DPARAM1 >> (shift - 1)) & FLAG_C;
 				DPARAM0 = temp64;
-				break;
+				OPCODE_NEXT;
 
 
 			// ----------------------- 32-Bit Floating Point Operations -----------------------
 
-			case MAKE_OPCODE_SHORT(OP_FLOAD, 4, 0):     // FSLOAD  dst,base,index
+			OPCODE_CASE(OP_FLOAD, 4, 0):      // FSLOAD  dst,base,index
 				FSPARAM0 = inst[1].pfloat[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FSTORE, 4, 0):    // FSSTORE dst,base,index
+			OPCODE_CASE(OP_FSTORE, 4, 0):     // FSSTORE dst,base,index
 				inst[0].pfloat[PARAM1] = FSPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FREAD, 4, 0):     // FSREAD  dst,src1,space
+			OPCODE_CASE(OP_FREAD, 4, 0):      // FSREAD  dst,src1,space
 				PARAM0 = m_space[PARAM2]->read_dword(PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FWRITE, 4, 0):    // FSWRITE dst,src1,space
+			OPCODE_CASE(OP_FWRITE, 4, 0):     // FSWRITE dst,src1,space
 				m_space[PARAM2]->write_dword(PARAM0, PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FMOV, 4, 1):      // FSMOV   dst,src[,c]
+			OPCODE_CASE(OP_FMOV, 4, 1):       // FSMOV   dst,src[,c]
 				if (OPCODE_FAIL_CONDITION(opcode, flags))
-					break;
+					OPCODE_NEXT;
 				// fall through...
 
-			case MAKE_OPCODE_SHORT(OP_FMOV, 4, 0):
+			OPCODE_CASE(OP_FMOV, 4, 0):
 				FSPARAM0 = FSPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI4T, 4, 0):    // FSTOI4T dst,src1
+			OPCODE_CASE(OP_FTOI4T, 4, 0):     // FSTOI4T dst,src1
 				if (FSPARAM1 >= 0)
 					*inst[0].pint32 = floor(FSPARAM1);
 				else
 					*inst[0].pint32 = ceil(FSPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI4R, 4, 0):    // FSTOI4R dst,src1
+			OPCODE_CASE(OP_FTOI4R, 4, 0):     // FSTOI4R dst,src1
 				if (FSPARAM1 >= 0)
 					*inst[0].pint32 = floor(FSPARAM1 + 0.5f);
 				else
 					*inst[0].pint32 = ceil(FSPARAM1 - 0.5f);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI4F, 4, 0):    // FSTOI4F dst,src1
+			OPCODE_CASE(OP_FTOI4F, 4, 0):     // FSTOI4F dst,src1
 				*inst[0].pint32 = floor(FSPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI4C, 4, 0):    // FSTOI4C dst,src1
+			OPCODE_CASE(OP_FTOI4C, 4, 0):     // FSTOI4C dst,src1
 				*inst[0].pint32 = ceil(FSPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI4, 4, 0):     // FSTOI4  dst,src1
+			OPCODE_CASE(OP_FTOI4, 4, 0):      // FSTOI4  dst,src1
 				*inst[0].pint32 = FSPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI8T, 4, 0):    // FSTOI8T dst,src1
+			OPCODE_CASE(OP_FTOI8T, 4, 0):     // FSTOI8T dst,src1
 				if (FSPARAM1 >= 0)
 					*inst[0].pint64 = floor(FSPARAM1);
 				else
 					*inst[0].pint64 = ceil(FSPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI8R, 4, 0):    // FSTOI8R dst,src1
+			OPCODE_CASE(OP_FTOI8R, 4, 0):     // FSTOI8R dst,src1
 				if (FSPARAM1 >= 0)
 					*inst[0].pint64 = floor(FSPARAM1 + 0.5f);
 				else
 					*inst[0].pint64 = ceil(FSPARAM1 - 0.5f);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI8F, 4, 0):    // FSTOI8F dst,src1
+			OPCODE_CASE(OP_FTOI8F, 4, 0):     // FSTOI8F dst,src1
 				*inst[0].pint64 = floor(FSPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI8C, 4, 0):    // FSTOI8C dst,src1
+			OPCODE_CASE(OP_FTOI8C, 4, 0):     // FSTOI8C dst,src1
 				*inst[0].pint64 = ceil(FSPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI8, 4, 0):     // FSTOI8  dst,src1
+			OPCODE_CASE(OP_FTOI8, 4, 0):      // FSTOI8  dst,src1
 				*inst[0].pint64 = FSPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FFRI4, 4, 0):     // FSFRI4  dst,src1
+			OPCODE_CASE(OP_FFRI4, 4, 0):      // FSFRI4  dst,src1
 				FSPARAM0 = *inst[1].pint32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FFRI8, 4, 0):     // FSFRI8  dst,src1
+			OPCODE_CASE(OP_FFRI8, 4, 0):      // FSFRI8  dst,src1
 				FSPARAM0 = *inst[1].pint64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FFRFD, 4, 0):     // FSFRFD  dst,src1
+			OPCODE_CASE(OP_FFRFD, 4, 0):      // FSFRFD  dst,src1
 				FSPARAM0 = FDPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FADD, 4, 0):      // FSADD   dst,src1,src2
+			OPCODE_CASE(OP_FADD, 4, 0):       // FSADD   dst,src1,src2
 				FSPARAM0 = FSPARAM1 + FSPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FSUB, 4, 0):      // FSSUB   dst,src1,src2
+			OPCODE_CASE(OP_FSUB, 4, 0):       // FSSUB   dst,src1,src2
 				FSPARAM0 = FSPARAM1 - FSPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FCMP, 4, 1):      // FSCMP   src1,src2
+			OPCODE_CASE(OP_FCMP, 4, 1):       // FSCMP   src1,src2
 				if (isnan(FSPARAM0) || isnan(FSPARAM1))
 					flags = FLAG_U;
 				else
 					flags = (FSPARAM0 < FSPARAM1) | ((FSPARAM0 == FSPARAM1) << 2);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FMUL, 4, 0):      // FSMUL   dst,src1,src2
+			OPCODE_CASE(OP_FMUL, 4, 0):       // FSMUL   dst,src1,src2
 				FSPARAM0 = FSPARAM1 * FSPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FDIV, 4, 0):      // FSDIV   dst,src1,src2
+			OPCODE_CASE(OP_FDIV, 4, 0):       // FSDIV   dst,src1,src2
 				FSPARAM0 = FSPARAM1 / FSPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FNEG, 4, 0):      // FSNEG   dst,src1
+			OPCODE_CASE(OP_FNEG, 4, 0):       // FSNEG   dst,src1
 				FSPARAM0 = -FSPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FABS, 4, 0):      // FSABS   dst,src1
+			OPCODE_CASE(OP_FABS, 4, 0):       // FSABS   dst,src1
 				FSPARAM0 = fabs(FSPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FSQRT, 4, 0):     // FSSQRT  dst,src1
+			OPCODE_CASE(OP_FSQRT, 4, 0):      // FSSQRT  dst,src1
 				FSPARAM0 = sqrt(FSPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FRECIP, 4, 0):    // FSRECIP dst,src1
+			OPCODE_CASE(OP_FRECIP, 4, 0):     // FSRECIP dst,src1
 				FSPARAM0 = 1.0f / FSPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FRSQRT, 4, 0):    // FSRSQRT dst,src1
+			OPCODE_CASE(OP_FRSQRT, 4, 0):     // FSRSQRT dst,src1
 				FSPARAM0 = 1.0f / sqrt(FSPARAM1);
-				break;
+				OPCODE_NEXT;
 
 
 			// ----------------------- 64-Bit Floating Point Operations -----------------------
 
-			case MAKE_OPCODE_SHORT(OP_FLOAD, 8, 0):     // FDLOAD  dst,base,index
+			OPCODE_CASE(OP_FLOAD, 8, 0):      // FDLOAD  dst,base,index
 				FDPARAM0 = inst[1].pdouble[PARAM2];
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FSTORE, 8, 0):    // FDSTORE dst,base,index
+			OPCODE_CASE(OP_FSTORE, 8, 0):     // FDSTORE dst,base,index
 				inst[0].pdouble[PARAM1] = FDPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FREAD, 8, 0):     // FDREAD  dst,src1,space
+			OPCODE_CASE(OP_FREAD, 8, 0):      // FDREAD  dst,src1,space
 				DPARAM0 = m_space[PARAM2]->read_qword(PARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FWRITE, 8, 0):    // FDWRITE dst,src1,space
+			OPCODE_CASE(OP_FWRITE, 8, 0):     // FDWRITE dst,src1,space
 				m_space[PARAM2]->write_qword(PARAM0, DPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FMOV, 8, 1):      // FDMOV   dst,src[,c]
+			OPCODE_CASE(OP_FMOV, 8, 1):       // FDMOV   dst,src[,c]
 				if (OPCODE_FAIL_CONDITION(opcode, flags))
-					break;
+					OPCODE_NEXT;
 				// fall through...
 
-			case MAKE_OPCODE_SHORT(OP_FMOV, 8, 0):
+			OPCODE_CASE(OP_FMOV, 8, 0):
 				FDPARAM0 = FDPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI4T, 8, 0):    // FDTOI4T dst,src1
+			OPCODE_CASE(OP_FTOI4T, 8, 0):     // FDTOI4T dst,src1
 				if (FDPARAM1 >= 0)
 					*inst[0].pint32 = floor(FDPARAM1);
 				else
 					*inst[0].pint32 = ceil(FDPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI4R, 8, 0):    // FDTOI4R dst,src1
+			OPCODE_CASE(OP_FTOI4R, 8, 0):     // FDTOI4R dst,src1
 				if (FDPARAM1 >= 0)
 					*inst[0].pint32 = floor(FDPARAM1 + 0.5);
 				else
 					*inst[0].pint32 = ceil(FDPARAM1 - 0.5);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI4F, 8, 0):    // FDTOI4F dst,src1
+			OPCODE_CASE(OP_FTOI4F, 8, 0):     // FDTOI4F dst,src1
 				*inst[0].pint32 = floor(FDPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI4C, 8, 0):    // FDTOI4C dst,src1
+			OPCODE_CASE(OP_FTOI4C, 8, 0):     // FDTOI4C dst,src1
 				*inst[0].pint32 = ceil(FDPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI4, 8, 0):     // FDTOI4  dst,src1
+			OPCODE_CASE(OP_FTOI4, 8, 0):      // FDTOI4  dst,src1
 				*inst[0].pint32 = FDPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI8T, 8, 0):    // FDTOI8T dst,src1
+			OPCODE_CASE(OP_FTOI8T, 8, 0):     // FDTOI8T dst,src1
 				if (FDPARAM1 >= 0)
 					*inst[0].pint64 = floor(FDPARAM1);
 				else
 					*inst[0].pint64 = ceil(FDPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI8R, 8, 0):    // FDTOI8R  dst,src1
+			OPCODE_CASE(OP_FTOI8R, 8, 0):     // FDTOI8R  dst,src1
 				if (FDPARAM1 >= 0)
 					*inst[0].pint64 = floor(FDPARAM1 + 0.5);
 				else
 					*inst[0].pint64 = ceil(FDPARAM1 - 0.5);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI8F, 8, 0):    // FDTOI8F dst,src1
+			OPCODE_CASE(OP_FTOI8F, 8, 0):     // FDTOI8F dst,src1
 				*inst[0].pint64 = floor(FDPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI8C, 8, 0):    // FDTOI8C dst,src1
+			OPCODE_CASE(OP_FTOI8C, 8, 0):     // FDTOI8C dst,src1
 				*inst[0].pint64 = ceil(FDPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FTOI8, 8, 0):     // FDTOI8  dst,src1
+			OPCODE_CASE(OP_FTOI8, 8, 0):      // FDTOI8  dst,src1
 				*inst[0].pint64 = FDPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FFRI4, 8, 0):     // FDFRI4  dst,src1
+			OPCODE_CASE(OP_FFRI4, 8, 0):      // FDFRI4  dst,src1
 				FDPARAM0 = *inst[1].pint32;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FFRI8, 8, 0):     // FDFRI8  dst,src1
+			OPCODE_CASE(OP_FFRI8, 8, 0):      // FDFRI8  dst,src1
 				FDPARAM0 = *inst[1].pint64;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FFRFS, 8, 0):     // FDFRFS  dst,src1
+			OPCODE_CASE(OP_FFRFS, 8, 0):      // FDFRFS  dst,src1
 				FDPARAM0 = FSPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FRNDS, 8, 0):     // FDRNDS  dst,src1
+			OPCODE_CASE(OP_FRNDS, 8, 0):      // FDRNDS  dst,src1
 				FDPARAM0 = (float)FDPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FADD, 8, 0):      // FDADD   dst,src1,src2
+			OPCODE_CASE(OP_FADD, 8, 0):       // FDADD   dst,src1,src2
 				FDPARAM0 = FDPARAM1 + FDPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FSUB, 8, 0):      // FDSUB   dst,src1,src2
+			OPCODE_CASE(OP_FSUB, 8, 0):       // FDSUB   dst,src1,src2
 				FDPARAM0 = FDPARAM1 - FDPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FCMP, 8, 1):      // FDCMP   src1,src2
+			OPCODE_CASE(OP_FCMP, 8, 1):       // FDCMP   src1,src2
 				if (isnan(FDPARAM0) || isnan(FDPARAM1))
 					flags = FLAG_U;
 				else
 					flags = (FDPARAM0 < FDPARAM1) | ((FDPARAM0 == FDPARAM1) << 2);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FMUL, 8, 0):      // FDMUL   dst,src1,src2
+			OPCODE_CASE(OP_FMUL, 8, 0):       // FDMUL   dst,src1,src2
 				FDPARAM0 = FDPARAM1 * FDPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FDIV, 8, 0):      // FDDIV   dst,src1,src2
+			OPCODE_CASE(OP_FDIV, 8, 0):       // FDDIV   dst,src1,src2
 				FDPARAM0 = FDPARAM1 / FDPARAM2;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FNEG, 8, 0):      // FDNEG   dst,src1
+			OPCODE_CASE(OP_FNEG, 8, 0):       // FDNEG   dst,src1
 				FDPARAM0 = -FDPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FABS, 8, 0):      // FDABS   dst,src1
+			OPCODE_CASE(OP_FABS, 8, 0):       // FDABS   dst,src1
 				FDPARAM0 = fabs(FDPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FSQRT, 8, 0):     // FDSQRT  dst,src1
+			OPCODE_CASE(OP_FSQRT, 8, 0):      // FDSQRT  dst,src1
 				FDPARAM0 = sqrt(FDPARAM1);
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FRECIP, 8, 0):    // FDRECIP dst,src1
+			OPCODE_CASE(OP_FRECIP, 8, 0):     // FDRECIP dst,src1
 				FDPARAM0 = 1.0 / FDPARAM1;
-				break;
+				OPCODE_NEXT;
 
-			case MAKE_OPCODE_SHORT(OP_FRSQRT, 8, 0):    // FDRSQRT dst,src1
+			OPCODE_CASE(OP_FRSQRT, 8, 0):     // FDRSQRT dst,src1
 				FDPARAM0 = 1.0 / sqrt(FDPARAM1);
-				break;
+				OPCODE_NEXT;
+
+
+			// ----------------------- Inline Immediate Operations -----------------------
+
+			OPCODE_CASE(OP_MOVi, 4, 0):       // MOV     dst,imm
+				PARAM0 = IPARAM1;
+				OPCODE_NEXT;
+
+			OPCODE_CASE(OP_ADDi, 4, 0):       // ADD     dst,src1,imm
+				PARAM0 = PARAM1 + IPARAM2;
+				OPCODE_NEXT;
+
+			OPCODE_CASE(OP_SUBi, 4, 0):       // SUB     dst,src1,imm
+				PARAM0 = PARAM1 - IPARAM2;
+				OPCODE_NEXT;
+
+			OPCODE_CASE(OP_ANDi, 4, 0):       // AND     dst,src1,imm
+				PARAM0 = PARAM1 & IPARAM2;
+				OPCODE_NEXT;
+
+			OPCODE_CASE(OP_ORi, 4, 0):        // OR      dst,src1,imm
+				PARAM0 = PARAM1 | IPARAM2;
+				OPCODE_NEXT;
+
+			OPCODE_CASE(OP_XORi, 4, 0):       // XOR     dst,src1,imm
+				PARAM0 = PARAM1 ^ IPARAM2;
+				OPCODE_NEXT;
+
+			OPCODE_CASE(OP_SHLi, 4, 0):       // SHL     dst,src,imm
+				PARAM0 = PARAM1 << (IPARAM2 & 31);
+				OPCODE_NEXT;
+
+			OPCODE_CASE(OP_SHRi, 4, 0):       // SHR     dst,src,imm
+				PARAM0 = PARAM1 >> (IPARAM2 & 31);
+				OPCODE_NEXT;
+
+			OPCODE_CASE(OP_SARi, 4, 0):       // SAR     dst,src,imm
+				PARAM0 = (INT32)PARAM1 >> (IPARAM2 & 31);
+				OPCODE_NEXT;
+
+			OPCODE_CASE(OP_CMPi, 4, 1):       // CMP     src1,imm,f
+				temp32 = PARAM0 - IPARAM1;
+				flags = FLAGS32_NZCV_SUB(temp32, PARAM0, IPARAM1);
+				OPCODE_NEXT;
+
+			OPCODE_CASE(OP_TESTi, 4, 1):      // TEST    src1,imm,f
+				temp32 = PARAM0 & IPARAM1;
+				flags = FLAGS32_NZ(temp32);
+				OPCODE_NEXT;
 
 			default:
+#if USE_THREADED_DISPATCH
+			unexpected_opcode:
+#endif
 				fatalerror("Unexpected opcode!\n");
 		}
 
@@ -2084,6 +2341,24 @@ int drcbe_c::execute(code_handle &entry)
 }
 
 
+//-------------------------------------------------
+//  output_opcode - output an opcode, preceded by
+//  its handler address when threading
+//-------------------------------------------------
+
+void drcbe_c::output_opcode(drcbec_instruction **dstptr, UINT32 opcode)
+{
+	drcbec_instruction *dst = *dstptr;
+
+#if USE_THREADED_DISPATCH
+	(dst++)->v = s_handler_table[OPCODE_GET_SHORT(opcode)];
+#endif
+	(dst++)->i = opcode;
+
+	*dstptr = dst;
+}
+
+
 //-------------------------------------------------
 //  output_parameter - output a parameter
 //-------------------------------------------------
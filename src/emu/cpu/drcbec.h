@@ -40,6 +40,8 @@ public:
 
 private:
 	// helpers
+	int execute_code(const drcbec_instruction *inst);
+	void output_opcode(drcbec_instruction **dstptr, UINT32 opcode);
 	void output_parameter(drcbec_instruction **dstptr, void **immedptr, int size, const uml::parameter &param);
 	void fixup_label(void *parameter, drccodeptr labelcodeptr);
 	int dmulu(UINT64 &dstlo, UINT64 &dsthi, UINT64 src1, UINT64 src2, int flags);
@@ -53,6 +55,7 @@ private:
 
 	static const UINT32     s_condition_map[32];
 	static UINT64           s_immediate_zero;
+	static void *           s_handler_table[0x1000];    // threaded handler for each short opcode
 };
 
 
@@ -57,6 +57,7 @@ void h8_device::device_start()
 {
 	program = &space(AS_PROGRAM);
 	direct = &program->direct();
+	decode_cache.set_direct(direct);
 	io      = &space(AS_IO);
 
 	state_add(STATE_GENPC,     "GENPC",     NPC).noshow();
@@ -189,7 +190,7 @@ void h8_device::execute_run()
 				if(machine().debug_flags & DEBUG_FLAG_ENABLED)
 					debugger_instruction_hook(this, NPC);
 			}
-			do_exec_full();
+			exec_full();
 		}
 		while(bcount && icount && icount <= bcount)
 			internal_update(total_cycles() + icount - bcount);
@@ -198,6 +199,27 @@ void h8_device::execute_run()
 	}
 }
 
+// Multi-word opcodes are decoded one dispatch step at a time, and the
+// space of (step, word) pairs is far too large for a flat table.  The
+// handler each step resolves to is remembered by PC instead, tagged with
+// the state it was resolved from, so a hit skips the nested switches.
+void h8_device::exec_full()
+{
+	const handler *cached = decode_cache.find(PC, inst_state);
+	if(cached) {
+		(this->*(*cached))();
+		return;
+	}
+
+	handler h = do_decode_full();
+	if(!h) {
+		do_exec_full();
+		return;
+	}
+	decode_cache.store(PC, inst_state, h);
+	(this->*h)();
+}
+
 void h8_device::add_event(UINT64 &event_time, UINT64 new_event)
 {
 	if(!new_event)
@@ -40,6 +40,8 @@
 #ifndef __H8_H__
 #define __H8_H__
 
+#include "cpu/pdcache.h"
+
 class h8_device : public cpu_device {
 public:
 	enum {
@@ -222,8 +224,15 @@ protected:
 	offs_t disassemble_generic(char *buffer, offs_t pc, const UINT8 *oprom, const UINT8 *opram, UINT32 options, const disasm_entry *table);
 	void disassemble_am(char *&buffer, int am, offs_t pc, const UINT8 *oprom, UINT32 opcode, int offset);
 
+	typedef void (h8_device::*handler)();
+
+	// full handlers already resolved for the opcode words found at a given PC
+	predecode_cache<handler> decode_cache;
+
 	virtual void do_exec_full();
 	virtual void do_exec_partial();
+	virtual handler do_decode_full();
+	void exec_full();
 	static void add_event(UINT64 &event_time, UINT64 new_event);
 	virtual bool exr_in_stack() const;
 	virtual void update_irq_filter() = 0;
@@ -55,6 +55,7 @@ protected:
 
 	virtual void do_exec_full();
 	virtual void do_exec_partial();
+	virtual handler do_decode_full();
 
 	inline void r32_w(int reg, UINT32 val) { R[reg & 7] = val; R[(reg & 7) | 8] = val >> 16; }
 	inline UINT32 r32_r(int reg) const { return R[reg & 7] | (R[(reg & 7) | 8] << 16); }
@@ -368,12 +368,31 @@ class OpcodeList:
             save_partial_one(f, t, "dispatch_" + dsp.name, dsp.source())
     
     def save_exec(self, f, t, dtype, v):
-        print >>f, "void %s::do_exec_%s()" % (t, v)
+        # the "decode" variant returns the full handler instead of calling it
+        def call(name):
+            if v == "decode":
+                return "return static_cast<h8_device::handler>(&%s::%s_full);" % (t, name)
+            return "%s_%s();" % (name, v)
+        def case_call(name):
+            if v == "decode":
+                return call(name)
+            return call(name) + " break;"
+        if v == "decode":
+            illegal = "return static_cast<h8_device::handler>(&%s::illegal);" % t
+            print >>f, "h8_device::handler %s::do_decode_full()" % t
+        else:
+            illegal = "illegal(); break;"
+            print >>f, "void %s::do_exec_%s()" % (t, v)
         print >>f, "{"
         print >>f, "\tswitch(inst_state >> 16) {"
         for i in range(0, len(self.dispatch_info)+2):
             if i == 1:
                 print >>f, "\tcase 0x01: {"
+                if v == "decode":
+                    # special states are not instructions, they are never cached
+                    print >>f, "\t\treturn NULL;"
+                    print >>f, "\t}"
+                    continue
                 print >>f, "\t\tswitch(inst_state & 0xffff) {"
                 for sta in self.states_info:
                     if sta.enabled:
@@ -400,9 +419,9 @@ class OpcodeList:
                             if h2.mask == 0x00:
                                 n = h2.d[0]
                                 if n.is_dispatch():
-                                    print >>f, "\t\t\tdispatch_%s_%s();" % (n.name, v)
+                                    print >>f, "\t\t\t%s" % call("dispatch_" + n.name)
                                 else:
-                                    print >>f, "\t\t\t%s_%s();" % (n.function_name(), v)
+                                    print >>f, "\t\t\t%s" % call(n.function_name())
                                 print >>f, "\t\t\tbreak;"
                             else:
                                 print >>f, "\t\t\tswitch(inst_state & 0x%02x) {" % h2.mask
@@ -425,18 +444,20 @@ class OpcodeList:
                                             while(s & fmask):
                                                 s = s + (s & fmask)
                                         if n.is_dispatch():
-                                            print >>f, "\t\t\t%sdispatch_%s_%s(); break;" % (c, n.name, v)
+                                            print >>f, "\t\t\t%s%s" % (c, case_call("dispatch_" + n.name))
                                         else:
-                                            print >>f, "\t\t\t%s%s_%s(); break;" % (c, n.function_name(), v)
-                                print >>f, "\t\t\tdefault: illegal(); break;"
+                                            print >>f, "\t\t\t%s%s" % (c, case_call(n.function_name()))
+                                print >>f, "\t\t\tdefault: %s" % illegal
                                 print >>f, "\t\t\t}"
                                 print >>f, "\t\t\tbreak;"
                             print >>f, "\t\t}"
-                    print >>f, "\t\tdefault: illegal(); break;"
+                    print >>f, "\t\tdefault: %s" % illegal
                     print >>f, "\t\t}"
                     print >>f, "\t\tbreak;"
                     print >>f, "\t}"
         print >>f, "\t}"
+        if v == "decode":
+            print >>f, "\treturn NULL;"
         print >>f, "}"
 
 def main(argv):
@@ -461,6 +482,7 @@ def main(argv):
         opcodes.save_dispatch(f, dname)
     opcodes.save_exec(f, dname, dtype, "full")
     opcodes.save_exec(f, dname, dtype, "partial")
+    opcodes.save_exec(f, dname, dtype, "decode")
     f.close()
 
 # ======================================================================
@@ -56,6 +56,7 @@ protected:
 
 	virtual void do_exec_full();
 	virtual void do_exec_partial();
+	virtual handler do_decode_full();
 
 #define O(o) void o ## _full(); void o ## _partial()
 	O(ldc_imm8_exr); O(ldc_r8l_exr); O(ldc_w_abs16_exr); O(ldc_w_abs32_exr); O(ldc_w_r32d16h_exr); O(ldc_w_r32d32hh_exr); O(ldc_w_r32ih_exr); O(ldc_w_r32ph_exr);
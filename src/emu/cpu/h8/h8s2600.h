@@ -55,6 +55,7 @@ protected:
 
 	virtual void do_exec_full();
 	virtual void do_exec_partial();
+	virtual handler do_decode_full();
 
 #define O(o) void o ## _full(); void o ## _partial()
 	O(clrmac);
@@ -0,0 +1,109 @@
+/***************************************************************************
+
+    pdcache.h
+
+    Predecoded instruction cache for interpreted CPU cores.
+
+    Copyright Nicola Salmoria and the MAME Team.
+    Visit http://mamedev.org for licensing and usage restrictions.
+
+****************************************************************************
+
+    Concepts:
+
+    Interpreting cores normally re-run their opcode decoder every time an
+    instruction is executed, even when they spin in a tight loop over the
+    same handful of addresses. A predecode_cache lets a core remember the
+    result of decoding (an arbitrary _Entry: a handler pointer, an
+    instruction descriptor, operand selectors...) keyed by the PC it was
+    found at.
+
+    Every entry is tagged with the opcode bits it was decoded from, and a
+    lookup only hits if the core presents the same bits again; cores must
+    therefore include every fetched value that influences the decoded
+    entry in the tag. This makes the cache immune to self-modifying code
+    and bank switching without needing to observe every write.
+
+    When attached to a direct_read_data, the whole cache is also dropped
+    whenever the direct ranges of that space are remapped (memory map
+    changes, bank switches).
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __PDCACHE_H__
+#define __PDCACHE_H__
+
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> predecode_cache
+
+template<class _Entry, int _Bits = 10>
+class predecode_cache
+{
+public:
+	// construction/destruction
+	predecode_cache(direct_read_data *direct = NULL)
+		: m_direct(direct),
+			m_generation((direct != NULL) ? direct->generation() : 0) { flush(); }
+
+	// configuration
+	void set_direct(direct_read_data *direct) { m_direct = direct; flush(); }
+
+	// find the entry decoded at the given PC from the given opcode bits, or NULL
+	const _Entry *find(offs_t pc, UINT32 opcode)
+	{
+		if (m_direct != NULL && UNEXPECTED(m_direct->generation() != m_generation))
+			flush();
+
+		const cache_slot &slot = m_slot[slot_index(pc)];
+		if (EXPECTED(slot.m_valid && slot.m_pc == pc && slot.m_opcode == opcode))
+			return &slot.m_entry;
+		return NULL;
+	}
+
+	// remember the entry decoded at the given PC from the given opcode bits
+	void store(offs_t pc, UINT32 opcode, const _Entry &entry)
+	{
+		cache_slot &slot = m_slot[slot_index(pc)];
+		slot.m_valid = true;
+		slot.m_pc = pc;
+		slot.m_opcode = opcode;
+		slot.m_entry = entry;
+	}
+
+	// forget everything
+	void flush()
+	{
+		for (int slotnum = 0; slotnum < ARRAY_LENGTH(m_slot); slotnum++)
+			m_slot[slotnum].m_valid = false;
+		if (m_direct != NULL)
+			m_generation = m_direct->generation();
+	}
+
+private:
+	// a single direct-mapped slot
+	struct cache_slot
+	{
+		bool                m_valid;                // is this slot in use?
+		offs_t              m_pc;                   // PC the entry was decoded at
+		UINT32              m_opcode;               // opcode bits the entry was decoded from
+		_Entry              m_entry;                // decoded entry
+	};
+
+	// internal helpers
+	static int slot_index(offs_t pc) { return (pc ^ (pc >> _Bits)) & ((1 << _Bits) - 1); }
+
+	// internal state
+	direct_read_data *      m_direct;               // direct access data whose remapping flushes us
+	UINT32                  m_generation;           // mapping generation our entries belong to
+	cache_slot              m_slot[1 << _Bits];     // the slots themselves
+};
+
+
+#endif /* __PDCACHE_H__ */
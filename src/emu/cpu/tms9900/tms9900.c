@@ -1109,6 +1109,42 @@ void tms99xx_device::build_command_lookup_table()
 
 	m_lotables[k++] = NULL;
 	if (TRACE_SETUP) logerror("tms99xx: Allocated %d tables\n", k);
+
+	build_decode_table();
+}
+
+/*
+    The lookup tables only depend on the opcode word, so we resolve every
+    possible word once and keep the result in a flat table shared by all
+    instances; decoding is then a single indexed load.
+*/
+const tms99xx_device::tms_instruction *tms99xx_device::s_decode_table[0x10000];
+bool tms99xx_device::s_decode_table_built = false;
+
+void tms99xx_device::build_decode_table()
+{
+	if (s_decode_table_built) return;
+
+	for (int inst = 0; inst < 0x10000; inst++)
+	{
+		int index = 0;
+		lookup_entry* table = m_command_lookup_table;
+		UINT16 opcode = inst;
+		bool complete = false;
+
+		while (!complete)
+		{
+			index = (opcode >> 12) & 0x000f;
+			if (table[index].next_digit != NULL)
+			{
+				table = table[index].next_digit;
+				opcode = opcode << 4;
+			}
+			else complete = true;
+		}
+		s_decode_table[inst] = table[index].entry;
+	}
+	s_decode_table_built = true;
 }
 
 /*
@@ -1402,29 +1438,13 @@ inline void tms99xx_device::set_wait_state(bool state)
 */
 void tms99xx_device::decode(UINT16 inst)
 {
-	int index = 0;
-	lookup_entry* table = m_command_lookup_table;
-	UINT16 opcode = inst;
-	bool complete = false;
-	const tms_instruction *decoded;
+	const tms_instruction *decoded = s_decode_table[inst];
 
 	m_state = 0;
 	IR = inst;
 	m_get_destination = false;
 	m_byteop = false;
 
-	while (!complete)
-	{
-		index = (opcode >> 12) & 0x000f;
-		if (TRACE_MICRO) logerror("tms99xx: Check next hex digit of instruction %x\n", index);
-		if (table[index].next_digit != NULL)
-		{
-			table = table[index].next_digit;
-			opcode = opcode << 4;
-		}
-		else complete = true;
-	}
-	decoded = table[index].entry;
 	if (decoded == NULL)
 	{
 		// not found
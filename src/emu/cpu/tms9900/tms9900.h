@@ -235,6 +235,7 @@ private:
 
 	// Set up lookup table
 	void build_command_lookup_table();
+	void build_decode_table();
 
 	// Sequence of micro-operations
 	typedef const UINT8* microprogram;
@@ -270,6 +271,10 @@ private:
 	// Opcode table
 	static const tms99xx_device::tms_instruction s_command[];
 
+	// Lookup results for every opcode word, filled in once
+	static const tms_instruction *s_decode_table[0x10000];
+	static bool s_decode_table_built;
+
 	// Micro-operation declarations
 	void    register_read(void);
 	void    register_write(void);
@@ -18,6 +18,7 @@
 ***************************************************************************/
 
 #define PRINTF_TLB          (0)
+#define PRINTF_STATS        (0)
 
 
 
@@ -38,10 +39,80 @@ struct vtlb_state
 	dynamic_array<offs_t> live;             /* array of live entries by table index */
 	dynamic_array<int> fixedpages;          /* number of pages each fixed entry covers */
 	dynamic_array<vtlb_entry> table;        /* table of entries by address */
+	int                 victims;            /* number of victim cache entries */
+	dynamic_array<offs_t> victimaddr;       /* table index + 1 of each victim entry */
+	dynamic_array<vtlb_entry> victimentry;  /* table entry saved for each victim */
+	vtlb_stats          stats;              /* usage counters */
 };
 
 
 
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    victim_slot - return the victim cache slot
+    a table index maps to
+-------------------------------------------------*/
+
+INLINE int victim_slot(vtlb_state *vtlb, offs_t tableindex)
+{
+	return (tableindex ^ (tableindex >> VTLB_VICTIM_SHIFT)) & (vtlb->victims - 1);
+}
+
+
+/*-------------------------------------------------
+    evict_dynamic - release a dynamic entry from
+    the table, remembering it in the victim cache
+-------------------------------------------------*/
+
+INLINE void evict_dynamic(vtlb_state *vtlb, int liveindex)
+{
+	offs_t tableindex = vtlb->live[liveindex] - 1;
+	vtlb_entry entry = vtlb->table[tableindex];
+
+	/* only dynamic entries that are still valid are worth remembering */
+	if (vtlb->victims != 0 && (entry & (VTLB_FLAG_VALID | VTLB_FLAG_FIXED)) == VTLB_FLAG_VALID)
+	{
+		int victimindex = victim_slot(vtlb, tableindex);
+		vtlb->victimaddr[victimindex] = tableindex + 1;
+		vtlb->victimentry[victimindex] = entry;
+	}
+
+	vtlb->table[tableindex] = 0;
+	vtlb->stats.evictions++;
+}
+
+
+/*-------------------------------------------------
+    find_victim - look for a table index in the
+    victim cache; returns the victim index or -1
+-------------------------------------------------*/
+
+INLINE int find_victim(vtlb_state *vtlb, offs_t tableindex)
+{
+	if (vtlb->victims == 0)
+		return -1;
+	int victimindex = victim_slot(vtlb, tableindex);
+	return (vtlb->victimaddr[victimindex] == tableindex + 1) ? victimindex : -1;
+}
+
+
+/*-------------------------------------------------
+    forget_victim - drop any victim cache entry
+    for a table index that is being remapped
+-------------------------------------------------*/
+
+INLINE void forget_victim(vtlb_state *vtlb, offs_t tableindex)
+{
+	int victimindex = find_victim(vtlb, tableindex);
+	if (victimindex != -1)
+		vtlb->victimaddr[victimindex] = 0;
+}
+
+
+
 /***************************************************************************
     INITIALIZATION/TEARDOWN
 ***************************************************************************/
@@ -80,6 +151,16 @@ vtlb_state *vtlb_alloc(device_t *cpu, address_spacenum space, int fixed_entries,
 	vtlb->table.resize_and_clear((size_t) 1 << (vtlb->addrwidth - vtlb->pageshift));
 	cpu->save_item(NAME(vtlb->table));
 
+	/* allocate the victim cache; only dynamic entries ever land there */
+	if (dynamic_entries > 0)
+	{
+		vtlb->victims = VTLB_VICTIM_ENTRIES;
+		vtlb->victimaddr.resize_and_clear(vtlb->victims);
+		vtlb->victimentry.resize_and_clear(vtlb->victims);
+		cpu->save_item(NAME(vtlb->victimaddr));
+		cpu->save_item(NAME(vtlb->victimentry));
+	}
+
 	/* allocate the fixed page count array */
 	if (fixed_entries > 0)
 	{
@@ -96,6 +177,12 @@ vtlb_state *vtlb_alloc(device_t *cpu, address_spacenum space, int fixed_entries,
 
 void vtlb_free(vtlb_state *vtlb)
 {
+	if (PRINTF_STATS)
+		printf("vtlb '%s': %d fills (%d victim hits, %d translations, %d failures), %d evictions, %d/%d loads, %d/%d flushes\n",
+				vtlb->cpudevice->tag(), (int)vtlb->stats.fills, (int)vtlb->stats.victim_hits, (int)vtlb->stats.translations,
+				(int)vtlb->stats.failures, (int)vtlb->stats.evictions, (int)vtlb->stats.fixed_loads, (int)vtlb->stats.dynamic_loads,
+				(int)vtlb->stats.dynamic_flushes, (int)vtlb->stats.address_flushes);
+
 	/* free the fixed pages if allocated */
 	if (vtlb->fixedpages != NULL)
 		auto_free(vtlb->cpudevice->machine(), vtlb->fixedpages);
@@ -129,6 +216,7 @@ int vtlb_fill(vtlb_state *vtlb, offs_t address, int intention)
 
 	if (PRINTF_TLB)
 		printf("vtlb_fill: %08X(%X) ... ", address, intention);
+	vtlb->stats.fills++;
 
 	/* should not be called here if the entry is in the table already */
 //  assert((entry & (1 << intention)) == 0);
@@ -138,15 +226,41 @@ int vtlb_fill(vtlb_state *vtlb, offs_t address, int intention)
 	{
 		if (PRINTF_TLB)
 			printf("failed: no dynamic entries\n");
+		vtlb->stats.failures++;
 		return FALSE;
 	}
 
+	/* if we evicted this page recently with the right intention, bring it back without translating */
+	if ((entry & VTLB_FLAGS_MASK) == 0)
+	{
+		int victimindex = find_victim(vtlb, tableindex);
+		if (victimindex != -1 && (vtlb->victimentry[victimindex] & (1 << (intention & (TRANSLATE_TYPE_MASK | TRANSLATE_USER_MASK)))) != 0)
+		{
+			int liveindex = vtlb->dynindex++ % vtlb->dynamic;
+
+			/* swap places with whatever occupies the next dynamic slot */
+			entry = vtlb->victimentry[victimindex];
+			vtlb->victimaddr[victimindex] = 0;
+			if (vtlb->live[liveindex] != 0)
+				evict_dynamic(vtlb, liveindex);
+			vtlb->live[liveindex] = tableindex + 1;
+			vtlb->table[tableindex] = entry;
+			vtlb->stats.victim_hits++;
+
+			if (PRINTF_TLB)
+				printf("success (%08X), victim entry\n", entry & ~VTLB_FLAGS_MASK);
+			return TRUE;
+		}
+	}
+
 	/* ask the CPU core to translate for us */
 	taddress = address;
+	vtlb->stats.translations++;
 	if (!vtlb->cpudevice->translate(vtlb->space, intention, taddress))
 	{
 		if (PRINTF_TLB)
 			printf("failed: no translation\n");
+		vtlb->stats.failures++;
 		return FALSE;
 	}
 
@@ -157,14 +271,21 @@ int vtlb_fill(vtlb_state *vtlb, offs_t address, int intention)
 
 		/* if an entry already exists at this index, free it */
 		if (vtlb->live[liveindex] != 0)
-			vtlb->table[vtlb->live[liveindex] - 1] = 0;
+			evict_dynamic(vtlb, liveindex);
 
 		/* claim this new entry */
 		vtlb->live[liveindex] = tableindex + 1;
 
-		/* form a new blank entry */
+		/* form a new blank entry, carrying over any intentions we remembered for the page */
 		entry = (taddress >> vtlb->pageshift) << vtlb->pageshift;
 		entry |= VTLB_FLAG_VALID;
+		int victimindex = find_victim(vtlb, tableindex);
+		if (victimindex != -1)
+		{
+			if ((vtlb->victimentry[victimindex] >> vtlb->pageshift) == (entry >> vtlb->pageshift))
+				entry |= vtlb->victimentry[victimindex] & VTLB_FLAGS_MASK;
+			vtlb->victimaddr[victimindex] = 0;
+		}
 
 		if (PRINTF_TLB)
 			printf("success (%08X), new entry\n", taddress);
@@ -199,6 +320,7 @@ void vtlb_load(vtlb_state *vtlb, int entrynum, int numpages, offs_t address, vtl
 
 	/* must be in range */
 	assert(entrynum >= 0 && entrynum < vtlb->fixed);
+	vtlb->stats.fixed_loads++;
 
 	if (PRINTF_TLB)
 		printf("vtlb_load %d for %d pages at %08X == %08X\n", entrynum, numpages, address, value);
@@ -212,6 +334,10 @@ void vtlb_load(vtlb_state *vtlb, int entrynum, int numpages, offs_t address, vtl
 			vtlb->table[oldtableindex + pagenum] = 0;
 	}
 
+	/* stale dynamic mappings for these pages must not come back once this entry is replaced */
+	for (pagenum = 0; pagenum < numpages; pagenum++)
+		forget_victim(vtlb, tableindex + pagenum);
+
 	/* claim this new entry */
 	vtlb->live[liveindex] = tableindex + 1;
 
@@ -236,6 +362,7 @@ void vtlb_dynload(vtlb_state *vtlb, UINT32 index, offs_t address, vtlb_entry val
 			printf("failed: no dynamic entries\n");
 		return;
 	}
+	vtlb->stats.dynamic_loads++;
 
 	int liveindex = vtlb->dynindex++ % vtlb->dynamic;
 	/* is entry already live? */
@@ -243,11 +370,17 @@ void vtlb_dynload(vtlb_state *vtlb, UINT32 index, offs_t address, vtlb_entry val
 	{
 		/* if an entry already exists at this index, free it */
 		if (vtlb->live[liveindex] != 0)
+		{
 			vtlb->table[vtlb->live[liveindex] - 1] = 0;
+			vtlb->stats.evictions++;
+		}
 
 		/* claim this new entry */
 		vtlb->live[liveindex] = index + 1;
 	}
+	/* the new mapping supersedes anything remembered for this page */
+	forget_victim(vtlb, index);
+
 	/* form a new blank entry */
 	entry = (address >> vtlb->pageshift) << vtlb->pageshift;
 	entry |= VTLB_FLAG_VALID | value;
@@ -273,6 +406,7 @@ void vtlb_flush_dynamic(vtlb_state *vtlb)
 
 	if (PRINTF_TLB)
 		printf("vtlb_flush_dynamic\n");
+	vtlb->stats.dynamic_flushes++;
 
 	/* loop over live entries and release them from the table */
 	for (liveindex = 0; liveindex < vtlb->dynamic; liveindex++)
@@ -282,6 +416,10 @@ void vtlb_flush_dynamic(vtlb_state *vtlb)
 			vtlb->table[tableindex] = 0;
 			vtlb->live[liveindex] = 0;
 		}
+
+	/* forget everything in the victim cache as well */
+	for (int victimindex = 0; victimindex < vtlb->victims; victimindex++)
+		vtlb->victimaddr[victimindex] = 0;
 }
 
 
@@ -296,9 +434,13 @@ void vtlb_flush_address(vtlb_state *vtlb, offs_t address)
 
 	if (PRINTF_TLB)
 		printf("vtlb_flush_address %08X\n", address);
+	vtlb->stats.address_flushes++;
 
 	/* free the entry in the table; for speed, we leave the entry in the live array */
 	vtlb->table[tableindex] = 0;
+
+	/* make sure it doesn't come back from the victim cache */
+	forget_victim(vtlb, tableindex);
 }
 
 
@@ -316,3 +458,14 @@ const vtlb_entry *vtlb_table(vtlb_state *vtlb)
 {
 	return vtlb->table;
 }
+
+
+/*-------------------------------------------------
+    vtlb_get_stats - return the usage counters
+    accumulated so far
+-------------------------------------------------*/
+
+const vtlb_stats *vtlb_get_stats(vtlb_state *vtlb)
+{
+	return &vtlb->stats;
+}
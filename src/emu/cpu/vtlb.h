@@ -30,6 +30,9 @@
 #define VTLB_USER_FETCH_ALLOWED     0x40        /* (1 << TRANSLATE_FETCH_USER) */
 #define VTLB_FLAG_FIXED             0x80
 
+#define VTLB_VICTIM_SHIFT           5
+#define VTLB_VICTIM_ENTRIES         (1 << VTLB_VICTIM_SHIFT)    /* entries remembered after eviction from the dynamic ring */
+
 
 
 /***************************************************************************
@@ -44,6 +47,21 @@ typedef UINT32 vtlb_entry;
 struct vtlb_state;
 
 
+/* counters describing how the VTLB has been used */
+struct vtlb_stats
+{
+	UINT64              fills;              /* calls to vtlb_fill (misses in the lookup table) */
+	UINT64              victim_hits;        /* fills satisfied from the victim cache */
+	UINT64              translations;       /* fills that required a CPU translation */
+	UINT64              failures;           /* fills that could not be translated */
+	UINT64              evictions;          /* dynamic entries displaced from the lookup table */
+	UINT64              fixed_loads;        /* calls to vtlb_load */
+	UINT64              dynamic_loads;      /* calls to vtlb_dynload */
+	UINT64              dynamic_flushes;    /* calls to vtlb_flush_dynamic */
+	UINT64              address_flushes;    /* calls to vtlb_flush_address */
+};
+
+
 
 /***************************************************************************
     FUNCTION PROTOTYPES
@@ -84,5 +102,8 @@ void vtlb_flush_address(vtlb_state *vtlb, offs_t address);
 /* return a pointer to the base of the linear VTLB lookup table */
 const vtlb_entry *vtlb_table(vtlb_state *vtlb);
 
+/* return the usage counters accumulated so far */
+const vtlb_stats *vtlb_get_stats(vtlb_state *vtlb);
+
 
 #endif /* __VTLB_H__ */
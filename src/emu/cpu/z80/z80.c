@@ -431,6 +431,8 @@ inline void z80_device::leave_halt()
  ***************************************************************/
 inline UINT8 z80_device::in(UINT16 port)
 {
+	// port reads can change from one iteration to the next, so never idle
+	idle_loop_side_effect();
 	return m_io->read_byte(port);
 }
 
@@ -439,6 +441,7 @@ inline UINT8 z80_device::in(UINT16 port)
  ***************************************************************/
 inline void z80_device::out(UINT16 port, UINT8 value)
 {
+	idle_loop_side_effect();
 	m_io->write_byte(port, value);
 }
 
@@ -447,7 +450,9 @@ inline void z80_device::out(UINT16 port, UINT8 value)
  ***************************************************************/
 inline UINT8 z80_device::rm(UINT16 addr)
 {
-	return m_program->read_byte(addr);
+	UINT8 data = m_program->read_byte(addr);
+	idle_loop_read(*m_program, addr, data);
+	return data;
 }
 
 /***************************************************************
@@ -464,6 +469,7 @@ inline void z80_device::rm16(UINT16 addr, PAIR &r)
  ***************************************************************/
 inline void z80_device::wm(UINT16 addr, UINT8 value)
 {
+	idle_loop_side_effect();
 	m_program->write_byte(addr, value);
 }
 
@@ -549,6 +555,7 @@ inline void z80_device::jp(void)
 {
 	PCD = arg16();
 	WZ = PCD;
+	idle_loop_branch(PRVPC, PCD);
 }
 
 /***************************************************************
@@ -560,6 +567,7 @@ inline void z80_device::jp_cond(bool cond)
 	{
 		PCD = arg16();
 		WZ = PCD;
+		idle_loop_branch(PRVPC, PCD);
 	}
 	else
 	{
@@ -575,6 +583,7 @@ inline void z80_device::jr()
 	INT8 a = (INT8)arg();    /* arg() also increments PC */
 	PC += a;             /* so don't do PC += arg() */
 	WZ = PC;
+	idle_loop_branch(PRVPC, PCD);
 }
 
 /***************************************************************
@@ -3422,7 +3431,7 @@ void z80_device::device_start()
 	state_add(Z80_DE2,         "DE2",       m_de2.w.l);
 	state_add(Z80_HL2,         "HL2",       m_hl2.w.l);
 	state_add(Z80_WZ,          "WZ",        WZ);
-	state_add(Z80_R,           "R",         m_rtemp).callimport().callexport();
+	state_add(Z80_R,           "R",         m_rtemp).callimport().callexport().free_running();
 	state_add(Z80_I,           "I",         m_i);
 	state_add(Z80_IM,          "IM",        m_im).mask(0x3);
 	state_add(Z80_IFF1,        "IFF1",      m_iff1).mask(0x1);
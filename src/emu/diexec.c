@@ -31,6 +31,10 @@
 const int TRIGGER_INT           = -2000;
 const int TRIGGER_SUSPENDTIME   = -4000;
 
+const offs_t IDLE_LOOP_MAX_LENGTH   = 32;       // longest backwards branch considered a loop
+const int IDLE_LOOP_MATCHES         = 3;        // identical iterations needed to call a loop idle
+const int IDLE_LOOP_MAX_BACKOFF     = 1024;     // most branches ignored after a failed candidate
+
 
 
 //**************************************************************************
@@ -47,6 +51,7 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 		m_vblank_interrupt_screen(NULL),
 		m_timed_interrupt_period(attotime::zero),
 		m_is_octal(false),
+		m_no_idle_detect(false),
 		m_nextexec(NULL),
 		m_timedint_timer(NULL),
 		m_profiler(PROFILER_IDLE),
@@ -63,7 +68,15 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 		m_divisor(0),
 		m_divshift(0),
 		m_cycles_per_second(0),
-		m_attoseconds_per_cycle(0)
+		m_attoseconds_per_cycle(0),
+		m_idle_detect(false),
+		m_idle_dirty(false),
+		m_idle_target(~0),
+		m_idle_signature(0),
+		m_idle_reads(0),
+		m_idle_matches(0),
+		m_idle_backoff(0),
+		m_idle_skip(0)
 {
 	memset(&m_localtime, 0, sizeof(m_localtime));
 
@@ -95,6 +108,21 @@ void device_execute_interface::static_set_disable(device_t &device)
 }
 
 
+//-------------------------------------------------
+//  static_set_no_idle_detect - configuration
+//  helper to keep idle loop detection away from
+//  a device whose loops only look idle
+//-------------------------------------------------
+
+void device_execute_interface::static_set_no_idle_detect(device_t &device)
+{
+	device_execute_interface *exec;
+	if (!device.interface(exec))
+		throw emu_fatalerror("MCFG_DEVICE_NO_IDLE_DETECT called on device '%s' with no execute interface", device.tag());
+	exec->m_no_idle_detect = true;
+}
+
+
 //-------------------------------------------------
 //  static_set_vblank_int - configuration helper
 //  to set up VBLANK interrupts on the device
@@ -486,6 +514,11 @@ void device_execute_interface::interface_pre_start()
 	// allocate timers if we need them
 	if (m_timed_interrupt_period != attotime::zero)
 		m_timedint_timer = m_scheduler->timer_alloc(FUNC(static_trigger_periodic_interrupt), (void *)this);
+
+	// idle loop detection needs the exposed state, and is never used under the debugger
+	device_state_interface *state;
+	m_idle_detect = device().machine().options().idle_detect() && !m_no_idle_detect && device().interface(state) &&
+			(device().machine().debug_flags & DEBUG_FLAG_ENABLED) == 0;
 }
 
 
@@ -524,6 +557,12 @@ void device_execute_interface::interface_pre_reset()
 	// reset the total number of cycles
 	m_totalcycles = 0;
 
+	// forget about any loop we were watching
+	m_idle_target = ~0;
+	m_idle_reads = 0;
+	m_idle_skip = 0;
+	m_idle_backoff = 0;
+
 	// enable all devices (except for disabled devices)
 	if (!disabled())
 		resume(SUSPEND_ANY_REASON);
@@ -622,6 +661,9 @@ int device_execute_interface::standard_irq_callback(int irqline)
 	if (!m_driver_irq.isnull())
 		vector = m_driver_irq(device(),irqline);
 
+	// taking an interrupt breaks any idle loop we were watching
+	m_idle_dirty = true;
+
 	// notify the debugger
 	debugger_interrupt_hook(&device(), irqline);
 	return vector;
@@ -649,6 +691,126 @@ attoseconds_t device_execute_interface::minimum_quantum() const
 }
 
 
+//-------------------------------------------------
+//  idle_loop_check - called by cores on taken
+//  branches; if we keep branching back to the
+//  same short loop without side effects and
+//  without any change to our state, nothing can
+//  happen until another device or an interrupt
+//  intervenes, so skip to the end of the timeslice
+//-------------------------------------------------
+
+void device_execute_interface::idle_loop_check(offs_t pc, offs_t target)
+{
+	// only short backwards branches are candidates
+	if (target > pc || pc - target > IDLE_LOOP_MAX_LENGTH)
+		return;
+
+	// each iteration starts a fresh record of the reads it makes
+	UINT64 reads = m_idle_reads;
+	m_idle_reads = 0;
+
+	// leave things alone for a while after a loop turned out not to be idle
+	if (m_idle_skip > 0)
+	{
+		m_idle_skip--;
+		return;
+	}
+
+	// a loop with side effects is not idle; back off before looking again
+	if (target == m_idle_target && m_idle_dirty)
+	{
+		m_idle_skip = m_idle_backoff;
+		m_idle_backoff = MIN(m_idle_backoff * 2 + 1, IDLE_LOOP_MAX_BACKOFF);
+		m_idle_target = ~0;
+		return;
+	}
+
+	// a new loop is only armed here; reads are recorded from now on, so the
+	// reference snapshot is taken at the end of the first fully watched iteration
+	if (target != m_idle_target)
+	{
+		m_idle_target = target;
+		m_idle_matches = -1;
+		m_idle_dirty = false;
+		return;
+	}
+
+	// what the loop read is part of its state
+	UINT64 signature = idle_loop_signature() ^ reads;
+	if (m_idle_matches < 0)
+	{
+		m_idle_signature = signature;
+		m_idle_matches = 0;
+		return;
+	}
+
+	// if the state changed, this is a counting or computing loop; back off as well
+	if (signature != m_idle_signature)
+	{
+		m_idle_skip = m_idle_backoff;
+		m_idle_backoff = MIN(m_idle_backoff * 2 + 1, IDLE_LOOP_MAX_BACKOFF);
+		m_idle_target = ~0;
+		return;
+	}
+	if (++m_idle_matches < IDLE_LOOP_MATCHES)
+		return;
+
+	// log each loop the first time we find it
+	int loopnum;
+	for (loopnum = 0; loopnum < m_idle_loops.count(); loopnum++)
+		if (m_idle_loops[loopnum] == target)
+			break;
+	if (loopnum == m_idle_loops.count())
+	{
+		m_idle_loops.append(target);
+		logerror("%s: idle loop detected at %X-%X\n", device().tag(), target, pc);
+	}
+
+	// nothing left to do in this timeslice
+	m_idle_backoff = 0;
+	eat_cycles(cycles_remaining());
+}
+
+
+//-------------------------------------------------
+//  idle_loop_record_read - called by cores for
+//  each data read while a loop is watched; only
+//  loops that read nothing but plain memory can
+//  be idle, anything else may be polling a device
+//-------------------------------------------------
+
+void device_execute_interface::idle_loop_record_read(address_space &space, offs_t address, UINT64 data)
+{
+	// RAM, ROM and banks are the only handlers with a direct pointer
+	if (space.get_read_ptr(address) == NULL)
+	{
+		m_idle_dirty = true;
+		return;
+	}
+	m_idle_reads = ((m_idle_reads << 11) | (m_idle_reads >> 53)) ^ (((UINT64)address << 32) | data);
+}
+
+
+//-------------------------------------------------
+//  idle_loop_signature - compute a signature of
+//  the exposed state of the device
+//-------------------------------------------------
+
+UINT64 device_execute_interface::idle_loop_signature()
+{
+	device_state_interface *state;
+	if (!device().interface(state))
+		return 0;
+
+	UINT64 signature = 0;
+	for (const device_state_entry *entry = state->state_first(); entry != NULL; entry = entry->next())
+		if (!entry->divider() && entry->steady())
+			signature = ((signature << 7) | (signature >> 57)) ^ state->state_int(entry->index());
+	return signature;
+}
+
+
 //-------------------------------------------------
 //  static_timed_trigger_callback - signal a timed
 //  trigger
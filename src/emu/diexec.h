@@ -87,6 +87,8 @@ enum
 
 #define MCFG_DEVICE_DISABLE() \
 	device_execute_interface::static_set_disable(*device);
+#define MCFG_DEVICE_NO_IDLE_DETECT() \
+	device_execute_interface::static_set_no_idle_detect(*device);
 #define MCFG_DEVICE_VBLANK_INT_DRIVER(_tag, _class, _func) \
 	device_execute_interface::static_set_vblank_int(*device, device_interrupt_delegate(&_class::_func, #_class "::" #_func, DEVICE_SELF, (_class *)0), _tag);
 #define MCFG_DEVICE_VBLANK_INT_DEVICE(_tag, _devtag, _class, _func) \
@@ -150,6 +152,7 @@ public:
 
 	// static inline configuration helpers
 	static void static_set_disable(device_t &device);
+	static void static_set_no_idle_detect(device_t &device);
 	static void static_set_vblank_int(device_t &device, device_interrupt_delegate function, const char *tag, int rate = 0);
 	static void static_set_periodic_int(device_t &device, device_interrupt_delegate function, const attotime &rate);
 	static void static_set_irq_acknowledge_callback(device_t &device, device_irq_acknowledge_delegate callback);
@@ -225,6 +228,12 @@ protected:
 	IRQ_CALLBACK_MEMBER(standard_irq_callback_member);
 	int standard_irq_callback(int irqline);
 
+	// idle loop detection, for cores that opt in by reporting taken branches, data reads and side effects
+	bool idle_detect_enabled() const { return m_idle_detect; }
+	void idle_loop_branch(offs_t pc, offs_t target) { if (m_idle_detect) idle_loop_check(pc, target); }
+	void idle_loop_read(address_space &space, offs_t address, UINT64 data) { if (m_idle_detect && m_idle_target != ~0 && !m_idle_dirty) idle_loop_record_read(space, address, data); }
+	void idle_loop_side_effect() { m_idle_dirty = true; }
+
 	// internal information about the state of inputs
 	class device_input
 	{
@@ -264,6 +273,7 @@ protected:
 	device_interrupt_delegate m_timed_interrupt;        // for interrupts not tied to VBLANK
 	attotime                m_timed_interrupt_period;   // period for periodic interrupts
 	bool                    m_is_octal;                 // to determine if messages/debugger will show octal or hex
+	bool                    m_no_idle_detect;           // idle loop detection forbidden by the driver?
 
 	// execution lists
 	device_execute_interface *m_nextexec;               // pointer to the next device to execute, in order
@@ -295,6 +305,17 @@ protected:
 	UINT32                  m_cycles_per_second;        // cycles per second, adjusted for multipliers
 	attoseconds_t           m_attoseconds_per_cycle;    // attoseconds per adjusted clock cycle
 
+	// idle loop detection
+	bool                    m_idle_detect;              // true if idle loop detection is active
+	bool                    m_idle_dirty;               // side effects seen since the last branch to the target?
+	offs_t                  m_idle_target;              // target of the loop we are currently watching
+	UINT64                  m_idle_signature;           // state signature at the last branch to the target
+	UINT64                  m_idle_reads;               // signature of the reads made since the last branch
+	int                     m_idle_matches;             // consecutive iterations with identical state, -1 until the reference is taken
+	int                     m_idle_backoff;             // branches to skip after a failed candidate
+	int                     m_idle_skip;                // branches still to be skipped
+	dynamic_array<offs_t>   m_idle_loops;               // loops detected so far, for logging
+
 private:
 	// callbacks
 	static void static_timed_trigger_callback(running_machine &machine, void *ptr, int param);
@@ -306,6 +327,10 @@ private:
 	void suspend_resume_changed();
 
 	attoseconds_t minimum_quantum() const;
+
+	void idle_loop_check(offs_t pc, offs_t target);
+	void idle_loop_record_read(address_space &space, offs_t address, UINT64 data);
+	UINT64 idle_loop_signature();
 };
 
 // iterator
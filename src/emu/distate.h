@@ -59,6 +59,7 @@ public:
 	device_state_entry &callimport() { m_flags |= DSF_IMPORT; return *this; }
 	device_state_entry &callexport() { m_flags |= DSF_EXPORT; return *this; }
 	device_state_entry &noshow() { m_flags |= DSF_NOSHOW; return *this; }
+	device_state_entry &free_running() { m_flags |= DSF_FREE_RUNNING; return *this; }
 
 	// iteration helpers
 	const device_state_entry *next() const { return m_next; }
@@ -69,6 +70,7 @@ public:
 	const char *symbol() const { return m_symbol; }
 	bool visible() const { return ((m_flags & DSF_NOSHOW) == 0); }
 	bool divider() const { return m_flags & DSF_DIVIDER; }
+	bool steady() const { return ((m_flags & DSF_FREE_RUNNING) == 0); }
 	device_state_interface *parent_state() const {return m_device_state;}
 
 protected:
@@ -79,6 +81,7 @@ protected:
 	static const UINT8 DSF_EXPORT =         0x08;   // call the export function prior to fetching the data
 	static const UINT8 DSF_CUSTOM_STRING =  0x10;   // set if the format has a custom string
 	static const UINT8 DSF_DIVIDER       =  0x20;   // set if this is a divider entry
+	static const UINT8 DSF_FREE_RUNNING  =  0x40;   // set if this entry changes on its own (refresh counters, etc)
 
 	// helpers
 	bool needs_custom_string() const { return ((m_flags & DSF_CUSTOM_STRING) != 0); }
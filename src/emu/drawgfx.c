@@ -231,11 +231,17 @@ void gfx_element::set_layout(const gfx_layout &gl, const UINT8 *srcdata)
 	// mark everything dirty
 	m_dirty.resize_and_clear(m_total_elements, 1);
 
-	// allocate a pen usage array for entries with 32 pens or less
+	// allocate pen usage arrays for entries with 32 pens or less
 	if (m_color_depth <= 32)
+	{
 		m_pen_usage.resize(m_total_elements);
+		m_row_usage.resize(m_total_elements * m_origheight);
+	}
 	else
+	{
 		m_pen_usage.reset();
+		m_row_usage.reset();
+	}
 }
 
 
@@ -282,9 +288,12 @@ void gfx_element::set_source_and_total(const UINT8 *source, UINT32 total)
 	// mark everything dirty
 	m_dirty.resize_and_clear(m_total_elements, 1);
 
-	// allocate a pen usage array for entries with 32 pens or less
+	// allocate pen usage arrays for entries with 32 pens or less
 	if (m_color_depth <= 32)
+	{
 		m_pen_usage.resize(m_total_elements);
+		m_row_usage.resize(m_total_elements * m_origheight);
+	}
 
 	if (m_layout_is_raw)
 	{
@@ -355,13 +364,17 @@ void gfx_element::decode(UINT32 code)
 	// (re)compute pen usage
 	if (code < m_pen_usage.count())
 	{
-		// iterate over data, creating a bitmask of live pens
+		// iterate over data, creating a bitmask of live pens for each row and the whole element
 		const UINT8 *dp = m_gfxdata + code * m_char_modulo;
+		UINT32 *rowusage = &m_row_usage[code * m_origheight];
 		UINT32 usage = 0;
 		for (int y = 0; y < m_origheight; y++)
 		{
+			UINT32 rowbits = 0;
 			for (int x = 0; x < m_origwidth; x++)
-				usage |= 1 << dp[x];
+				rowbits |= 1 << dp[x];
+			rowusage[y] = rowbits;
+			usage |= rowbits;
 			dp += m_line_modulo;
 		}
 
@@ -430,10 +443,13 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 			return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
 	}
 
-	// render
+	// render, a row at a time if we know which rows are transparent or opaque
 	color = colorbase() + granularity() * (color % colors());
 	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
+	if (has_pen_usage())
+		DRAWGFX_ROWS_CORE(UINT16, PIXEL_OP_REBASE_OPAQUE, PIXEL_OP_REBASE_TRANSPEN, ROW_OP_REBASE_TRANSPEN, NO_PRIORITY);
+	else
+		DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -458,10 +474,13 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 			return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
 	}
 
-	// render
+	// render, a row at a time if we know which rows are transparent or opaque
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
 	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN, NO_PRIORITY);
+	if (has_pen_usage())
+		DRAWGFX_ROWS_CORE(UINT32, PIXEL_OP_REMAP_OPAQUE, PIXEL_OP_REMAP_TRANSPEN, ROW_OP_NONE, NO_PRIORITY);
+	else
+		DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN, NO_PRIORITY);
 }
 
 
@@ -991,9 +1010,12 @@ void gfx_element::prio_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
 
-	// render
+	// render, a row at a time if we know which rows are transparent or opaque
 	color = colorbase() + granularity() * (color % colors());
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
+	if (has_pen_usage())
+		DRAWGFX_ROWS_CORE(UINT16, PIXEL_OP_REBASE_OPAQUE_PRIORITY, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, ROW_OP_NONE, UINT8);
+	else
+		DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
 }
 
 void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1021,9 +1043,12 @@ void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
 
-	// render
+	// render, a row at a time if we know which rows are transparent or opaque
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_PRIORITY, UINT8);
+	if (has_pen_usage())
+		DRAWGFX_ROWS_CORE(UINT32, PIXEL_OP_REMAP_OPAQUE_PRIORITY, PIXEL_OP_REMAP_TRANSPEN_PRIORITY, ROW_OP_NONE, UINT8);
+	else
+		DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_PRIORITY, UINT8);
 }
 
 
@@ -1745,6 +1770,163 @@ void gfx_element::alphatable(bitmap_rgb32 &dest, const rectangle &cliprect,
 }
 
 
+/***************************************************************************
+    SPRITE LISTS
+***************************************************************************/
+
+/*-------------------------------------------------
+    gfx_sprite_list - constructor
+-------------------------------------------------*/
+
+gfx_sprite_list::gfx_sprite_list(running_machine &machine)
+	: m_work_queue(NULL),
+		m_bands(machine.options().sprite_bands())
+{
+	if (m_bands > 1)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+}
+
+
+/*-------------------------------------------------
+    ~gfx_sprite_list - destructor
+-------------------------------------------------*/
+
+gfx_sprite_list::~gfx_sprite_list()
+{
+	if (m_work_queue != NULL)
+		osd_work_queue_free(m_work_queue);
+}
+
+
+/*-------------------------------------------------
+    add - append a sprite to the list; sprites
+    are drawn in the order they were added, so
+    later ones end up on top
+-------------------------------------------------*/
+
+void gfx_sprite_list::add(gfx_element *gfx, UINT32 code, UINT32 color, int flipx, int flipy, INT32 destx, INT32 desty, UINT32 transpen, UINT32 scalex, UINT32 scaley, UINT32 pmask)
+{
+	sprite_entry &sprite = m_sprites.append();
+	sprite.gfx = gfx;
+	sprite.code = code;
+	sprite.color = color;
+	sprite.flipx = (flipx != 0);
+	sprite.flipy = (flipy != 0);
+	sprite.destx = destx;
+	sprite.desty = desty;
+	sprite.scalex = scalex;
+	sprite.scaley = scaley;
+	sprite.pmask = pmask;
+	sprite.transpen = transpen;
+
+	// same rounding as DRAWGFXZOOM_CORE, which also covers the unzoomed case
+	sprite.maxy = desty + ((scaley * gfx->height() + 0x8000) >> 16) - 1;
+}
+
+
+/*-------------------------------------------------
+    draw - render the whole list
+-------------------------------------------------*/
+
+void gfx_sprite_list::draw(bitmap_ind16 &dest, const rectangle &cliprect)
+{ draw_common(dest, cliprect, NULL); }
+
+void gfx_sprite_list::draw(bitmap_rgb32 &dest, const rectangle &cliprect)
+{ draw_common(dest, cliprect, NULL); }
+
+void gfx_sprite_list::draw(bitmap_ind16 &dest, const rectangle &cliprect, bitmap_ind8 &priority)
+{ draw_common(dest, cliprect, &priority); }
+
+void gfx_sprite_list::draw(bitmap_rgb32 &dest, const rectangle &cliprect, bitmap_ind8 &priority)
+{ draw_common(dest, cliprect, &priority); }
+
+
+/*-------------------------------------------------
+    draw_common - bin the sprites into horizontal
+    bands and render those in parallel, or just
+    walk the list if banding is off
+-------------------------------------------------*/
+
+template<class _BitmapClass>
+void gfx_sprite_list::draw_common(_BitmapClass &dest, const rectangle &cliprect, bitmap_ind8 *priority)
+{
+	int bands = cliprect.height() / MIN_BAND_HEIGHT;
+	if (bands > m_bands)
+		bands = m_bands;
+	if (bands > MAX_BANDS)
+		bands = MAX_BANDS;
+
+	// serial case: identical to drawing the sprites directly
+	if (m_work_queue == NULL || bands < 2)
+	{
+		for (int index = 0; index < m_sprites.count(); index++)
+			draw_sprite(m_sprites[index], dest, cliprect, priority);
+		return;
+	}
+
+	// carve up the cliprect
+	band_parameters<_BitmapClass> band[MAX_BANDS];
+	for (int bandnum = 0; bandnum < bands; bandnum++)
+	{
+		band[bandnum].list = this;
+		band[bandnum].dest = &dest;
+		band[bandnum].priority = priority;
+		band[bandnum].cliprect = cliprect;
+		band[bandnum].cliprect.min_y = cliprect.min_y + cliprect.height() * bandnum / bands;
+		band[bandnum].cliprect.max_y = cliprect.min_y + cliprect.height() * (bandnum + 1) / bands - 1;
+		band[bandnum].bandnum = bandnum;
+		m_bin[bandnum].resize(0);
+	}
+
+	// bin the visible sprites, keeping list order within each band; decoding
+	// happens here so that the workers never touch the element's dirty state
+	for (int index = 0; index < m_sprites.count(); index++)
+	{
+		const sprite_entry &sprite = m_sprites[index];
+		if (sprite.maxy < cliprect.min_y || sprite.desty > cliprect.max_y)
+			continue;
+		sprite.gfx->get_data(sprite.code % sprite.gfx->elements());
+		for (int bandnum = 0; bandnum < bands; bandnum++)
+			if (sprite.maxy >= band[bandnum].cliprect.min_y && sprite.desty <= band[bandnum].cliprect.max_y)
+				m_bin[bandnum].append(index);
+	}
+
+	osd_work_item_queue_multiple(m_work_queue, draw_band_static<_BitmapClass>, bands, band, sizeof(band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+}
+
+
+/*-------------------------------------------------
+    draw_sprite - draw a single sprite clipped to
+    the given rectangle
+-------------------------------------------------*/
+
+template<class _BitmapClass>
+void gfx_sprite_list::draw_sprite(const sprite_entry &sprite, _BitmapClass &dest, const rectangle &cliprect, bitmap_ind8 *priority)
+{
+	if (priority != NULL)
+		sprite.gfx->prio_zoom_transpen(dest, cliprect, sprite.code, sprite.color, sprite.flipx, sprite.flipy, sprite.destx, sprite.desty, sprite.scalex, sprite.scaley, *priority, sprite.pmask, sprite.transpen);
+	else
+		sprite.gfx->zoom_transpen(dest, cliprect, sprite.code, sprite.color, sprite.flipx, sprite.flipy, sprite.destx, sprite.desty, sprite.scalex, sprite.scaley, sprite.transpen);
+}
+
+
+/*-------------------------------------------------
+    draw_band_static - work queue callback to
+    draw the sprites binned into a single band
+-------------------------------------------------*/
+
+template<class _BitmapClass>
+void *gfx_sprite_list::draw_band_static(void *param, int threadid)
+{
+	band_parameters<_BitmapClass> &band = *reinterpret_cast<band_parameters<_BitmapClass> *>(param);
+	const dynamic_array<UINT32> &bin = band.list->m_bin[band.bandnum];
+	for (int index = 0; index < bin.count(); index++)
+		band.list->draw_sprite(band.list->m_sprites[bin[index]], *band.dest, band.cliprect, band.priority);
+	return NULL;
+}
+
+
 /***************************************************************************
     DRAW_SCANLINE IMPLEMENTATIONS
 ***************************************************************************/
@@ -2130,3 +2312,191 @@ void copyrozbitmap_trans(bitmap_rgb32 &dest, const rectangle &cliprect, bitmap_r
 
 GFXDECODE_START( empty )
 GFXDECODE_END
+
+
+/***************************************************************************
+    SELF TESTS
+***************************************************************************/
+
+/*-------------------------------------------------
+    drawgfx_row_core_tester - a single random
+    element drawn through both the per-pixel and
+    the row-classified cores
+-------------------------------------------------*/
+
+class drawgfx_row_core_tester
+{
+public:
+	drawgfx_row_core_tester(UINT32 &seed, int width, int height)
+		: m_seed(seed),
+			m_width(width),
+			m_height(height)
+	{
+		// build each row as transparent, opaque or mixed, the three cases the row core tells apart
+		m_trans_pen = next() % 32;
+		m_data.resize(width * height);
+		m_usage.resize(height);
+		for (int y = 0; y < height; y++)
+		{
+			int kind = next() % 3;
+			UINT32 usage = 0;
+			for (int x = 0; x < width; x++)
+			{
+				UINT8 pen = next() % 32;
+				if (kind == 0 || (kind == 2 && (next() & 1)))
+					pen = m_trans_pen;
+				else if (pen == m_trans_pen)
+					pen = (pen + 1) % 32;
+				m_data[y * width + x] = pen;
+				usage |= 1 << pen;
+			}
+			m_usage[y] = usage;
+		}
+	}
+
+	// random numbers, reproducible from one run to the next
+	UINT32 next() { m_seed = m_seed * 1103515245 + 12345; return m_seed >> 8; }
+
+	// the parts of gfx_element the cores use
+	UINT32 elements() const { return 1; }
+	UINT16 width() const { return m_width; }
+	UINT16 height() const { return m_height; }
+	UINT32 rowbytes() const { return m_width; }
+	const UINT8 *get_data(UINT32 code) { return m_data; }
+	const UINT32 *row_usage(UINT32 code) { return m_usage; }
+
+	// draw through either core, with or without priority
+	void draw(bitmap_ind16 &dest, bitmap_ind8 &pri, const rectangle &cliprect, UINT32 code, UINT32 color,
+			int flipx, int flipy, INT32 destx, INT32 desty, UINT32 pmask, bool usepri, bool rows)
+	{
+		UINT32 trans_pen = m_trans_pen;
+		if (usepri)
+		{
+			bitmap_ind8 &priority = pri;
+			if (rows)
+				DRAWGFX_ROWS_CORE(UINT16, PIXEL_OP_REBASE_OPAQUE_PRIORITY, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, ROW_OP_NONE, UINT8);
+			else
+				DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
+		}
+		else
+		{
+			DECLARE_NO_PRIORITY;
+			if (rows)
+				DRAWGFX_ROWS_CORE(UINT16, PIXEL_OP_REBASE_OPAQUE, PIXEL_OP_REBASE_TRANSPEN, ROW_OP_REBASE_TRANSPEN, NO_PRIORITY);
+			else
+				DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
+		}
+	}
+
+	void draw(bitmap_rgb32 &dest, bitmap_ind8 &pri, const rectangle &cliprect, UINT32 code, const pen_t *paldata,
+			int flipx, int flipy, INT32 destx, INT32 desty, UINT32 pmask, bool usepri, bool rows)
+	{
+		UINT32 trans_pen = m_trans_pen;
+		if (usepri)
+		{
+			bitmap_ind8 &priority = pri;
+			if (rows)
+				DRAWGFX_ROWS_CORE(UINT32, PIXEL_OP_REMAP_OPAQUE_PRIORITY, PIXEL_OP_REMAP_TRANSPEN_PRIORITY, ROW_OP_NONE, UINT8);
+			else
+				DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_PRIORITY, UINT8);
+		}
+		else
+		{
+			DECLARE_NO_PRIORITY;
+			if (rows)
+				DRAWGFX_ROWS_CORE(UINT32, PIXEL_OP_REMAP_OPAQUE, PIXEL_OP_REMAP_TRANSPEN, ROW_OP_NONE, NO_PRIORITY);
+			else
+				DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN, NO_PRIORITY);
+		}
+	}
+
+private:
+	UINT32 &                m_seed;
+	int                     m_width;
+	int                     m_height;
+	UINT32                  m_trans_pen;
+	dynamic_buffer          m_data;
+	dynamic_array<UINT32>   m_usage;
+};
+
+
+/*-------------------------------------------------
+    drawgfx_validate_row_cores - check that the
+    row-classified transpen cores produce exactly
+    the same pixels and priorities as the per-pixel
+    cores; returns the number of mismatches, which
+    are reported through osd_printf_error
+-------------------------------------------------*/
+
+int drawgfx_validate_row_cores()
+{
+	const int size = 48;
+	UINT32 seed = 0x5eed;
+	int errors = 0;
+
+	bitmap_ind16 dest16[2];
+	bitmap_rgb32 dest32[2];
+	bitmap_ind8 pri[2];
+	for (int which = 0; which < 2; which++)
+	{
+		dest16[which].allocate(size, size);
+		dest32[which].allocate(size, size);
+		pri[which].allocate(size, size);
+	}
+
+	pen_t paldata[32];
+	for (int pen = 0; pen < 32; pen++)
+		paldata[pen] = rgb_t(pen * 8, 0xff - pen * 8, pen ^ 0x5a);
+
+	for (int test = 0; test < 512; test++)
+	{
+		// random element sizes cover both the SSE2 blocks and the leftovers
+		drawgfx_row_core_tester element(seed, 1 + seed % 37, 1 + (seed >> 8) % 19);
+		UINT32 color = element.next() & 0x7fe0;
+		int flipx = element.next() & 1;
+		int flipy = element.next() & 1;
+		INT32 destx = (INT32)(element.next() % (size + 16)) - 24;
+		INT32 desty = (INT32)(element.next() % (size + 16)) - 16;
+		UINT32 pmask = element.next() | (1 << 31);
+		bool usepri = (test & 1) != 0;
+
+		rectangle cliprect;
+		cliprect.min_x = element.next() % (size / 2);
+		cliprect.max_x = size / 2 + element.next() % (size / 2);
+		cliprect.min_y = element.next() % (size / 2);
+		cliprect.max_y = size / 2 + element.next() % (size / 2);
+
+		// start both copies from the same random contents
+		for (int y = 0; y < size; y++)
+			for (int x = 0; x < size; x++)
+			{
+				dest16[0].pix16(y, x) = dest16[1].pix16(y, x) = element.next();
+				dest32[0].pix32(y, x) = dest32[1].pix32(y, x) = element.next();
+				pri[0].pix8(y, x) = pri[1].pix8(y, x) = element.next() & 0x1f;
+			}
+
+		bool match16 = true, match32 = true;
+		for (int which = 0; which < 2; which++)
+			element.draw(dest16[which], pri[which], cliprect, 0, color, flipx, flipy, destx, desty, pmask, usepri, which != 0);
+		for (int y = 0; y < size; y++)
+			for (int x = 0; x < size; x++)
+				if (dest16[0].pix16(y, x) != dest16[1].pix16(y, x) || pri[0].pix8(y, x) != pri[1].pix8(y, x))
+					match16 = false;
+
+		for (int which = 0; which < 2; which++)
+			element.draw(dest32[which], pri[which], cliprect, 0, paldata, flipx, flipy, destx, desty, pmask, usepri, which != 0);
+		for (int y = 0; y < size; y++)
+			for (int x = 0; x < size; x++)
+				if (dest32[0].pix32(y, x) != dest32[1].pix32(y, x) || pri[0].pix8(y, x) != pri[1].pix8(y, x))
+					match32 = false;
+
+		if (!match16 || !match32)
+		{
+			osd_printf_error("Row-classified drawgfx core mismatch (%dx%d, %s%s%s, %s bitmap, test %d)\n",
+					element.width(), element.height(), flipx ? "flipx " : "", flipy ? "flipy " : "", usepri ? "priority" : "no priority",
+					!match16 ? "ind16" : "rgb32", test);
+			errors++;
+		}
+	}
+	return errors;
+}
@@ -199,6 +199,14 @@ public:
 		return m_pen_usage[code];
 	}
 
+	// per-row pen usage, starting at the first row inside the source clip
+	const UINT32 *row_usage(UINT32 code)
+	{
+		assert(code < m_pen_usage.count());
+		if (m_dirty[code]) decode(code);
+		return &m_row_usage[code * m_origheight + m_starty];
+	}
+
 	// ----- core graphics drawing -----
 
 	// specific drawgfx implementations for each transparency type
@@ -294,6 +302,7 @@ private:
 	dynamic_buffer  m_gfxdata_allocated;    // allocated decoded pixel data, 8bpp
 	dynamic_buffer  m_dirty;                // dirty array for detecting chars that need decoding
 	dynamic_array<UINT32> m_pen_usage;      // bitmask of pens that are used (pens 0-31 only)
+	dynamic_array<UINT32> m_row_usage;      // bitmask of pens that are used in each row (pens 0-31 only)
 
 	bool            m_layout_is_raw;        // raw layout?
 	UINT8           m_layout_planes;        // bit planes in the layout
@@ -305,6 +314,75 @@ private:
 };
 
 
+// a display list of sprites that are drawn in list order, optionally split
+// into horizontal bands which are rendered in parallel on a work queue;
+// since every band only touches its own rows of the destination and
+// priority bitmaps, the result is identical to drawing the sprites one by
+// one with the gfx_element calls above
+class gfx_sprite_list
+{
+public:
+	// construction/destruction
+	gfx_sprite_list(running_machine &machine);
+	~gfx_sprite_list();
+
+	// getters
+	int count() const { return m_sprites.count(); }
+
+	// list management
+	void reset() { m_sprites.resize(0); }
+	void add(gfx_element *gfx, UINT32 code, UINT32 color, int flipx, int flipy, INT32 destx, INT32 desty, UINT32 transpen, UINT32 scalex = 0x10000, UINT32 scaley = 0x10000, UINT32 pmask = 0);
+
+	// drawing; the priority versions mask sprites the way prio_zoom_transpen does
+	void draw(bitmap_ind16 &dest, const rectangle &cliprect);
+	void draw(bitmap_rgb32 &dest, const rectangle &cliprect);
+	void draw(bitmap_ind16 &dest, const rectangle &cliprect, bitmap_ind8 &priority);
+	void draw(bitmap_rgb32 &dest, const rectangle &cliprect, bitmap_ind8 &priority);
+
+private:
+	// a single queued sprite
+	struct sprite_entry
+	{
+		gfx_element *   gfx;                    // element to draw from
+		UINT32          code;                   // element code
+		UINT32          color;                  // color code
+		UINT8           flipx;                  // flip horizontally?
+		UINT8           flipy;                  // flip vertically?
+		INT32           destx, desty;           // top-left position
+		UINT32          scalex, scaley;         // 16.16 zoom factors
+		UINT32          pmask;                  // priority mask
+		UINT32          transpen;               // transparent pen; >0xff means opaque
+		INT32           maxy;                   // last row covered by the sprite
+	};
+
+	// a band's worth of work for the queue
+	template<class _BitmapClass>
+	struct band_parameters
+	{
+		gfx_sprite_list *   list;               // owning list
+		_BitmapClass *      dest;               // destination bitmap
+		bitmap_ind8 *       priority;           // priority bitmap, or NULL
+		rectangle           cliprect;           // rows covered by this band
+		int                 bandnum;            // index of our bin
+	};
+
+	// internal helpers
+	template<class _BitmapClass> void draw_common(_BitmapClass &dest, const rectangle &cliprect, bitmap_ind8 *priority);
+	template<class _BitmapClass> void draw_sprite(const sprite_entry &sprite, _BitmapClass &dest, const rectangle &cliprect, bitmap_ind8 *priority);
+	template<class _BitmapClass> static void *draw_band_static(void *param, int threadid);
+
+	// constants
+	static const int MAX_BANDS = 16;            // most bands a single draw is split into
+	static const int MIN_BAND_HEIGHT = 16;      // don't bother splitting into bands shorter than this
+
+	// internal state
+	dynamic_array<sprite_entry> m_sprites;      // sprites in drawing order
+	dynamic_array<UINT32> m_bin[MAX_BANDS];     // indexes of the sprites touching each band
+	osd_work_queue *    m_work_queue;           // work queue for banded drawing
+	int                 m_bands;                // number of bands requested
+};
+
+
 /***************************************************************************
     FUNCTION PROTOTYPES
 ***************************************************************************/
@@ -409,6 +487,12 @@ void copyrozbitmap_trans(bitmap_ind16 &dest, const rectangle &cliprect, bitmap_i
 void copyrozbitmap_trans(bitmap_rgb32 &dest, const rectangle &cliprect, bitmap_rgb32 &src, INT32 startx, INT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy, int wraparound, UINT32 transparent_color);
 
 
+// ----- self tests -----
+
+// compare the row-classified transpen cores against the per-pixel ones; returns the number of mismatches
+int drawgfx_validate_row_cores();
+
+
 
 /***************************************************************************
     INLINE FUNCTIONS
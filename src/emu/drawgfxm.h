@@ -54,6 +54,14 @@
 
 #include "profiler.h"
 
+/* use SSE2 for the row operations under the same conditions as rgbutil.h */
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define DRAWGFX_USE_SSE2    (1)
+#include <emmintrin.h>
+#else
+#define DRAWGFX_USE_SSE2    (0)
+#endif
+
 
 /* special priority type meaning "none" */
 struct NO_PRIORITY { char dummy[3]; };
@@ -368,6 +376,60 @@ do
 while (0)
 
 
+/***************************************************************************
+    ROW OPERATIONS
+***************************************************************************/
+
+/*
+    The ROW_OP* macros are optional vectorized helpers for the row-classified
+    cores below. They are handed a whole left-to-right row of COUNT pixels,
+    along with OPAQUE, which is true if the row is known to contain no
+    transparent pens. They render as many leading pixels as they can and
+    return that count; the core finishes the rest with the PIXEL_OP* macros.
+*/
+
+/*-------------------------------------------------
+    ROW_OP_NONE - no vectorized row support
+-------------------------------------------------*/
+
+#define ROW_OP_NONE(DESTPTR, PRIPTR, SRCPTR, COUNT, OPAQUE)     (0)
+
+/*-------------------------------------------------
+    ROW_OP_REBASE_TRANSPEN - vectorized
+    PIXEL_OP_REBASE_TRANSPEN for 16bpp targets
+-------------------------------------------------*/
+
+#define ROW_OP_REBASE_TRANSPEN(DESTPTR, PRIPTR, SRCPTR, COUNT, OPAQUE) \
+	drawgfx_row_rebase_transpen((DESTPTR), (SRCPTR), (COUNT), color, trans_pen, (OPAQUE))
+
+inline INT32 drawgfx_row_rebase_transpen(UINT16 *destptr, const UINT8 *srcptr, INT32 count, UINT32 color, UINT32 trans_pen, bool opaque)
+{
+#if DRAWGFX_USE_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i colorvec = _mm_set1_epi16(color);
+	const __m128i transvec = _mm_set1_epi16(trans_pen);
+	INT32 blocks = count & ~7;
+
+	/* 8 pixels at a time: widen, rebase, and merge around the transparent pens */
+	for (INT32 curx = 0; curx < blocks; curx += 8)
+	{
+		__m128i pens = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)&srcptr[curx]), zero);
+		__m128i result = _mm_add_epi16(pens, colorvec);
+		if (!opaque)
+		{
+			__m128i trans = _mm_cmpeq_epi16(pens, transvec);
+			__m128i existing = _mm_loadu_si128((const __m128i *)&destptr[curx]);
+			result = _mm_or_si128(_mm_and_si128(trans, existing), _mm_andnot_si128(trans, result));
+		}
+		_mm_storeu_si128((__m128i *)&destptr[curx], result);
+	}
+	return blocks;
+#else
+	return 0;
+#endif
+}
+
+
 /***************************************************************************
     BASIC DRAWGFX CORE
 ***************************************************************************/
@@ -538,6 +600,170 @@ do {
 
 
 
+
+/***************************************************************************
+    ROW-CLASSIFIED DRAWGFX CORE
+***************************************************************************/
+
+/*
+    Variant of DRAWGFX_CORE for transparent-pen drawing that consults the
+    per-row pen usage kept by the gfx_element: rows made up entirely of
+    'trans_pen' are skipped, rows that never use it are drawn with
+    OPAQUE_OP, and only mixed rows pay for TRANSPEN_OP's per-pixel test.
+    Left-to-right rows are first offered to ROW_OP.
+
+    Only usable from gfx_element members, on elements that have pen
+    usage, after the code has been decoded.
+
+    Assumed input parameters or local variables: as DRAWGFX_CORE, plus
+
+        UINT32 trans_pen - the transparent pen, which must be <= 0xff
+*/
+
+#define DRAWGFX_ROWS_PIXELS(PIXEL_OP, PRIORITY_TYPE, SRCSTEP, COUNT)                   \
+do {                                                                                    \
+	INT32 numblocks = (COUNT) / 4;                                                      \
+	INT32 leftovers = (COUNT) - 4 * numblocks;                                          \
+																						\
+	/* iterate over unrolled blocks of 4 */                                             \
+	for (INT32 curx = 0; curx < numblocks; curx++)                                      \
+	{                                                                                   \
+		PIXEL_OP(destptr[0], priptr[0], srcptr[0 * (SRCSTEP)]);                         \
+		PIXEL_OP(destptr[1], priptr[1], srcptr[1 * (SRCSTEP)]);                         \
+		PIXEL_OP(destptr[2], priptr[2], srcptr[2 * (SRCSTEP)]);                         \
+		PIXEL_OP(destptr[3], priptr[3], srcptr[3 * (SRCSTEP)]);                         \
+																						\
+		srcptr += 4 * (SRCSTEP);                                                        \
+		destptr += 4;                                                                   \
+		PRIORITY_ADVANCE(PRIORITY_TYPE, priptr, 4);                                     \
+	}                                                                                   \
+																						\
+	/* iterate over leftover pixels */                                                  \
+	for (INT32 curx = 0; curx < leftovers; curx++)                                      \
+	{                                                                                   \
+		PIXEL_OP(destptr[0], priptr[0], srcptr[0]);                                     \
+		srcptr += (SRCSTEP);                                                            \
+		destptr++;                                                                      \
+		PRIORITY_ADVANCE(PRIORITY_TYPE, priptr, 1);                                     \
+	}                                                                                   \
+} while (0)
+
+#define DRAWGFX_ROWS_CORE(PIXEL_TYPE, OPAQUE_OP, TRANSPEN_OP, ROW_OP, PRIORITY_TYPE)   \
+do {                                                                                    \
+	g_profiler.start(PROFILER_DRAWGFX);                                                 \
+	do {                                                                                \
+		const UINT8 *srcdata;                                                           \
+		const UINT32 *rowusage;                                                         \
+		INT32 destendx, destendy;                                                       \
+		INT32 srcx, srcy;                                                               \
+		INT32 cury;                                                                     \
+		INT32 dy, dusage;                                                               \
+																						\
+		assert(dest.valid());                                                           \
+		assert(!PRIORITY_VALID(PRIORITY_TYPE) || priority.valid());                     \
+		assert(dest.cliprect().contains(cliprect));                                     \
+		assert(code < elements());                                                      \
+		assert(trans_pen <= 0xff);                                                      \
+																						\
+		/* ignore empty/invalid cliprects */                                            \
+		if (cliprect.empty())                                                           \
+			break;                                                                      \
+																						\
+		/* compute final pixel in X and exit if we are entirely clipped */              \
+		destendx = destx + width() - 1;                                                 \
+		if (destx > cliprect.max_x || destendx < cliprect.min_x)                        \
+			break;                                                                      \
+																						\
+		/* apply left clip */                                                           \
+		srcx = 0;                                                                       \
+		if (destx < cliprect.min_x)                                                     \
+		{                                                                               \
+			srcx = cliprect.min_x - destx;                                              \
+			destx = cliprect.min_x;                                                     \
+		}                                                                               \
+																						\
+		/* apply right clip */                                                          \
+		if (destendx > cliprect.max_x)                                                  \
+			destendx = cliprect.max_x;                                                  \
+																						\
+		/* compute final pixel in Y and exit if we are entirely clipped */              \
+		destendy = desty + height() - 1;                                                \
+		if (desty > cliprect.max_y || destendy < cliprect.min_y)                        \
+			break;                                                                      \
+																						\
+		/* apply top clip */                                                            \
+		srcy = 0;                                                                       \
+		if (desty < cliprect.min_y)                                                     \
+		{                                                                               \
+			srcy = cliprect.min_y - desty;                                              \
+			desty = cliprect.min_y;                                                     \
+		}                                                                               \
+																						\
+		/* apply bottom clip */                                                         \
+		if (destendy > cliprect.max_y)                                                  \
+			destendy = cliprect.max_y;                                                  \
+																						\
+		/* apply X flipping */                                                          \
+		if (flipx)                                                                      \
+			srcx = width() - 1 - srcx;                                                  \
+																						\
+		/* apply Y flipping */                                                          \
+		dy = rowbytes();                                                                \
+		dusage = 1;                                                                     \
+		if (flipy)                                                                      \
+		{                                                                               \
+			srcy = height() - 1 - srcy;                                                 \
+			dy = -dy;                                                                   \
+			dusage = -1;                                                                \
+		}                                                                               \
+																						\
+		/* fetch the source data and the matching row usage */                          \
+		srcdata = get_data(code) + srcy * rowbytes() + srcx;                            \
+		rowusage = row_usage(code) + srcy;                                              \
+		UINT32 transbit = (trans_pen < 32) ? (1 << trans_pen) : 0;                      \
+		INT32 count = destendx + 1 - destx;                                             \
+																						\
+		/* iterate over pixels in Y */                                                  \
+		for (cury = desty; cury <= destendy; cury++)                                    \
+		{                                                                               \
+			const UINT8 *srcptr = srcdata;                                              \
+			UINT32 usage = *rowusage;                                                   \
+			srcdata += dy;                                                              \
+			rowusage += dusage;                                                         \
+																						\
+			/* skip rows that are entirely transparent */                               \
+			if ((usage & ~transbit) == 0)                                               \
+				continue;                                                               \
+																						\
+			PRIORITY_TYPE *priptr = PRIORITY_ADDR(priority, PRIORITY_TYPE, cury, destx); \
+			PIXEL_TYPE *destptr = &dest.pixt<PIXEL_TYPE>(cury, destx);                  \
+			bool opaque = ((usage & transbit) == 0);                                    \
+																						\
+			/* non-flipped rows can go through the row op first */                      \
+			if (!flipx)                                                                 \
+			{                                                                           \
+				INT32 done = ROW_OP(destptr, priptr, srcptr, count, opaque);            \
+				srcptr += done;                                                         \
+				destptr += done;                                                        \
+				PRIORITY_ADVANCE(PRIORITY_TYPE, priptr, done);                          \
+				if (opaque)                                                             \
+					DRAWGFX_ROWS_PIXELS(OPAQUE_OP, PRIORITY_TYPE, 1, count - done);     \
+				else                                                                    \
+					DRAWGFX_ROWS_PIXELS(TRANSPEN_OP, PRIORITY_TYPE, 1, count - done);   \
+			}                                                                           \
+			else                                                                        \
+			{                                                                           \
+				if (opaque)                                                             \
+					DRAWGFX_ROWS_PIXELS(OPAQUE_OP, PRIORITY_TYPE, -1, count);           \
+				else                                                                    \
+					DRAWGFX_ROWS_PIXELS(TRANSPEN_OP, PRIORITY_TYPE, -1, count);         \
+			}                                                                           \
+		}                                                                               \
+	} while (0);                                                                        \
+	g_profiler.stop();                                                                  \
+} while (0)
+
+
 /***************************************************************************
     BASIC DRAWGFXZOOM CORE
 ***************************************************************************/
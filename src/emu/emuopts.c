@@ -78,6 +78,14 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SLEEP,                                      "1",         OPTION_BOOLEAN,    "enable sleeping, which gives time back to other applications when idle" },
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       OPTION_FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         OPTION_BOOLEAN,    "automatically adjusts the speed of gameplay to keep the refresh rate lower than the screen" },
+	{ OPTION_IDLE_DETECT,                                "0",         OPTION_BOOLEAN,    "detect CPU idle loops in supporting cores and skip ahead to the next event" },
+	{ OPTION_TILEMAP_BANDS "(0-16)",                     "0",         OPTION_INTEGER,    "split tilemap drawing into this many horizontal bands rendered in parallel; 0 or 1 disables" },
+	{ OPTION_SPRITE_BANDS "(0-16)",                      "0",         OPTION_INTEGER,    "split sprite list drawing into this many horizontal bands rendered in parallel; 0 or 1 disables" },
+	{ OPTION_RENDER_BANDS "(0-16)",                      "0",         OPTION_INTEGER,    "split software rendering of the final output into this many horizontal bands rendered in parallel; 0 or 1 disables" },
+	{ OPTION_RECORD_ASYNC,                               "0",         OPTION_BOOLEAN,    "render and write movie frames on a separate thread while the next frame is emulated" },
+	{ OPTION_PRESCALE_ASYNC,                             "0",         OPTION_BOOLEAN,    "scale artwork and other scaled textures on a worker thread, drawing the previous scale until the new one is ready" },
+	{ OPTION_PRESCALE_CACHE,                             "0",         OPTION_INTEGER,    "limit the memory used by scaled textures to this many megabytes; 0 is unlimited" },
+	{ OPTION_GPU_ASYNC,                                  "0",         OPTION_BOOLEAN,    "execute emulated GPU drawing commands on a separate thread, in devices that support it" },
 
 	// rotation options
 	{ NULL,                                              NULL,        OPTION_HEADER,     "CORE ROTATION OPTIONS" },
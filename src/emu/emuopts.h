@@ -89,6 +89,14 @@ enum
 #define OPTION_SLEEP                "sleep"
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
+#define OPTION_IDLE_DETECT          "idle_detect"
+#define OPTION_TILEMAP_BANDS        "tilemap_bands"
+#define OPTION_SPRITE_BANDS         "sprite_bands"
+#define OPTION_RENDER_BANDS         "render_bands"
+#define OPTION_RECORD_ASYNC         "record_async"
+#define OPTION_PRESCALE_ASYNC       "prescale_async"
+#define OPTION_PRESCALE_CACHE       "prescale_cache"
+#define OPTION_GPU_ASYNC            "gpu_async"
 
 // core rotation options
 #define OPTION_ROTATE               "rotate"
@@ -257,6 +265,14 @@ public:
 	bool sleep() const { return bool_value(OPTION_SLEEP); }
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return bool_value(OPTION_REFRESHSPEED); }
+	bool idle_detect() const { return bool_value(OPTION_IDLE_DETECT); }
+	int tilemap_bands() const { return int_value(OPTION_TILEMAP_BANDS); }
+	int sprite_bands() const { return int_value(OPTION_SPRITE_BANDS); }
+	int render_bands() const { return int_value(OPTION_RENDER_BANDS); }
+	bool record_async() const { return bool_value(OPTION_RECORD_ASYNC); }
+	bool prescale_async() const { return bool_value(OPTION_PRESCALE_ASYNC); }
+	int prescale_cache() const { return int_value(OPTION_PRESCALE_CACHE); }
+	bool gpu_async() const { return bool_value(OPTION_GPU_ASYNC); }
 
 	// core rotation options
 	bool rotate() const { return bool_value(OPTION_ROTATE); }
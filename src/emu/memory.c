@@ -184,6 +184,7 @@
 #define MEM_DUMP        (0)
 #define VERBOSE         (0)
 #define TEST_HANDLER    (0)
+#define BENCH_HANDLER   (0)
 
 #define VPRINTF(x)  do { if (VERBOSE) printf x; } while (0)
 
@@ -302,6 +303,7 @@ protected:
 
 	// internal helpers
 	void configure_subunits(UINT64 handlermask, int handlerbits, int &start_slot, int &end_slot);
+	bool uniform_subunits(int handlerbits) const;
 	virtual void remove_subunit(int entry) = 0;
 
 	// internal state
@@ -362,10 +364,31 @@ public:
 
 private:
 	// stubs for converting between address sizes
+	void configure_stub(const char *name);
 	UINT16 read_stub_16(address_space &space, offs_t offset, UINT16 mask);
 	UINT32 read_stub_32(address_space &space, offs_t offset, UINT32 mask);
 	UINT64 read_stub_64(address_space &space, offs_t offset, UINT64 mask);
 
+	// stub for the common case where all subunits have the same width
+	template<typename _UintType, typename _SubType>
+	_UintType read_stub_uniform(address_space &space, offs_t offset, _UintType mask)
+	{
+		_UintType result = space.unmap() & m_invsubmask;
+		for (int index = 0; index < m_subunits; index++)
+		{
+			const subunit_info &si = m_subunit_infos[index];
+			_SubType submask = (mask >> si.m_shift) & si.m_mask;
+			if (submask)
+				result |= (_UintType)subread(index, space, offset * si.m_multiplier + si.m_offset, submask) << si.m_shift;
+		}
+		return result;
+	}
+
+	// typed access to the subunit delegates
+	UINT8 subread(int index, address_space &space, offs_t offset, UINT8 mask) const { return m_subread[index].r8(space, offset, mask); }
+	UINT16 subread(int index, address_space &space, offs_t offset, UINT16 mask) const { return m_subread[index].r16(space, offset, mask); }
+	UINT32 subread(int index, address_space &space, offs_t offset, UINT32 mask) const { return m_subread[index].r32(space, offset, mask); }
+
 	// stubs for reading I/O ports
 	template<typename _UintType>
 	_UintType read_stub_ioport(address_space &space, offs_t offset, _UintType mask) { return m_ioport->read(); }
@@ -424,10 +447,29 @@ public:
 
 private:
 	// stubs for converting between address sizes
+	void configure_stub(const char *name);
 	void write_stub_16(address_space &space, offs_t offset, UINT16 data, UINT16 mask);
 	void write_stub_32(address_space &space, offs_t offset, UINT32 data, UINT32 mask);
 	void write_stub_64(address_space &space, offs_t offset, UINT64 data, UINT64 mask);
 
+	// stub for the common case where all subunits have the same width
+	template<typename _UintType, typename _SubType>
+	void write_stub_uniform(address_space &space, offs_t offset, _UintType data, _UintType mask)
+	{
+		for (int index = 0; index < m_subunits; index++)
+		{
+			const subunit_info &si = m_subunit_infos[index];
+			_SubType submask = (mask >> si.m_shift) & si.m_mask;
+			if (submask)
+				subwrite(index, space, offset * si.m_multiplier + si.m_offset, _SubType(data >> si.m_shift), submask);
+		}
+	}
+
+	// typed access to the subunit delegates
+	void subwrite(int index, address_space &space, offs_t offset, UINT8 data, UINT8 mask) const { m_subwrite[index].w8(space, offset, data, mask); }
+	void subwrite(int index, address_space &space, offs_t offset, UINT16 data, UINT16 mask) const { m_subwrite[index].w16(space, offset, data, mask); }
+	void subwrite(int index, address_space &space, offs_t offset, UINT32 data, UINT32 mask) const { m_subwrite[index].w32(space, offset, data, mask); }
+
 	// stubs for writing I/O ports
 	template<typename _UintType>
 	void write_stub_ioport(address_space &space, offs_t offset, _UintType data, _UintType mask) { m_ioport->write(data, mask); }
@@ -992,7 +1034,60 @@ public:
 			printf("                        (0x00ffffffffffffff) = "); printf("%s\n", core_i64_hex_format(result64 = read_qword_unaligned(address, U64(0x00ffffffffffffff)), 16)); assert((result64 & U64(0x00ffffffffffffff)) == (expected64 & U64(0x00ffffffffffffff)));
 		}
 #endif
+#if (BENCH_HANDLER)
+		bench_handlers();
+#endif
+	}
+
+#if (BENCH_HANDLER)
+	// time the common access shapes against some dummy RAM and report ns/access
+	void bench_handlers()
+	{
+		const int iterations = 10000000;
+		static UINT8 buffer[0x100];
+		install_ram(0x00, 0xff, buffer);
+		printf("\naddress_space(%d, %s, %s) timings\n", NATIVE_BITS, (_Endian == ENDIANNESS_LITTLE) ? "little" : "big", _Large ? "large" : "small");
+
+		UINT64 sum = 0;
+		osd_ticks_t start = osd_ticks();
+		for (int iter = 0; iter < iterations; iter++) sum += read_byte(iter & 0xff);
+		bench_report("read_byte", start, iterations);
+		start = osd_ticks();
+		for (int iter = 0; iter < iterations; iter++) write_byte(iter & 0xff, iter);
+		bench_report("write_byte", start, iterations);
+		start = osd_ticks();
+		for (int iter = 0; iter < iterations; iter++) sum += read_word(iter & 0xfe);
+		bench_report("read_word", start, iterations);
+		start = osd_ticks();
+		for (int iter = 0; iter < iterations; iter++) write_word(iter & 0xfe, iter);
+		bench_report("write_word", start, iterations);
+		start = osd_ticks();
+		for (int iter = 0; iter < iterations; iter++) sum += read_word_unaligned(iter & 0xfe);
+		bench_report("read_word_unaligned", start, iterations);
+		start = osd_ticks();
+		for (int iter = 0; iter < iterations; iter++) sum += read_dword(iter & 0xfc);
+		bench_report("read_dword", start, iterations);
+		start = osd_ticks();
+		for (int iter = 0; iter < iterations; iter++) write_dword(iter & 0xfc, iter);
+		bench_report("write_dword", start, iterations);
+		start = osd_ticks();
+		for (int iter = 0; iter < iterations; iter++) sum += read_dword_unaligned(iter & 0xfc);
+		bench_report("read_dword_unaligned", start, iterations);
+		start = osd_ticks();
+		for (int iter = 0; iter < iterations; iter++) sum += read_qword(iter & 0xf8);
+		bench_report("read_qword", start, iterations);
+		start = osd_ticks();
+		for (int iter = 0; iter < iterations; iter++) write_qword(iter & 0xf8, iter);
+		bench_report("write_qword", start, iterations);
+		printf("   (checksum %s)\n", core_i64_hex_format(sum, 16));
+	}
+
+	static void bench_report(const char *name, osd_ticks_t start, int iterations)
+	{
+		double elapsed = (double)(osd_ticks() - start) / (double)osd_ticks_per_second();
+		printf("   %-24s %6.2f ns/access\n", name, elapsed * 1e9 / (double)iterations);
 	}
+#endif
 
 	// accessors
 	virtual address_table_read &read() { return m_read; }
@@ -1146,6 +1241,71 @@ public:
 		g_profiler.stop();
 	}
 
+	// aligned read of a single lane narrower than the native width
+	template<typename _TargetType>
+	_TargetType read_native_lane(offs_t address, _TargetType mask)
+	{
+		const UINT32 TARGET_BYTES = sizeof(_TargetType);
+		const UINT32 LANE_XOR = (_Endian == ENDIANNESS_NATIVE) ? 0 : (NATIVE_BYTES - TARGET_BYTES);
+
+		g_profiler.start(PROFILER_MEMREAD);
+
+		// look up the handler for the native word containing the lane
+		offs_t byteaddress = address & m_bytemask & ~NATIVE_MASK;
+		UINT32 entry = read_lookup(byteaddress);
+		const handler_entry_read &handler = m_read.handler_read(entry);
+
+		// RAM, ROM and banks are read directly at the lane's width; delegates get a shifted mask
+		offs_t offset = handler.byteoffset(byteaddress);
+		UINT32 lane = address & (NATIVE_BYTES - TARGET_BYTES);
+		_TargetType result;
+		if (entry <= STATIC_BANKMAX) result = *reinterpret_cast<_TargetType *>(handler.ramptr(offset + (lane ^ LANE_XOR)));
+		else
+		{
+			UINT32 offsbits = 8 * ((_Endian == ENDIANNESS_LITTLE) ? lane : (NATIVE_BYTES - TARGET_BYTES - lane));
+			_NativeType nativemask = (_NativeType)mask << offsbits;
+			if (sizeof(_NativeType) == 2) result = handler.read16(*this, offset >> 1, nativemask) >> offsbits;
+			else if (sizeof(_NativeType) == 4) result = handler.read32(*this, offset >> 2, nativemask) >> offsbits;
+			else result = handler.read64(*this, offset >> 3, nativemask) >> offsbits;
+		}
+
+		g_profiler.stop();
+		return result;
+	}
+
+	// aligned write of a single lane narrower than the native width
+	template<typename _TargetType>
+	void write_native_lane(offs_t address, _TargetType data, _TargetType mask)
+	{
+		const UINT32 TARGET_BYTES = sizeof(_TargetType);
+		const UINT32 LANE_XOR = (_Endian == ENDIANNESS_NATIVE) ? 0 : (NATIVE_BYTES - TARGET_BYTES);
+
+		g_profiler.start(PROFILER_MEMWRITE);
+
+		// look up the handler for the native word containing the lane
+		offs_t byteaddress = address & m_bytemask & ~NATIVE_MASK;
+		UINT32 entry = write_lookup(byteaddress);
+		const handler_entry_write &handler = m_write.handler_write(entry);
+
+		// RAM and banks are written directly at the lane's width; delegates get shifted data and mask
+		offs_t offset = handler.byteoffset(byteaddress);
+		UINT32 lane = address & (NATIVE_BYTES - TARGET_BYTES);
+		if (entry <= STATIC_BANKMAX)
+		{
+			_TargetType *dest = reinterpret_cast<_TargetType *>(handler.ramptr(offset + (lane ^ LANE_XOR)));
+			*dest = (*dest & ~mask) | (data & mask);
+		}
+		else
+		{
+			UINT32 offsbits = 8 * ((_Endian == ENDIANNESS_LITTLE) ? lane : (NATIVE_BYTES - TARGET_BYTES - lane));
+			if (sizeof(_NativeType) == 2) handler.write16(*this, offset >> 1, (_NativeType)data << offsbits, (_NativeType)mask << offsbits);
+			else if (sizeof(_NativeType) == 4) handler.write32(*this, offset >> 2, (_NativeType)data << offsbits, (_NativeType)mask << offsbits);
+			else handler.write64(*this, offset >> 3, (_NativeType)data << offsbits, (_NativeType)mask << offsbits);
+		}
+
+		g_profiler.stop();
+	}
+
 	// generic direct read
 	template<typename _TargetType, bool _Aligned>
 	_TargetType read_direct(offs_t address, _TargetType mask)
@@ -1160,8 +1320,11 @@ public:
 		// if native size is larger, see if we can do a single masked read (guaranteed if we're aligned)
 		if (NATIVE_BYTES > TARGET_BYTES)
 		{
-			UINT32 offsbits = 8 * (address & (NATIVE_BYTES - (_Aligned ? TARGET_BYTES : 1)));
-			if (_Aligned || (offsbits + TARGET_BITS <= NATIVE_BITS))
+			if (_Aligned)
+				return read_native_lane<_TargetType>(address, mask);
+
+			UINT32 offsbits = 8 * (address & (NATIVE_BYTES - 1));
+			if (offsbits + TARGET_BITS <= NATIVE_BITS)
 			{
 				if (_Endian != ENDIANNESS_LITTLE) offsbits = NATIVE_BITS - TARGET_BITS - offsbits;
 				return read_native(address & ~NATIVE_MASK, (_NativeType)mask << offsbits) >> offsbits;
@@ -1288,8 +1451,11 @@ public:
 		// if native size is larger, see if we can do a single masked write (guaranteed if we're aligned)
 		if (NATIVE_BYTES > TARGET_BYTES)
 		{
-			UINT32 offsbits = 8 * (address & (NATIVE_BYTES - (_Aligned ? TARGET_BYTES : 1)));
-			if (_Aligned || (offsbits + TARGET_BITS <= NATIVE_BITS))
+			if (_Aligned)
+				return write_native_lane<_TargetType>(address, data, mask);
+
+			UINT32 offsbits = 8 * (address & (NATIVE_BYTES - 1));
+			if (offsbits + TARGET_BITS <= NATIVE_BITS)
 			{
 				if (_Endian != ENDIANNESS_LITTLE) offsbits = NATIVE_BITS - TARGET_BITS - offsbits;
 				return write_native(address & ~NATIVE_MASK, (_NativeType)data << offsbits, (_NativeType)mask << offsbits);
@@ -3672,7 +3838,8 @@ direct_read_data::direct_read_data(address_space &space)
 		m_bytemask(space.bytemask()),
 		m_bytestart(1),
 		m_byteend(0),
-		m_entry(STATIC_UNMAP)
+		m_entry(STATIC_UNMAP),
+		m_generation(0)
 {
 }
 
@@ -3773,6 +3940,9 @@ direct_read_data::direct_range *direct_read_data::find_range(offs_t byteaddress,
 
 void direct_read_data::remove_intersecting_ranges(offs_t bytestart, offs_t byteend)
 {
+	// anything decoded from this range is now suspect
+	m_generation++;
+
 	// loop over all entries
 	for (int entry = 0; entry < ARRAY_LENGTH(m_rangelist); entry++)
 	{
@@ -4264,6 +4434,20 @@ void handler_entry::configure_subunits(UINT64 handlermask, int handlerbits, int
 }
 
 
+//-------------------------------------------------
+//  uniform_subunits - return true if all the
+//  subunits have the given width
+//-------------------------------------------------
+
+bool handler_entry::uniform_subunits(int handlerbits) const
+{
+	for (int i = 0; i < m_subunits; i++)
+		if (m_subunit_infos[i].m_size != handlerbits)
+			return false;
+	return true;
+}
+
+
 //-------------------------------------------------
 //  clear_conflicting_subunits - clear the subunits
 //  conflicting with the provided mask
@@ -4451,12 +4635,7 @@ void handler_entry_read::set_delegate(read8_delegate delegate, UINT64 mask)
 		{
 			m_subread[i].r8 = delegate;
 		}
-		if (m_datawidth == 16)
-			set_delegate(read16_delegate(&handler_entry_read::read_stub_16, delegate.name(), this));
-		else if (m_datawidth == 32)
-			set_delegate(read32_delegate(&handler_entry_read::read_stub_32, delegate.name(), this));
-		else if (m_datawidth == 64)
-			set_delegate(read64_delegate(&handler_entry_read::read_stub_64, delegate.name(), this));
+		configure_stub(delegate.name());
 	}
 	else
 	{
@@ -4488,10 +4667,7 @@ void handler_entry_read::set_delegate(read16_delegate delegate, UINT64 mask)
 		{
 			m_subread[i].r16 = delegate;
 		}
-		if (m_datawidth == 32)
-			set_delegate(read32_delegate(&handler_entry_read::read_stub_32, delegate.name(), this));
-		else if (m_datawidth == 64)
-			set_delegate(read64_delegate(&handler_entry_read::read_stub_64, delegate.name(), this));
+		configure_stub(delegate.name());
 	}
 	else
 	{
@@ -4523,8 +4699,7 @@ void handler_entry_read::set_delegate(read32_delegate delegate, UINT64 mask)
 		{
 			m_subread[i].r32 = delegate;
 		}
-		if (m_datawidth == 64)
-			set_delegate(read64_delegate(&handler_entry_read::read_stub_64, delegate.name(), this));
+		configure_stub(delegate.name());
 	}
 	else
 	{
@@ -4568,6 +4743,42 @@ void handler_entry_read::set_ioport(ioport_port &ioport)
 }
 
 
+//-------------------------------------------------
+//  configure_stub - install the stub matching
+//  our width and the current set of subunits
+//-------------------------------------------------
+
+void handler_entry_read::configure_stub(const char *name)
+{
+	switch (m_datawidth)
+	{
+	case 16:
+		set_delegate(read16_delegate(&handler_entry_read::read_stub_16, name, this));
+		break;
+
+	case 32:
+		if (uniform_subunits(8))
+			set_delegate(read32_delegate(&handler_entry_read::read_stub_uniform<UINT32, UINT8>, name, this));
+		else if (uniform_subunits(16))
+			set_delegate(read32_delegate(&handler_entry_read::read_stub_uniform<UINT32, UINT16>, name, this));
+		else
+			set_delegate(read32_delegate(&handler_entry_read::read_stub_32, name, this));
+		break;
+
+	case 64:
+		if (uniform_subunits(8))
+			set_delegate(read64_delegate(&handler_entry_read::read_stub_uniform<UINT64, UINT8>, name, this));
+		else if (uniform_subunits(16))
+			set_delegate(read64_delegate(&handler_entry_read::read_stub_uniform<UINT64, UINT16>, name, this));
+		else if (uniform_subunits(32))
+			set_delegate(read64_delegate(&handler_entry_read::read_stub_uniform<UINT64, UINT32>, name, this));
+		else
+			set_delegate(read64_delegate(&handler_entry_read::read_stub_64, name, this));
+		break;
+	}
+}
+
+
 //-------------------------------------------------
 //  read_stub_16 - construct a 16-bit read from
 //  8-bit sources
@@ -4760,12 +4971,7 @@ void handler_entry_write::set_delegate(write8_delegate delegate, UINT64 mask)
 		{
 			m_subwrite[i].w8 = delegate;
 		}
-		if (m_datawidth == 16)
-			set_delegate(write16_delegate(&handler_entry_write::write_stub_16, delegate.name(), this));
-		else if (m_datawidth == 32)
-			set_delegate(write32_delegate(&handler_entry_write::write_stub_32, delegate.name(), this));
-		else if (m_datawidth == 64)
-			set_delegate(write64_delegate(&handler_entry_write::write_stub_64, delegate.name(), this));
+		configure_stub(delegate.name());
 	}
 	else
 	{
@@ -4792,10 +4998,7 @@ void handler_entry_write::set_delegate(write16_delegate delegate, UINT64 mask)
 		{
 			m_subwrite[i].w16 = delegate;
 		}
-		if (m_datawidth == 32)
-			set_delegate(write32_delegate(&handler_entry_write::write_stub_32, delegate.name(), this));
-		else if (m_datawidth == 64)
-			set_delegate(write64_delegate(&handler_entry_write::write_stub_64, delegate.name(), this));
+		configure_stub(delegate.name());
 	}
 	else
 	{
@@ -4822,8 +5025,7 @@ void handler_entry_write::set_delegate(write32_delegate delegate, UINT64 mask)
 		{
 			m_subwrite[i].w32 = delegate;
 		}
-		if (m_datawidth == 64)
-			set_delegate(write64_delegate(&handler_entry_write::write_stub_64, delegate.name(), this));
+		configure_stub(delegate.name());
 	}
 	else
 	{
@@ -4862,6 +5064,42 @@ void handler_entry_write::set_ioport(ioport_port &ioport)
 }
 
 
+//-------------------------------------------------
+//  configure_stub - install the stub matching
+//  our width and the current set of subunits
+//-------------------------------------------------
+
+void handler_entry_write::configure_stub(const char *name)
+{
+	switch (m_datawidth)
+	{
+	case 16:
+		set_delegate(write16_delegate(&handler_entry_write::write_stub_16, name, this));
+		break;
+
+	case 32:
+		if (uniform_subunits(8))
+			set_delegate(write32_delegate(&handler_entry_write::write_stub_uniform<UINT32, UINT8>, name, this));
+		else if (uniform_subunits(16))
+			set_delegate(write32_delegate(&handler_entry_write::write_stub_uniform<UINT32, UINT16>, name, this));
+		else
+			set_delegate(write32_delegate(&handler_entry_write::write_stub_32, name, this));
+		break;
+
+	case 64:
+		if (uniform_subunits(8))
+			set_delegate(write64_delegate(&handler_entry_write::write_stub_uniform<UINT64, UINT8>, name, this));
+		else if (uniform_subunits(16))
+			set_delegate(write64_delegate(&handler_entry_write::write_stub_uniform<UINT64, UINT16>, name, this));
+		else if (uniform_subunits(32))
+			set_delegate(write64_delegate(&handler_entry_write::write_stub_uniform<UINT64, UINT32>, name, this));
+		else
+			set_delegate(write64_delegate(&handler_entry_write::write_stub_64, name, this));
+		break;
+	}
+}
+
+
 //-------------------------------------------------
 //  write_stub_16 - construct a 16-bit write from
 //  8-bit sources
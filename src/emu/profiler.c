@@ -80,6 +80,7 @@ real_profiler_state::real_profiler_state()
 {
 	memset(m_filo, 0, sizeof(m_filo));
 	memset(m_data, 0, sizeof(m_data));
+	memset(m_count, 0, sizeof(m_count));
 	reset(false);
 }
 
@@ -158,6 +159,10 @@ void real_profiler_state::update_text(running_machine &machine)
 		{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
 		{ PROFILER_INPUT,            "Input Processing" },
 		{ PROFILER_MOVIE_REC,        "Movie Recording" },
+		{ PROFILER_LAYOUT,           "Layout Composition" },
+		{ PROFILER_3D_GEOMETRY,      "3D Geometry" },
+		{ PROFILER_3D_SETUP,         "3D Triangle Setup" },
+		{ PROFILER_3D_RASTER_WAIT,   "3D Raster Wait" },
 		{ PROFILER_LOGERROR,         "Error Logging" },
 		{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
 		{ PROFILER_USER1,            "User 1" },
@@ -224,6 +229,11 @@ void real_profiler_state::update_text(running_machine &machine)
 		}
 	}
 
+	// add the event counters
+	if (m_count[PROFILER_COUNT_PARTIAL_REQUEST] != 0)
+		m_text.catprintf("Partial Updates: %d requested, %d rendered\n", m_count[PROFILER_COUNT_PARTIAL_REQUEST], m_count[PROFILER_COUNT_PARTIAL_RENDER]);
+
 	// reset data set to 0
 	memset(m_data, 0, sizeof(m_data));
+	memset(m_count, 0, sizeof(m_count));
 }
@@ -53,6 +53,10 @@ enum profile_type
 	PROFILER_TIMER_CALLBACK,
 	PROFILER_INPUT,             // input.c and inptport.c
 	PROFILER_MOVIE_REC,         // movie recording
+	PROFILER_LAYOUT,            // layout view composition
+	PROFILER_3D_GEOMETRY,       // 3D display list traversal and vertex transform
+	PROFILER_3D_SETUP,          // 3D triangle setup and submission
+	PROFILER_3D_RASTER_WAIT,    // waiting for 3D rasterization to finish
 	PROFILER_LOGERROR,          // logerror
 	PROFILER_EXTRA,             // everything else
 
@@ -74,6 +78,15 @@ enum profile_type
 DECLARE_ENUM_OPERATORS(profile_type);
 
 
+// event counters shown alongside the timing data
+enum profile_counter
+{
+	PROFILER_COUNT_PARTIAL_REQUEST,     // screen partial updates requested
+	PROFILER_COUNT_PARTIAL_RENDER,      // screen partial updates actually rendered
+	PROFILER_COUNT_TOTAL
+};
+
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -112,6 +125,9 @@ public:
 	void start(profile_type type) { if (enabled()) real_start(type); }
 	void stop() { if (enabled()) real_stop(); }
 
+	// event counting
+	void count(profile_counter counter) { if (enabled()) m_count[counter]++; }
+
 private:
 	void reset(bool enabled);
 	void update_text(running_machine &machine);
@@ -175,6 +191,7 @@ private:
 	attotime            m_text_time;                // profiler text last update
 	filo_entry          m_filo[32];                 // array of FILO entries
 	osd_ticks_t         m_data[PROFILER_TOTAL + 1]; // array of data
+	UINT32              m_count[PROFILER_COUNT_TOTAL];// array of event counts
 };
 
 
@@ -196,6 +213,9 @@ public:
 	// start/stop
 	void start(profile_type type) { }
 	void stop() { }
+
+	// event counting
+	void count(profile_counter counter) { }
 };
 
 
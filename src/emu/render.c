@@ -422,9 +422,14 @@ render_texture::render_texture()
 		m_bitmap(NULL),
 		m_format(TEXFORMAT_ARGB32),
 		m_osddata(~0L),
+		m_track_dirty(false),
+		m_dirty(true),
+		m_dirty_seqid(0),
 		m_scaler(NULL),
 		m_param(NULL),
-		m_curseq(0)
+		m_curseq(0),
+		m_scale_item(NULL),
+		m_scale_bitmap(NULL)
 {
 	m_sbounds.set(0, -1, 0, -1);
 	memset(m_scaled, 0, sizeof(m_scaled));
@@ -456,6 +461,8 @@ void render_texture::reset(render_manager &manager, texture_scaler_func scaler,
 		m_param = param;
 	}
 	m_osddata = ~0L;
+	m_track_dirty = false;
+	m_dirty = true;
 }
 
 
@@ -466,13 +473,9 @@ void render_texture::reset(render_manager &manager, texture_scaler_func scaler,
 void render_texture::release()
 {
 	// free all scaled versions
+	cancel_async_scale();
 	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-	{
-		m_manager->invalidate_all(m_scaled[scalenum].bitmap);
-		global_free(m_scaled[scalenum].bitmap);
-		m_scaled[scalenum].bitmap = NULL;
-		m_scaled[scalenum].seqid = 0;
-	}
+		free_scaled(m_scaled[scalenum]);
 
 	// invalidate references to the original bitmap as well
 	m_manager->invalidate_all(m_bitmap);
@@ -495,6 +498,9 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	if (format == TEXFORMAT_PALETTE16 || format == TEXFORMAT_PALETTEA16)
 		assert(bitmap.palette() != NULL);
 
+	// any scale in progress is working from the old source
+	cancel_async_scale();
+
 	// invalidate references to the old bitmap
 	if (&bitmap != m_bitmap && m_bitmap != NULL)
 		m_manager->invalidate_all(m_bitmap);
@@ -503,18 +509,11 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	m_bitmap = &bitmap;
 	m_sbounds = sbounds;
 	m_format = format;
+	m_dirty = true;
 
 	// invalidate all scaled versions
 	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-	{
-		if (m_scaled[scalenum].bitmap != NULL)
-		{
-			m_manager->invalidate_all(m_scaled[scalenum].bitmap);
-			global_free(m_scaled[scalenum].bitmap);
-		}
-		m_scaled[scalenum].bitmap = NULL;
-		m_scaled[scalenum].seqid = 0;
-	}
+		free_scaled(m_scaled[scalenum]);
 }
 
 
@@ -558,63 +557,245 @@ void render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 		texinfo.height = sheight;
 		// will be set later
 		texinfo.set_palette(NULL);
-		texinfo.seqid = ++m_curseq;
+
+		// untracked textures may have changed behind our back, so always look new
+		if (!m_track_dirty || m_dirty)
+		{
+			m_dirty_seqid = ++m_curseq;
+			m_dirty = false;
+		}
+		texinfo.seqid = m_dirty_seqid;
 	}
 	else
 	{
-		// make sure we can recover the original argb32 bitmap
-		bitmap_argb32 dummy;
-		bitmap_argb32 &srcbitmap = (m_bitmap != NULL) ? downcast<bitmap_argb32 &>(*m_bitmap) : dummy;
+		// pick up the result of a background scale if it has finished
+		finish_async_scale(primlist, false);
 
 		// is it a size we already have?
-		scaled_texture *scaled = NULL;
-		int scalenum;
-		for (scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-		{
-			scaled = &m_scaled[scalenum];
+		scaled_texture *scaled = find_scaled(dwidth, dheight);
 
-			// we need a non-NULL bitmap with matching dest size
-			if (scaled->bitmap != NULL && dwidth == scaled->bitmap->width() && dheight == scaled->bitmap->height())
-				break;
+		// if not, keep using our most recent scale while the new size is made in the background
+		if (scaled == NULL && m_manager->m_scale_queue != NULL)
+		{
+			scaled = find_recent_scaled();
+			if (scaled != NULL && m_scale_item == NULL && !queue_async_scale(dwidth, dheight))
+				scaled = NULL;
 		}
 
-		// did we get one?
-		if (scalenum == ARRAY_LENGTH(m_scaled))
+		// with nothing to show, we have to scale now
+		if (scaled == NULL)
 		{
-			int lowest = -1;
-
-			// didn't find one -- take the entry with the lowest seqnum
-			for (scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-				if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !primlist.has_reference(m_scaled[scalenum].bitmap))
-					lowest = scalenum;
-			assert_always(lowest != -1, "Too many live texture instances!");
+			// the size we want might already be on its way
+			finish_async_scale(primlist, true);
+			scaled = find_scaled(dwidth, dheight);
+		}
+		if (scaled == NULL)
+		{
+			// make sure we can recover the original argb32 bitmap
+			bitmap_argb32 dummy;
+			bitmap_argb32 &srcbitmap = (m_bitmap != NULL) ? downcast<bitmap_argb32 &>(*m_bitmap) : dummy;
 
-			// throw out any existing entries
-			scaled = &m_scaled[lowest];
-			if (scaled->bitmap != NULL)
-			{
-				m_manager->invalidate_all(scaled->bitmap);
-				global_free(scaled->bitmap);
-			}
+			// scalers are never run concurrently, so let any background ones finish first
+			if (m_manager->m_scale_queue != NULL)
+				osd_work_queue_wait(m_manager->m_scale_queue, osd_ticks_per_second() * 10);
 
 			// allocate a new bitmap
+			scaled = &alloc_scaled(primlist);
 			scaled->bitmap = global_alloc(bitmap_argb32(dwidth, dheight));
 			scaled->seqid = ++m_curseq;
+			m_manager->m_scaled_bytes += (UINT64)dwidth * dheight * 4;
 
 			// let the scaler do the work
 			(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
 		}
 
 		// finally fill out the new info
+		scaled->lastuse = ++m_manager->m_scale_clock;
 		primlist.add_reference(scaled->bitmap);
 		texinfo.base = &scaled->bitmap->pix32(0);
 		texinfo.rowpixels = scaled->bitmap->rowpixels();
-		texinfo.width = dwidth;
-		texinfo.height = dheight;
+		texinfo.width = scaled->bitmap->width();
+		texinfo.height = scaled->bitmap->height();
 		// will be set later
 		texinfo.set_palette(NULL);
 		texinfo.seqid = scaled->seqid;
+
+		// keep the cache within its memory limit
+		if (m_manager->m_scaled_limit != 0 && m_manager->m_scaled_bytes > m_manager->m_scaled_limit)
+			m_manager->trim_scaled_textures(primlist);
+	}
+}
+
+
+//-------------------------------------------------
+//  prescale - start a background scale to the
+//  given size ahead of it being drawn
+//-------------------------------------------------
+
+void render_texture::prescale(UINT32 dwidth, UINT32 dheight)
+{
+	// only scaled textures with nothing else pending can do this
+	if (m_scaler == NULL || m_manager->m_scale_queue == NULL || m_scale_item != NULL)
+		return;
+
+	// ensure height/width are non-zero
+	if (dwidth < 1) dwidth = 1;
+	if (dheight < 1) dheight = 1;
+
+	// skip sizes we already have, and sizes that draw straight from the source
+	if (find_scaled(dwidth, dheight) != NULL || (m_bitmap != NULL && m_sbounds.width() == dwidth && m_sbounds.height() == dheight))
+		return;
+
+	// synchronous scales wait for the queue, so don't let guesses pile up in it
+	if (osd_work_queue_items(m_manager->m_scale_queue) >= MAX_PRESCALE_PENDING)
+		return;
+	queue_async_scale(dwidth, dheight);
+}
+
+
+//-------------------------------------------------
+//  find_scaled - find a scaled entry of the
+//  given size
+//-------------------------------------------------
+
+render_texture::scaled_texture *render_texture::find_scaled(UINT32 dwidth, UINT32 dheight)
+{
+	// we need a non-NULL bitmap with matching dest size
+	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+		if (m_scaled[scalenum].bitmap != NULL && dwidth == m_scaled[scalenum].bitmap->width() && dheight == m_scaled[scalenum].bitmap->height())
+			return &m_scaled[scalenum];
+	return NULL;
+}
+
+
+//-------------------------------------------------
+//  find_recent_scaled - find the most recently
+//  used scaled entry of any size
+//-------------------------------------------------
+
+render_texture::scaled_texture *render_texture::find_recent_scaled()
+{
+	scaled_texture *recent = NULL;
+	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+		if (m_scaled[scalenum].bitmap != NULL && (recent == NULL || m_scaled[scalenum].lastuse > recent->lastuse))
+			recent = &m_scaled[scalenum];
+	return recent;
+}
+
+
+//-------------------------------------------------
+//  alloc_scaled - free up the least recently
+//  used scaled entry not referenced by the given
+//  primitive list and return it
+//-------------------------------------------------
+
+render_texture::scaled_texture &render_texture::alloc_scaled(render_primitive_list &primlist)
+{
+	int lowest = -1;
+
+	// take the entry with the lowest seqnum
+	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+		if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !primlist.has_reference(m_scaled[scalenum].bitmap))
+			lowest = scalenum;
+	assert_always(lowest != -1, "Too many live texture instances!");
+
+	// throw out any existing entries
+	free_scaled(m_scaled[lowest]);
+	return m_scaled[lowest];
+}
+
+
+//-------------------------------------------------
+//  free_scaled - release a scaled entry
+//-------------------------------------------------
+
+void render_texture::free_scaled(scaled_texture &scaled)
+{
+	if (scaled.bitmap != NULL)
+	{
+		m_manager->invalidate_all(scaled.bitmap);
+		m_manager->m_scaled_bytes -= (UINT64)scaled.bitmap->width() * scaled.bitmap->height() * 4;
+		global_free(scaled.bitmap);
+	}
+	scaled.bitmap = NULL;
+	scaled.seqid = 0;
+	scaled.lastuse = 0;
+}
+
+
+//-------------------------------------------------
+//  queue_async_scale - start scaling to the given
+//  size in the background
+//-------------------------------------------------
+
+bool render_texture::queue_async_scale(UINT32 dwidth, UINT32 dheight)
+{
+	m_scale_bitmap = global_alloc(bitmap_argb32(dwidth, dheight));
+	m_scale_item = osd_work_item_queue(m_manager->m_scale_queue, async_scale_static, this, 0);
+	if (m_scale_item == NULL)
+	{
+		global_free(m_scale_bitmap);
+		m_scale_bitmap = NULL;
+		return false;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  finish_async_scale - move a completed
+//  background scale into the scaled entries
+//-------------------------------------------------
+
+void render_texture::finish_async_scale(render_primitive_list &primlist, bool wait)
+{
+	// nothing to do if nothing is pending or it isn't done yet
+	if (m_scale_item == NULL || !osd_work_item_wait(m_scale_item, wait ? (osd_ticks_per_second() * 10) : 0))
+		return;
+	osd_work_item_release(m_scale_item);
+	m_scale_item = NULL;
+
+	// the new bitmap replaces the least recently used entry
+	scaled_texture &scaled = alloc_scaled(primlist);
+	scaled.bitmap = m_scale_bitmap;
+	scaled.seqid = ++m_curseq;
+	m_manager->m_scaled_bytes += (UINT64)m_scale_bitmap->width() * m_scale_bitmap->height() * 4;
+	m_scale_bitmap = NULL;
+}
+
+
+//-------------------------------------------------
+//  cancel_async_scale - wait for any background
+//  scale and throw away the result
+//-------------------------------------------------
+
+void render_texture::cancel_async_scale()
+{
+	if (m_scale_item != NULL)
+	{
+		osd_work_item_wait(m_scale_item, osd_ticks_per_second() * 10);
+		osd_work_item_release(m_scale_item);
+		m_scale_item = NULL;
 	}
+	global_free(m_scale_bitmap);
+	m_scale_bitmap = NULL;
+}
+
+
+//-------------------------------------------------
+//  async_scale_static - work item callback for
+//  scaling a texture in the background
+//-------------------------------------------------
+
+void *render_texture::async_scale_static(void *param, int threadid)
+{
+	render_texture *texture = reinterpret_cast<render_texture *>(param);
+
+	// make sure we can recover the original argb32 bitmap
+	bitmap_argb32 dummy;
+	bitmap_argb32 &srcbitmap = (texture->m_bitmap != NULL) ? downcast<bitmap_argb32 &>(*texture->m_bitmap) : dummy;
+	(*texture->m_scaler)(*texture->m_scale_bitmap, srcbitmap, texture->m_sbounds, texture->m_param);
+	return NULL;
 }
 
 
@@ -909,6 +1090,11 @@ void render_container::recompute_lookups()
 		m_bcglookup256[i + 0x300] = adjustedval << 24;
 	}
 
+	// the adjusted colors of everything we hold change with the lookups
+	for (item *curitem = m_itemlist.first(); curitem != NULL; curitem = curitem->next())
+		if (curitem->texture() != NULL)
+			curitem->texture()->mark_dirty();
+
 	// recompute the palette entries
 	if (m_palclient != NULL)
 	{
@@ -1374,6 +1560,7 @@ render_primitive_list &render_target::get_primitives()
 	root_xform.no_center = false;
 
 	// iterate over layers back-to-front, but only if we're running
+	g_profiler.start(PROFILER_LAYOUT);
 	if (m_manager.machine().phase() >= MACHINE_PHASE_RESET)
 		for (item_layer layernum = ITEM_LAYER_FIRST; layernum < ITEM_LAYER_MAX; layernum++)
 		{
@@ -1431,6 +1618,7 @@ render_primitive_list &render_target::get_primitives()
 			list.append(*prim);
 		}
 	}
+	g_profiler.stop();
 
 	// process the debug containers
 	for (render_container *debug = m_debug_containers.first(); debug != NULL; debug = debug->next())
@@ -1929,6 +2117,9 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 
 		texture->get_scaled(width, height, prim->texture, list);
 
+		// let the neighbouring states render in the background
+		element.prescale_states(state, width, height);
+
 		// compute the clip rect
 		render_bounds cliprect;
 		cliprect.x0 = render_round_nearest(xform.xoffs);
@@ -2470,8 +2661,16 @@ render_manager::render_manager(running_machine &machine)
 	: m_machine(machine),
 		m_ui_target(NULL),
 		m_live_textures(0),
+		m_scale_queue(NULL),
+		m_scale_clock(0),
+		m_scaled_bytes(0),
+		m_scaled_limit((UINT64)machine.options().prescale_cache() << 20),
 		m_ui_container(global_alloc(render_container(*this)))
 {
+	// scaled textures can be made on a worker thread; one thread keeps the scalers single-threaded
+	if (machine.options().prescale_async())
+		m_scale_queue = osd_work_queue_alloc(0);
+
 	// register callbacks
 	config_register(machine, "video", config_saveload_delegate(FUNC(render_manager::config_load), this), config_saveload_delegate(FUNC(render_manager::config_save), this));
 
@@ -2492,8 +2691,13 @@ render_manager::~render_manager()
 	container_free(m_ui_container);
 	m_screen_container_list.reset();
 
+	// free the targets now, since their layouts may still be scaling textures
+	m_targetlist.reset();
+
 	// better not be any outstanding textures when we die
 	assert(m_live_textures == 0);
+	if (m_scale_queue != NULL)
+		osd_work_queue_free(m_scale_queue);
 }
 
 
@@ -2607,6 +2811,7 @@ render_texture *render_manager::texture_alloc(texture_scaler_func scaler, void *
 	// allocate a new texture and reset it
 	render_texture *tex = m_texture_allocator.alloc();
 	tex->reset(*this, scaler, param);
+	m_texture_list.append(*tex);
 	m_live_textures++;
 	return tex;
 }
@@ -2622,11 +2827,44 @@ void render_manager::texture_free(render_texture *texture)
 	{
 		m_live_textures--;
 		texture->release();
+		m_texture_list.detach(*texture);
 	}
 	m_texture_allocator.reclaim(texture);
 }
 
 
+//-------------------------------------------------
+//  trim_scaled_textures - free least recently
+//  used scaled textures until we are within the
+//  memory limit
+//-------------------------------------------------
+
+void render_manager::trim_scaled_textures(render_primitive_list &primlist)
+{
+	while (m_scaled_bytes > m_scaled_limit)
+	{
+		// find the oldest entry across all textures that isn't in use this frame
+		render_texture *oldtex = NULL;
+		render_texture::scaled_texture *oldest = NULL;
+		for (render_texture *tex = m_texture_list.first(); tex != NULL; tex = tex->m_next)
+			for (int scalenum = 0; scalenum < ARRAY_LENGTH(tex->m_scaled); scalenum++)
+			{
+				render_texture::scaled_texture &scaled = tex->m_scaled[scalenum];
+				if (scaled.bitmap != NULL && (oldest == NULL || scaled.lastuse < oldest->lastuse) && !primlist.has_reference(scaled.bitmap))
+				{
+					oldtex = tex;
+					oldest = &scaled;
+				}
+			}
+
+		// stop if everything left is needed
+		if (oldest == NULL)
+			break;
+		oldtex->free_scaled(*oldest);
+	}
+}
+
+
 //-------------------------------------------------
 //  font_alloc - allocate a new font instance
 //-------------------------------------------------
@@ -459,6 +459,13 @@ public:
 	// set any necessary aux data
 	void set_osd_data(UINT64 data) { m_osddata = data; }
 
+	// dirty tracking: a tracking texture keeps its sequence number until its contents change
+	void set_dirty_tracking(bool track = true) { m_track_dirty = track; m_dirty = true; }
+	void mark_dirty() { m_dirty = true; }
+
+	// start scaling to the given size in the background, so a later draw finds it ready
+	void prescale(UINT32 dwidth, UINT32 dheight);
+
 	// generic high-quality bitmap scaler
 	static void hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 
@@ -468,14 +475,26 @@ private:
 	const dynamic_array<rgb_t> *get_adjusted_palette(render_container &container);
 
 	static const int MAX_TEXTURE_SCALES = 8;
+	static const int MAX_PRESCALE_PENDING = 4;
 
 	// a scaled_texture contains a single scaled entry for a texture
 	struct scaled_texture
 	{
 		bitmap_argb32 *     bitmap;                 // final bitmap
 		UINT32              seqid;                  // sequence number
+		UINT32              lastuse;                // manager clock at last use
 	};
 
+	// scaled entry management
+	scaled_texture *find_scaled(UINT32 dwidth, UINT32 dheight);
+	scaled_texture *find_recent_scaled();
+	scaled_texture &alloc_scaled(render_primitive_list &primlist);
+	void free_scaled(scaled_texture &scaled);
+	bool queue_async_scale(UINT32 dwidth, UINT32 dheight);
+	void finish_async_scale(render_primitive_list &primlist, bool wait);
+	void cancel_async_scale();
+	static void *async_scale_static(void *param, int threadid);
+
 	// internal state
 	render_manager *    m_manager;                  // reference to our manager
 	render_texture *    m_next;                     // next texture (for free list)
@@ -483,12 +502,17 @@ private:
 	rectangle           m_sbounds;                  // source bounds within the bitmap
 	texture_format      m_format;                   // format of the texture data
 	UINT64              m_osddata;                  // aux data to pass to osd
+	bool                m_track_dirty;              // only change seqid when marked dirty?
+	bool                m_dirty;                    // have the contents changed since the last seqid?
+	UINT32              m_dirty_seqid;              // seqid of the current contents
 
 	// scaling state (ARGB32 only)
 	texture_scaler_func m_scaler;                   // scaling callback
 	void *              m_param;                    // scaling callback parameter
 	UINT32              m_curseq;                   // current sequence number
 	scaled_texture      m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
+	osd_work_item *     m_scale_item;               // pending asynchronous scale, or NULL
+	bitmap_argb32 *     m_scale_bitmap;             // bitmap the pending scale is drawing into
 };
 
 
@@ -753,6 +777,7 @@ private:
 class render_manager
 {
 	friend class render_target;
+	friend class render_texture;
 
 public:
 	// construction/destruction
@@ -761,6 +786,7 @@ public:
 
 	// getters
 	running_machine &machine() const { return m_machine; }
+	bool async_scaling() const { return m_scale_queue != NULL; }
 
 	// global queries
 	bool is_live(screen_device &screen) const;
@@ -800,6 +826,9 @@ private:
 	void config_load(int config_type, xml_data_node *parentnode);
 	void config_save(int config_type, xml_data_node *parentnode);
 
+	// scaled texture cache
+	void trim_scaled_textures(render_primitive_list &primlist);
+
 	// internal state
 	running_machine &               m_machine;          // reference back to the machine
 
@@ -809,8 +838,15 @@ private:
 
 	// texture lists
 	UINT32                          m_live_textures;    // number of live textures
+	simple_list<render_texture>     m_texture_list;     // list of live textures
 	fixed_allocator<render_texture> m_texture_allocator;// texture allocator
 
+	// scaled texture cache
+	osd_work_queue *                m_scale_queue;      // queue for asynchronous scaling, or NULL
+	UINT32                          m_scale_clock;      // clock for least-recently-used tracking
+	UINT64                          m_scaled_bytes;     // memory used by scaled textures
+	UINT64                          m_scaled_limit;     // memory limit for scaled textures (0 == none)
+
 	// containers for the UI and for screens
 	render_container *              m_ui_container;     // UI container
 	simple_list<render_container>   m_screen_container_list; // list of containers for the screen
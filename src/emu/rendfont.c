@@ -236,10 +236,6 @@ void render_font::char_expand(unicode_char chnum, glyph &gl)
 			}
 		}
 	}
-
-	// wrap a texture around the bitmap
-	gl.texture = m_manager.texture_alloc(render_texture::hq_scale);
-	gl.texture->set_bitmap(gl.bitmap, gl.bitmap.cliprect(), TEXFORMAT_ARGB32);
 }
 
 
@@ -253,6 +249,13 @@ render_texture *render_font::get_char_texture_and_bounds(float height, float asp
 {
 	glyph &gl = get_char(chnum);
 
+	// wrap a texture around the bitmap the first time it is drawn as one
+	if (gl.texture == NULL && gl.bitmap.valid())
+	{
+		gl.texture = m_manager.texture_alloc(render_texture::hq_scale);
+		gl.texture->set_bitmap(gl.bitmap, gl.bitmap.cliprect(), TEXFORMAT_ARGB32);
+	}
+
 	// on entry, assume x0,y0 are the top,left coordinate of the cell and add
 	// the character bounding box to that position
 	float scale = m_scale * height;
@@ -290,8 +293,8 @@ void render_font::get_scaled_bitmap_and_bounds(bitmap_argb32 &dest, float height
 	if (dest.width() < bounds.width() || dest.height() < bounds.height())
 		return;
 
-	// if no texture, fill the target
-	if (gl.texture == NULL)
+	// if no bitmap, fill the target
+	if (!gl.bitmap.valid())
 	{
 		dest.fill(0);
 		return;
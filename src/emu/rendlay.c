@@ -498,11 +498,39 @@ render_texture *layout_element::state_texture(int state)
 		m_elemtex[state].m_element = this;
 		m_elemtex[state].m_state = state;
 		m_elemtex[state].m_texture = machine().render().texture_alloc(element_scale, &m_elemtex[state]);
+
+		// load the images here rather than in the scaler, which may run in the background
+		for (component *curcomp = m_complist.first(); curcomp != NULL; curcomp = curcomp->next())
+			curcomp->preload();
 	}
 	return m_elemtex[state].m_texture;
 }
 
 
+//-------------------------------------------------
+//  prescale_states - start rendering the states
+//  nearest to the given one at the given size in
+//  the background, so lamps and reels find their
+//  next texture ready when they change
+//-------------------------------------------------
+
+void layout_element::prescale_states(int state, UINT32 width, UINT32 height)
+{
+	// nothing to gain without background scaling
+	if (!machine().render().async_scaling())
+		return;
+
+	// closest states first, in case the queue fills up
+	for (int distance = 1; distance <= PRESCALE_STATES; distance++)
+	{
+		if (state + distance <= m_maxstate)
+			state_texture(state + distance)->prescale(width, height);
+		if (state - distance >= 0)
+			state_texture(state - distance)->prescale(width, height);
+	}
+}
+
+
 //-------------------------------------------------
 //  element_scale - scale an element by rendering
 //  all the components at the appropriate
@@ -569,8 +597,10 @@ layout_element::texture::~texture()
 
 layout_element::component::component(running_machine &machine, xml_data_node &compnode, const char *dirname)
 	: m_next(NULL),
+		m_machine(machine),
 		m_type(CTYPE_INVALID),
-		m_state(0)
+		m_state(0),
+		m_font(NULL)
 {
 	for (int i=0;i<MAX_BITMAPS;i++)
 		m_hasalpha[i] = false;
@@ -708,6 +738,20 @@ layout_element::component::component(running_machine &machine, xml_data_node &co
 	// error otherwise
 	else
 		throw emu_fatalerror("Unknown element component: %s", compnode.name);
+
+	// text, counters and reels draw with a font of their own; allocate it here on the
+	// main thread and expand the glyphs they use, so the scaler only ever reads it
+	if (m_type == CTYPE_TEXT || m_type == CTYPE_SIMPLECOUNTER || m_type == CTYPE_REEL)
+	{
+		m_font = machine.render().font_alloc("default");
+		if (m_type == CTYPE_TEXT)
+			expand_glyphs(m_string);
+		else if (m_type == CTYPE_SIMPLECOUNTER)
+			expand_glyphs("0123456789");
+		else
+			for (int i = 0; i < m_numstops; i++)
+				expand_glyphs(m_stopnames[i]);
+	}
 }
 
 
@@ -717,6 +761,37 @@ layout_element::component::component(running_machine &machine, xml_data_node &co
 
 layout_element::component::~component()
 {
+	if (m_font != NULL)
+		m_machine.render().font_free(m_font);
+}
+
+
+//-------------------------------------------------
+//  preload - load any images now, so that the
+//  scaler does not have to
+//-------------------------------------------------
+
+void layout_element::component::preload()
+{
+	if (m_type == CTYPE_IMAGE && !m_bitmap[0].valid())
+		load_bitmap();
+
+	if (m_type == CTYPE_REEL)
+		for (int fruit = 0; fruit < m_numstops; fruit++)
+			if (m_file[fruit] && !m_bitmap[fruit].valid())
+				load_reel_bitmap(fruit);
+}
+
+
+//-------------------------------------------------
+//  expand_glyphs - make the font generate the
+//  characters of a string ahead of drawing
+//-------------------------------------------------
+
+void layout_element::component::expand_glyphs(const char *string)
+{
+	for (const char *s = string; *s != 0; s++)
+		m_font->char_width(1.0f, 1.0f, *s);
 }
 
 
@@ -746,7 +821,7 @@ void layout_element::component::draw(running_machine &machine, bitmap_argb32 &de
 			break;
 
 		case CTYPE_TEXT:
-			draw_text(machine, dest, bounds);
+			draw_text(dest, bounds, m_string);
 			break;
 
 		case CTYPE_LED7SEG:
@@ -894,7 +969,7 @@ void layout_element::component::draw_disk(bitmap_argb32 &dest, const rectangle &
 //  draw_text - draw text in the specified color
 //-------------------------------------------------
 
-void layout_element::component::draw_text(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds)
+void layout_element::component::draw_text(bitmap_argb32 &dest, const rectangle &bounds, const char *string)
 {
 	// compute premultiplied colors
 	UINT32 r = m_color.r * 255.0;
@@ -903,14 +978,14 @@ void layout_element::component::draw_text(running_machine &machine, bitmap_argb3
 	UINT32 a = m_color.a * 255.0;
 
 	// get the width of the string
-	render_font *font = machine.render().font_alloc("default");
+	render_font *font = m_font;
 	float aspect = 1.0f;
 	INT32 width;
 
 
 	while (1)
 	{
-		width = font->string_width(bounds.height(), aspect, m_string);
+		width = font->string_width(bounds.height(), aspect, string);
 		if (width < bounds.width())
 			break;
 		aspect *= 0.9f;
@@ -941,7 +1016,7 @@ void layout_element::component::draw_text(running_machine &machine, bitmap_argb3
 	bitmap_argb32 tempbitmap(dest.width(), dest.height());
 
 	// loop over characters
-	for (const char *s = m_string; *s != 0; s++)
+	for (const char *s = string; *s != 0; s++)
 	{
 		// get the font bitmap
 		rectangle chbounds;
@@ -979,16 +1054,14 @@ void layout_element::component::draw_text(running_machine &machine, bitmap_argb3
 		curx += font->char_width(bounds.height(), aspect, *s);
 	}
 
-	// free the temporary bitmap and font
-	machine.render().font_free(font);
 }
 
 void layout_element::component::draw_simplecounter(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state)
 {
+	// format into a local string; other states of this element may be drawing at the same time
 	char temp[256];
 	sprintf(temp, "%0*d", m_digits, state);
-	m_string = astring(temp);
-	draw_text(machine, dest, bounds);
+	draw_text(dest, bounds, temp);
 }
 
 /* state is a normalized value between 0 and 65536 so that we don't need to worry about how many motor steps here or in the .lay, only the number of symbols */
@@ -1012,7 +1085,7 @@ void layout_element::component::draw_reel(running_machine &machine, bitmap_argb3
 		UINT32 a = m_color.a * 255.0;
 
 		// get the width of the string
-		render_font *font = machine.render().font_alloc("default");
+		render_font *font = m_font;
 		float aspect = 1.0f;
 		INT32 width;
 
@@ -1145,8 +1218,6 @@ void layout_element::component::draw_reel(running_machine &machine, bitmap_argb3
 
 			curry += ourheight/num_shown;
 		}
-	// free the temporary bitmap and font
-	machine.render().font_free(font);
 	}
 }
 
@@ -1165,7 +1236,7 @@ void layout_element::component::draw_beltreel(running_machine &machine, bitmap_a
 	UINT32 a = m_color.a * 255.0;
 
 	// get the width of the string
-	render_font *font = machine.render().font_alloc("default");
+	render_font *font = m_font;
 	float aspect = 1.0f;
 	INT32 width;
 	int currx = 0;
@@ -1295,9 +1366,6 @@ void layout_element::component::draw_beltreel(running_machine &machine, bitmap_a
 
 		currx += ourwidth/num_shown;
 	}
-
-	// free the temporary bitmap and font
-	machine.render().font_free(font);
 }
 
 
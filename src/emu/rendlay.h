@@ -58,7 +58,13 @@ public:
 	int maxstate() const { return m_maxstate; }
 	render_texture *state_texture(int state);
 
+	// operations
+	void prescale_states(int state, UINT32 width, UINT32 height);
+
 private:
+	// number of states either side of the current one to render ahead
+	static const int PRESCALE_STATES = 2;
+
 	// a component represents an image, rectangle, or disk in an element
 	class component
 	{
@@ -75,6 +81,7 @@ private:
 		const render_bounds &bounds() const { return m_bounds; }
 
 		// operations
+		void preload();
 		void draw(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state);
 
 	private:
@@ -103,10 +110,11 @@ private:
 		// helpers
 		void draw_rect(bitmap_argb32 &dest, const rectangle &bounds);
 		void draw_disk(bitmap_argb32 &dest, const rectangle &bounds);
-		void draw_text(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds);
+		void draw_text(bitmap_argb32 &dest, const rectangle &bounds, const char *string);
 		void draw_simplecounter(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state);
 		void draw_reel(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state);
 		void draw_beltreel(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state);
+		void expand_glyphs(const char *string);
 		void load_bitmap();
 		void load_reel_bitmap(int number);
 		void draw_led7seg(bitmap_argb32 &dest, const rectangle &bounds, int pattern);
@@ -130,6 +138,7 @@ private:
 
 		// internal state
 		component *         m_next;                     // link to next component
+		running_machine &   m_machine;                  // reference to the owning machine
 		component_type      m_type;                     // type of component
 		int                 m_state;                    // state where this component is visible (-1 means all states)
 		render_bounds       m_bounds;                   // bounds of the element
@@ -137,6 +146,7 @@ private:
 		astring             m_string;                   // string for text components
 		int                 m_digits;                   // number of digits for simple counters
 		int                 m_textalign;                // text alignment to box
+		render_font *       m_font;                     // font for text, counters and reels
 		bitmap_argb32       m_bitmap[MAX_BITMAPS];      // source bitmap for images
 		astring             m_dirname;                  // directory name of image file (for lazy loading)
 		auto_pointer<emu_file> m_file[MAX_BITMAPS];        // file object for reading image/alpha files
@@ -14,6 +14,10 @@
 #include "rendutil.h"
 #include "png.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 
 
 /***************************************************************************
@@ -426,6 +430,47 @@ int render_clip_quad(render_bounds *bounds, const render_bounds *clip, render_qu
 }
 
 
+/*-------------------------------------------------
+    render_convert_palette16 - convert a run of
+    16bpp palettized pixels to 32bpp, ANDing and
+    then ORing in a mask; shadow and highlight
+    pens are just further groups of the same
+    palette
+-------------------------------------------------*/
+
+void render_convert_palette16(UINT32 *dest, const UINT16 *source, int count, const rgb_t *palette, UINT32 ormask, UINT32 andmask)
+{
+#if defined(__AVX2__)
+	// gather eight palette entries at a time
+	const __m256i mask = _mm256_set1_epi32(ormask);
+	const __m256i keep = _mm256_set1_epi32(andmask);
+	for ( ; count >= 8; count -= 8, source += 8, dest += 8)
+	{
+		__m256i index = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)source));
+		__m256i color = _mm256_i32gather_epi32((const int *)palette, index, 4);
+		_mm256_storeu_si256((__m256i *)dest, _mm256_or_si256(_mm256_and_si256(color, keep), mask));
+	}
+#else
+	// four at a time; issuing the lookups before the stores lets them overlap
+	for ( ; count >= 4; count -= 4, source += 4, dest += 4)
+	{
+		UINT32 pix0 = palette[source[0]];
+		UINT32 pix1 = palette[source[1]];
+		UINT32 pix2 = palette[source[2]];
+		UINT32 pix3 = palette[source[3]];
+		dest[0] = (pix0 & andmask) | ormask;
+		dest[1] = (pix1 & andmask) | ormask;
+		dest[2] = (pix2 & andmask) | ormask;
+		dest[3] = (pix3 & andmask) | ormask;
+	}
+#endif
+
+	// handle the remainder
+	while (count-- > 0)
+		*dest++ = (palette[*source++] & andmask) | ormask;
+}
+
+
 /*-------------------------------------------------
     render_line_to_quad - convert a line and a
     width to four points
@@ -121,6 +121,27 @@ void save_manager::register_presave(save_prepost_delegate func)
 }
 
 
+//-------------------------------------------------
+//  register_preload - register a pre-load
+//  function callback
+//-------------------------------------------------
+
+void save_manager::register_preload(save_prepost_delegate func)
+{
+	// check for invalid timing
+	if (!m_reg_allowed)
+		fatalerror("Attempt to register callback function after state registration is closed!\n");
+
+	// scan for duplicates and push through to the end
+	for (state_callback *cb = m_preload_list.first(); cb != NULL; cb = cb->next())
+		if (cb->m_func == func)
+			fatalerror("Duplicate save state function (%s/%s)\n", cb->m_func.name(), func.name());
+
+	// allocate a new entry
+	m_preload_list.append(*global_alloc(state_callback(func)));
+}
+
+
 //-------------------------------------------------
 //  state_save_register_postload -
 //  register a post-load function callback
@@ -213,6 +234,19 @@ save_error save_manager::check_file(running_machine &machine, emu_file &file, co
 	return validate_header(header, gamename, sig, errormsg, "");
 }
 
+//-------------------------------------------------
+//  dispatch_preload - invoke all registered
+//  preload callbacks before the state is
+//  overwritten
+//-------------------------------------------------
+
+
+void save_manager::dispatch_preload()
+{
+	for (state_callback *func = m_preload_list.first(); func != NULL; func = func->next())
+		func->m_func();
+}
+
 //-------------------------------------------------
 //  dispatch_postload - invoke all registered
 //  postload callbacks for updates
@@ -251,6 +285,9 @@ save_error save_manager::read_file(emu_file &file)
 	// determine whether or not to flip the data when done
 	bool flip = NATIVE_ENDIAN_VALUE_LE_BE((header[9] & SS_MSB_FIRST) != 0, (header[9] & SS_MSB_FIRST) == 0);
 
+	// call the pre-load functions
+	dispatch_preload();
+
 	// read all the data, flipping if necessary
 	for (state_entry *entry = m_entry_list.first(); entry != NULL; entry = entry->next())
 	{
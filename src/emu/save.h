@@ -122,10 +122,12 @@ public:
 
 	// function registration
 	void register_presave(save_prepost_delegate func);
+	void register_preload(save_prepost_delegate func);
 	void register_postload(save_prepost_delegate func);
 
 	// callback dispatching
 	void dispatch_presave();
+	void dispatch_preload();
 	void dispatch_postload();
 
 	// generic memory registration
@@ -203,6 +205,7 @@ private:
 
 	simple_list<state_entry> m_entry_list;          // list of reigstered entries
 	simple_list<state_callback> m_presave_list;     // list of pre-save functions
+	simple_list<state_callback> m_preload_list;     // list of pre-load functions
 	simple_list<state_callback> m_postload_list;    // list of post-load functions
 };
 
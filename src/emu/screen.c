@@ -63,6 +63,7 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 		m_curtexture(0),
 		m_changed(true),
 		m_last_partial_scan(0),
+		m_last_rendered_scan(0),
 		m_frame_period(DEFAULT_FRAME_PERIOD.as_attoseconds()),
 		m_scantime(1),
 		m_pixeltime(1),
@@ -215,6 +216,19 @@ void screen_device::static_set_screen_vblank(device_t &device, screen_vblank_del
 }
 
 
+//-------------------------------------------------
+//  static_set_screen_partial - opt in to batched
+//  partial updates; the callback is given each
+//  requested range so the driver can latch the
+//  state it needs to render those lines later
+//-------------------------------------------------
+
+void screen_device::static_set_screen_partial(device_t &device, screen_partial_delegate callback)
+{
+	downcast<screen_device &>(device).m_screen_partial = callback;
+}
+
+
 //-------------------------------------------------
 //  static_set_palette - set the screen palette
 //  configuration
@@ -280,6 +294,7 @@ void screen_device::device_start()
 	m_screen_update_ind16.bind_relative_to(*owner());
 	m_screen_update_rgb32.bind_relative_to(*owner());
 	m_screen_vblank.bind_relative_to(*owner());
+	m_screen_partial.bind_relative_to(*owner());
 
 	// if we have a palette and it's not started, wait for it
 	if (m_palette != NULL && !m_palette->started())
@@ -301,6 +316,12 @@ void screen_device::device_start()
 	m_texture[1] = machine().render().texture_alloc();
 	m_texture[1]->set_osd_data((UINT64)((m_unique_id << 1) | 1));
 
+	// only hand the OSD new texture contents when the bitmap or its colors actually change
+	m_texture[0]->set_dirty_tracking();
+	m_texture[1]->set_dirty_tracking();
+	if (m_palette != NULL)
+		m_palclient.reset(global_alloc(palette_client(*m_palette->palette())));
+
 	// configure the default cliparea
 	render_container::user_settings settings;
 	m_container->get_user_settings(settings);
@@ -387,6 +408,9 @@ void screen_device::device_stop()
 void screen_device::device_post_load()
 {
 	realloc_screen_bitmaps();
+
+	// batched partial updates are not saved; treat everything requested as rendered
+	m_last_rendered_scan = m_last_partial_scan;
 }
 
 
@@ -612,9 +636,41 @@ bool screen_device::update_partial(int scanline)
 		return false;
 	}
 
+	m_partial_updates_this_frame++;
+	g_profiler.count(PROFILER_COUNT_PARTIAL_REQUEST);
+
+	// batching screens only let the driver latch its state; the lines are rendered later
+	if (!m_screen_partial.isnull())
+	{
+		LOG_PARTIAL_UPDATES(("batching %d-%d\n", clip.min_y, clip.max_y));
+		m_screen_partial(*this, clip);
+		m_last_partial_scan = scanline + 1;
+
+		// reaching the bottom of the visible area completes the frame
+		if (scanline >= m_visarea.max_y)
+			flush_partial_updates();
+		return true;
+	}
+
 	// otherwise, render
 	LOG_PARTIAL_UPDATES(("updating %d-%d\n", clip.min_y, clip.max_y));
+	render_partial(clip);
+
+	// remember where we left off
+	m_last_partial_scan = m_last_rendered_scan = scanline + 1;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  render_partial - call the driver to render
+//  a range of scanlines
+//-------------------------------------------------
+
+void screen_device::render_partial(const rectangle &clip)
+{
 	g_profiler.start(PROFILER_VIDEO);
+	g_profiler.count(PROFILER_COUNT_PARTIAL_RENDER);
 
 	UINT32 flags = UPDATE_HAS_NOT_CHANGED;
 	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
@@ -625,15 +681,34 @@ bool screen_device::update_partial(int scanline)
 		case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
 	}
 
-	m_partial_updates_this_frame++;
 	g_profiler.stop();
 
 	// if we modified the bitmap, we have to commit
 	m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+}
 
-	// remember where we left off
-	m_last_partial_scan = scanline + 1;
-	return true;
+
+//-------------------------------------------------
+//  flush_partial_updates - render all scanlines
+//  whose partial updates have been batched; call
+//  this before reading back the screen bitmap
+//-------------------------------------------------
+
+void screen_device::flush_partial_updates()
+{
+	// render from the last rendered line up to the last requested one
+	rectangle clip = m_visarea;
+	if (m_last_rendered_scan > clip.min_y)
+		clip.min_y = m_last_rendered_scan;
+	if (m_last_partial_scan - 1 < clip.max_y)
+		clip.max_y = m_last_partial_scan - 1;
+	m_last_rendered_scan = m_last_partial_scan;
+
+	if (clip.min_y <= clip.max_y)
+	{
+		LOG_PARTIAL_UPDATES(("Partial: flush_partial_updates(%s) updating %d-%d\n", tag(), clip.min_y, clip.max_y));
+		render_partial(clip);
+	}
 }
 
 
@@ -669,7 +744,11 @@ void screen_device::update_now()
 
 void screen_device::reset_partial_updates()
 {
+	// anything still batched belongs to the frame being finished
+	flush_partial_updates();
+
 	m_last_partial_scan = 0;
+	m_last_rendered_scan = 0;
 	m_partial_updates_this_frame = 0;
 	m_scanline0_timer->adjust(time_until_pos(0));
 }
@@ -881,6 +960,11 @@ bool screen_device::update_quads()
 				m_curbitmap = 1 - m_curbitmap;
 			}
 
+			// palette changes alter the texture colors even if the bitmap is unchanged
+			UINT32 mindirty, maxdirty;
+			if (m_palclient != NULL && m_palclient->dirty_list(mindirty, maxdirty) != NULL)
+				m_texture[m_curtexture]->mark_dirty();
+
 			// create an empty container with a single quad
 			m_container->empty();
 			m_container->add_quad(0.0f, 0.0f, 1.0f, 1.0f, rgb_t(0xff,0xff,0xff,0xff), m_texture[m_curtexture], PRIMFLAG_BLENDMODE(BLENDMODE_NONE) | PRIMFLAG_SCREENTEX(1));
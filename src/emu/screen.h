@@ -139,6 +139,7 @@ typedef delegate<void (screen_device &, bool)> vblank_state_delegate;
 typedef device_delegate<UINT32 (screen_device &, bitmap_ind16 &, const rectangle &)> screen_update_ind16_delegate;
 typedef device_delegate<UINT32 (screen_device &, bitmap_rgb32 &, const rectangle &)> screen_update_rgb32_delegate;
 typedef device_delegate<void (screen_device &, bool)> screen_vblank_delegate;
+typedef device_delegate<void (screen_device &, const rectangle &)> screen_partial_delegate;
 
 
 // ======================> screen_device
@@ -179,6 +180,7 @@ public:
 	static void static_set_screen_update(device_t &device, screen_update_ind16_delegate callback);
 	static void static_set_screen_update(device_t &device, screen_update_rgb32_delegate callback);
 	static void static_set_screen_vblank(device_t &device, screen_vblank_delegate callback);
+	static void static_set_screen_partial(device_t &device, screen_partial_delegate callback);
 	static void static_set_palette(device_t &device, const char *tag);
 	static void static_set_video_attributes(device_t &device, UINT32 flags);
 
@@ -211,6 +213,7 @@ public:
 	int partial_updates() const { return m_partial_updates_this_frame; }
 	bool update_partial(int scanline);
 	void update_now();
+	void flush_partial_updates();
 	void reset_partial_updates();
 
 	// additional helpers
@@ -246,6 +249,7 @@ private:
 	// internal helpers
 	void set_container(render_container &container) { m_container = &container; }
 	void realloc_screen_bitmaps();
+	void render_partial(const rectangle &clip);
 	void vblank_begin();
 	void vblank_end();
 	void finalize_burnin();
@@ -261,6 +265,7 @@ private:
 	screen_update_ind16_delegate m_screen_update_ind16; // screen update callback (16-bit palette)
 	screen_update_rgb32_delegate m_screen_update_rgb32; // screen update callback (32-bit RGB)
 	screen_vblank_delegate m_screen_vblank;         // screen vblank callback
+	screen_partial_delegate m_screen_partial;       // batched partial update callback
 	optional_device<palette_device> m_palette;      // our palette
 	UINT32              m_video_attributes;         // flags describing the video system
 
@@ -281,7 +286,9 @@ private:
 	UINT8               m_curbitmap;                // current bitmap index
 	UINT8               m_curtexture;               // current texture index
 	bool                m_changed;                  // has this bitmap changed?
+	auto_pointer<palette_client> m_palclient;       // client to our palette, for texture dirty tracking
 	INT32               m_last_partial_scan;        // scanline of last partial update
+	INT32               m_last_rendered_scan;       // scanline of last partial update actually rendered
 	bitmap_argb32       m_screen_overlay_bitmap;    // screen overlay bitmap
 	UINT32              m_unique_id;                // unique id for this screen_device
 
@@ -375,6 +382,10 @@ typedef device_type_iterator<&device_creator<screen_device>, screen_device> scre
 	screen_device::static_set_screen_vblank(*device, screen_vblank_delegate(&_class::_method, #_class "::" #_method, NULL, (_class *)0));
 #define MCFG_SCREEN_VBLANK_DEVICE(_device, _class, _method) \
 	screen_device::static_set_screen_vblank(*device, screen_vblank_delegate(&_class::_method, #_class "::" #_method, _device, (_class *)0));
+#define MCFG_SCREEN_PARTIAL_BATCH_DRIVER(_class, _method) \
+	screen_device::static_set_screen_partial(*device, screen_partial_delegate(&_class::_method, #_class "::" #_method, NULL, (_class *)0));
+#define MCFG_SCREEN_PARTIAL_BATCH_DEVICE(_device, _class, _method) \
+	screen_device::static_set_screen_partial(*device, screen_partial_delegate(&_class::_method, #_class "::" #_method, _device, (_class *)0));
 #define MCFG_SCREEN_PALETTE(_palette_tag) \
 	screen_device::static_set_palette(*device, "^" _palette_tag);
 #define MCFG_SCREEN_NO_PALETTE \
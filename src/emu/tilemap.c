@@ -10,6 +10,23 @@
 
 #include "emu.h"
 
+// use SSE2 for the scanline rasterizers under the same conditions as rgbutil.h
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define TILEMAP_USE_SSE2    (1)
+#include <emmintrin.h>
+#else
+#define TILEMAP_USE_SSE2    (0)
+#endif
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+const int MAX_BANDS         = 16;       // most bands a single draw is split into
+const int MIN_BAND_HEIGHT   = 16;       // don't bother splitting into bands shorter than this
+
+
 
 //**************************************************************************
 //  INLINE FUNCTIONS
@@ -99,6 +116,69 @@ inline bool tilemap_t::gfx_elements_changed()
 //  SCANLINE RASTERIZERS
 //**************************************************************************
 
+#if TILEMAP_USE_SSE2
+
+//-------------------------------------------------
+//  simd_select - return a byte mask of the 16
+//  pixels whose flags match the mask/value
+//-------------------------------------------------
+
+static inline __m128i simd_select(const UINT8 *maskptr, __m128i mask, __m128i value)
+{
+	return _mm_cmpeq_epi8(_mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(maskptr)), mask), value);
+}
+
+
+//-------------------------------------------------
+//  simd_priority - apply the priority code to
+//  the first (count & ~15) priority pixels,
+//  optionally only where the flags match
+//-------------------------------------------------
+
+static inline void simd_priority(UINT8 *pri, int count, UINT32 pcode)
+{
+	const __m128i andmask = _mm_set1_epi8(pcode >> 8);
+	const __m128i ormask = _mm_set1_epi8(pcode);
+	for (int i = 0; i < (count & ~15); i += 16)
+	{
+		__m128i *dest = reinterpret_cast<__m128i *>(&pri[i]);
+		_mm_storeu_si128(dest, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(dest), andmask), ormask));
+	}
+}
+
+static inline void simd_priority_masked(const UINT8 *maskptr, int mask, int value, UINT8 *pri, int count, UINT32 pcode)
+{
+	const __m128i andmask = _mm_set1_epi8(pcode >> 8);
+	const __m128i ormask = _mm_set1_epi8(pcode);
+	const __m128i flagmask = _mm_set1_epi8(mask);
+	const __m128i flagvalue = _mm_set1_epi8(value);
+	for (int i = 0; i < (count & ~15); i += 16)
+	{
+		__m128i *dest = reinterpret_cast<__m128i *>(&pri[i]);
+		__m128i select = simd_select(&maskptr[i], flagmask, flagvalue);
+		__m128i old = _mm_loadu_si128(dest);
+		__m128i updated = _mm_or_si128(_mm_and_si128(old, andmask), ormask);
+		_mm_storeu_si128(dest, _mm_or_si128(_mm_and_si128(select, updated), _mm_andnot_si128(select, old)));
+	}
+}
+
+
+//-------------------------------------------------
+//  simd_alpha_blend - blend 4 RGB32 pixels the
+//  same way alpha_blend_r32 does
+//-------------------------------------------------
+
+static inline __m128i simd_alpha_blend(__m128i d, __m128i s, __m128i level, __m128i alphad)
+{
+	const __m128i zero = _mm_setzero_si128();
+	__m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), level), _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), alphad));
+	__m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), level), _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), alphad));
+	return _mm_and_si128(_mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)), _mm_set1_epi32(0x00ffffff));
+}
+
+#endif
+
+
 //-------------------------------------------------
 //  scanline_draw_opaque_null - draw to a NULL
 //  bitmap, setting priority only
@@ -111,7 +191,12 @@ inline void tilemap_t::scanline_draw_opaque_null(int count, UINT8 *pri, UINT32 p
 		return;
 
 	// update priority across the scanline
-	for (int i = 0; i < count; i++)
+	int i = 0;
+#if TILEMAP_USE_SSE2
+	simd_priority(pri, count, pcode);
+	i = count & ~15;
+#endif
+	for ( ; i < count; i++)
 		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
 }
 
@@ -128,7 +213,12 @@ inline void tilemap_t::scanline_draw_masked_null(const UINT8 *maskptr, int mask,
 		return;
 
 	// update priority across the scanline, checking the mask
-	for (int i = 0; i < count; i++)
+	int i = 0;
+#if TILEMAP_USE_SSE2
+	simd_priority_masked(maskptr, mask, value, pri, count, pcode);
+	i = count & ~15;
+#endif
+	for ( ; i < count; i++)
 		if ((maskptr[i] & mask) == value)
 			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
 }
@@ -154,14 +244,35 @@ inline void tilemap_t::scanline_draw_opaque_ind16(UINT16 *dest, const UINT16 *so
 			return;
 
 		// update priority across the scanline
-		for (int i = 0; i < count; i++)
+		int i = 0;
+#if TILEMAP_USE_SSE2
+		simd_priority(pri, count, pcode);
+		i = count & ~15;
+#endif
+		for ( ; i < count; i++)
 			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+		return;
 	}
 
+	// add the palette offset 16 pixels at a time
+	int i = 0;
+#if TILEMAP_USE_SSE2
+	const __m128i palvec = _mm_set1_epi16(pal);
+	for ( ; i < (count & ~15); i += 16)
+	{
+		__m128i src0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i]));
+		__m128i src1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i + 8]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), _mm_add_epi16(src0, palvec));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i + 8]), _mm_add_epi16(src1, palvec));
+	}
+	if ((pcode & 0xffff) != 0xff00)
+		simd_priority(pri, count, pcode);
+#endif
+
 	// priority case
-	else if ((pcode & 0xffff) != 0xff00)
+	if ((pcode & 0xffff) != 0xff00)
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 		{
 			dest[i] = source[i] + pal;
 			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
@@ -171,7 +282,7 @@ inline void tilemap_t::scanline_draw_opaque_ind16(UINT16 *dest, const UINT16 *so
 	// no priority case
 	else
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 			dest[i] = source[i] + pal;
 	}
 }
@@ -186,10 +297,32 @@ inline void tilemap_t::scanline_draw_masked_ind16(UINT16 *dest, const UINT16 *so
 {
 	int pal = pcode >> 16;
 
+	// blend 16 pixels at a time using the widened flag mask
+	int i = 0;
+#if TILEMAP_USE_SSE2
+	const __m128i palvec = _mm_set1_epi16(pal);
+	const __m128i flagmask = _mm_set1_epi8(mask);
+	const __m128i flagvalue = _mm_set1_epi8(value);
+	for ( ; i < (count & ~15); i += 16)
+	{
+		__m128i select = simd_select(&maskptr[i], flagmask, flagvalue);
+		__m128i select0 = _mm_unpacklo_epi8(select, select);
+		__m128i select1 = _mm_unpackhi_epi8(select, select);
+		__m128i *dest0 = reinterpret_cast<__m128i *>(&dest[i]);
+		__m128i *dest1 = reinterpret_cast<__m128i *>(&dest[i + 8]);
+		__m128i src0 = _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i])), palvec);
+		__m128i src1 = _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i + 8])), palvec);
+		_mm_storeu_si128(dest0, _mm_or_si128(_mm_and_si128(select0, src0), _mm_andnot_si128(select0, _mm_loadu_si128(dest0))));
+		_mm_storeu_si128(dest1, _mm_or_si128(_mm_and_si128(select1, src1), _mm_andnot_si128(select1, _mm_loadu_si128(dest1))));
+	}
+	if ((pcode & 0xffff) != 0xff00)
+		simd_priority_masked(maskptr, mask, value, pri, count, pcode);
+#endif
+
 	// priority case
 	if ((pcode & 0xffff) != 0xff00)
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 			if ((maskptr[i] & mask) == value)
 			{
 				dest[i] = source[i] + pal;
@@ -200,7 +333,7 @@ inline void tilemap_t::scanline_draw_masked_ind16(UINT16 *dest, const UINT16 *so
 	// no priority case
 	else
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 			if ((maskptr[i] & mask) == value)
 				dest[i] = source[i] + pal;
 	}
@@ -217,10 +350,16 @@ inline void tilemap_t::scanline_draw_opaque_rgb32(UINT32 *dest, const UINT16 *so
 {
 	const rgb_t *clut = &pens[pcode >> 16];
 
-	// priority case
+	// priority case; the palette lookup stays scalar, but the priority update is vectorized
 	if ((pcode & 0xffff) != 0xff00)
 	{
-		for (int i = 0; i < count; i++)
+		int i = 0;
+#if TILEMAP_USE_SSE2
+		simd_priority(pri, count, pcode);
+		for ( ; i < (count & ~15); i++)
+			dest[i] = clut[source[i]];
+#endif
+		for ( ; i < count; i++)
 		{
 			dest[i] = clut[source[i]];
 			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
@@ -248,7 +387,14 @@ inline void tilemap_t::scanline_draw_masked_rgb32(UINT32 *dest, const UINT16 *so
 	// priority case
 	if ((pcode & 0xffff) != 0xff00)
 	{
-		for (int i = 0; i < count; i++)
+		int i = 0;
+#if TILEMAP_USE_SSE2
+		simd_priority_masked(maskptr, mask, value, pri, count, pcode);
+		for ( ; i < (count & ~15); i++)
+			if ((maskptr[i] & mask) == value)
+				dest[i] = clut[source[i]];
+#endif
+		for ( ; i < count; i++)
 			if ((maskptr[i] & mask) == value)
 			{
 				dest[i] = clut[source[i]];
@@ -275,10 +421,25 @@ inline void tilemap_t::scanline_draw_opaque_rgb32_alpha(UINT32 *dest, const UINT
 {
 	const rgb_t *clut = &pens[pcode >> 16];
 
+	// blend 4 pixels at a time
+	int i = 0;
+#if TILEMAP_USE_SSE2
+	const __m128i level = _mm_set1_epi16(alpha);
+	const __m128i alphad = _mm_set1_epi16(256 - alpha);
+	for ( ; i < (count & ~15); i += 4)
+	{
+		__m128i *dest0 = reinterpret_cast<__m128i *>(&dest[i]);
+		__m128i src = _mm_setr_epi32(clut[source[i]], clut[source[i + 1]], clut[source[i + 2]], clut[source[i + 3]]);
+		_mm_storeu_si128(dest0, simd_alpha_blend(_mm_loadu_si128(dest0), src, level, alphad));
+	}
+	if ((pcode & 0xffff) != 0xff00)
+		simd_priority(pri, count, pcode);
+#endif
+
 	// priority case
 	if ((pcode & 0xffff) != 0xff00)
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 		{
 			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
 			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
@@ -288,7 +449,7 @@ inline void tilemap_t::scanline_draw_opaque_rgb32_alpha(UINT32 *dest, const UINT
 	// no priority case
 	else
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
 	}
 }
@@ -304,10 +465,36 @@ inline void tilemap_t::scanline_draw_masked_rgb32_alpha(UINT32 *dest, const UINT
 {
 	const rgb_t *clut = &pens[pcode >> 16];
 
+	// blend 4 pixels at a time, keeping the old pixels where the flags don't match
+	int i = 0;
+#if TILEMAP_USE_SSE2
+	const __m128i level = _mm_set1_epi16(alpha);
+	const __m128i alphad = _mm_set1_epi16(256 - alpha);
+	const __m128i flagmask = _mm_set1_epi8(mask);
+	const __m128i flagvalue = _mm_set1_epi8(value);
+	for ( ; i < (count & ~15); i += 16)
+	{
+		__m128i select8 = simd_select(&maskptr[i], flagmask, flagvalue);
+		__m128i select16[2] = { _mm_unpacklo_epi8(select8, select8), _mm_unpackhi_epi8(select8, select8) };
+		for (int group = 0; group < 4; group++)
+		{
+			int x = i + group * 4;
+			__m128i select = (group & 1) ? _mm_unpackhi_epi16(select16[group >> 1], select16[group >> 1]) : _mm_unpacklo_epi16(select16[group >> 1], select16[group >> 1]);
+			__m128i *dest0 = reinterpret_cast<__m128i *>(&dest[x]);
+			__m128i old = _mm_loadu_si128(dest0);
+			__m128i src = _mm_setr_epi32(clut[source[x]], clut[source[x + 1]], clut[source[x + 2]], clut[source[x + 3]]);
+			__m128i blended = simd_alpha_blend(old, src, level, alphad);
+			_mm_storeu_si128(dest0, _mm_or_si128(_mm_and_si128(select, blended), _mm_andnot_si128(select, old)));
+		}
+	}
+	if ((pcode & 0xffff) != 0xff00)
+		simd_priority_masked(maskptr, mask, value, pri, count, pcode);
+#endif
+
 	// priority case
 	if ((pcode & 0xffff) != 0xff00)
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 			if ((maskptr[i] & mask) == value)
 			{
 				dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
@@ -318,7 +505,7 @@ inline void tilemap_t::scanline_draw_masked_rgb32_alpha(UINT32 *dest, const UINT
 	// no priority case
 	else
 	{
-		for (int i = 0; i < count; i++)
+		for ( ; i < count; i++)
 			if ((maskptr[i] & mask) == value)
 				dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
 	}
@@ -699,6 +886,7 @@ inline void tilemap_t::realize_all_dirty_tiles()
 	{
 		memset(&m_tileflags[0], TILE_FLAG_DIRTY, m_tileflags.count());
 		m_all_tiles_dirty = false;
+		m_all_tiles_clean = false;
 		m_gfx_used = 0;
 	}
 }
@@ -946,6 +1134,29 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	// flush the dirty state to all tiles as appropriate
 	realize_all_dirty_tiles();
 
+	// split into bands on the work queue if enabled, otherwise draw everything here
+	band_parameters<_BitmapClass> params;
+	params.tilemap = this;
+	params.screen = &screen;
+	params.dest = &dest;
+	params.blit = blit;
+	params.roz = false;
+	if (!draw_banded(params))
+		draw_region(screen, dest, blit);
+g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  draw_region - draw the tilemap within the
+//  blit cliprect, handling scrolling; this is
+//  the part of draw_common that may run on the
+//  work queue
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void tilemap_t::draw_region(screen_device &screen, _BitmapClass &dest, blit_parameters blit)
+{
 	// flip the tilemap around the center of the visible area
 	rectangle visarea = screen.visible_area();
 	UINT32 width = visarea.min_x + visarea.max_x + 1;
@@ -1036,7 +1247,57 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 			}
 		}
 	}
-g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  draw_banded - split a draw into horizontal
+//  bands and render them on the work queue;
+//  each band only touches its own rows of the
+//  destination and priority bitmaps
+//-------------------------------------------------
+
+template<class _BitmapClass>
+bool tilemap_t::draw_banded(band_parameters<_BitmapClass> &params)
+{
+	// only if enabled and the region is tall enough to be worth it
+	osd_work_queue *queue = m_manager->work_queue();
+	const rectangle &cliprect = params.blit.cliprect;
+	int bands = MIN(MIN(m_manager->bands(), MAX_BANDS), cliprect.height() / MIN_BAND_HEIGHT);
+	if (queue == NULL || bands < 2)
+		return false;
+
+	// the workers must never update tiles themselves, so bring any dirty ones up to date here
+	pixmap_update();
+
+	// carve up the cliprect and queue the bands
+	band_parameters<_BitmapClass> band[MAX_BANDS];
+	for (int bandnum = 0; bandnum < bands; bandnum++)
+	{
+		band[bandnum] = params;
+		band[bandnum].blit.cliprect.min_y = cliprect.min_y + cliprect.height() * bandnum / bands;
+		band[bandnum].blit.cliprect.max_y = cliprect.min_y + cliprect.height() * (bandnum + 1) / bands - 1;
+	}
+	osd_work_item_queue_multiple(queue, draw_band_static<_BitmapClass>, bands, band, sizeof(band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(queue, osd_ticks_per_second() * 10);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  draw_band_static - work queue callback to
+//  draw a single band
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void *tilemap_t::draw_band_static(void *param, int threadid)
+{
+	band_parameters<_BitmapClass> &band = *reinterpret_cast<band_parameters<_BitmapClass> *>(param);
+	if (band.roz)
+		band.tilemap->draw_roz_core(*band.screen, *band.dest, band.blit, band.startx, band.starty, band.incxx, band.incxy, band.incyx, band.incyy, band.wraparound);
+	else
+		band.tilemap->draw_region(*band.screen, *band.dest, band.blit);
+	return NULL;
 }
 
 void tilemap_t::draw(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect, UINT32 flags, UINT8 priority, UINT8 priority_mask)
@@ -1083,8 +1344,22 @@ g_profiler.start(PROFILER_TILEMAP_DRAW_ROZ);
 	// get the full pixmap for the tilemap
 	pixmap();
 
-	// then do the roz copy
-	draw_roz_core(screen, dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
+	// then do the roz copy, in bands if enabled
+	band_parameters<_BitmapClass> params;
+	params.tilemap = this;
+	params.screen = &screen;
+	params.dest = &dest;
+	params.blit = blit;
+	params.roz = true;
+	params.startx = startx;
+	params.starty = starty;
+	params.incxx = incxx;
+	params.incxy = incxy;
+	params.incyx = incyx;
+	params.incyy = incyy;
+	params.wraparound = wraparound;
+	if (!draw_banded(params))
+		draw_roz_core(screen, dest, blit, startx, starty, incxx, incxy, incyx, incyy, wraparound);
 g_profiler.stop();
 }
 
@@ -1484,8 +1759,13 @@ void tilemap_t::draw_debug(screen_device &screen, bitmap_rgb32 &dest, UINT32 scr
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_work_queue(NULL),
+		m_bands(machine.options().tilemap_bands())
 {
+	// allocate a queue if we are drawing in bands
+	if (m_bands > 1)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
 }
 
 
@@ -1509,6 +1789,9 @@ tilemap_manager::~tilemap_manager()
 				break;
 			}
 	}
+	// free the work queue
+	if (m_work_queue != NULL)
+		osd_work_queue_free(m_work_queue);
 }
 
 
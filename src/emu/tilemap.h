@@ -587,6 +587,20 @@ private:
 		UINT8               alpha;
 	};
 
+	// parameters for drawing a single horizontal band on the work queue
+	template<class _BitmapClass>
+	struct band_parameters
+	{
+		tilemap_t *         tilemap;
+		screen_device *     screen;
+		_BitmapClass *      dest;
+		blit_parameters     blit;
+		bool                roz;
+		UINT32              startx, starty;
+		int                 incxx, incxy, incyx, incyy;
+		bool                wraparound;
+	};
+
 	// inline helpers
 	INT32 effective_rowscroll(int index, UINT32 screen_width);
 	INT32 effective_colscroll(int index, UINT32 screen_height);
@@ -615,6 +629,9 @@ private:
 	UINT8 tile_apply_bitmask(const UINT8 *maskdata, UINT32 x0, UINT32 y0, UINT8 category, UINT8 flags);
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, UINT32 flags, UINT8 priority, UINT8 priority_mask);
 	template<class _BitmapClass> void draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, UINT32 flags, UINT8 priority, UINT8 priority_mask);
+	template<class _BitmapClass> void draw_region(screen_device &screen, _BitmapClass &dest, blit_parameters blit);
+	template<class _BitmapClass> bool draw_banded(band_parameters<_BitmapClass> &params);
+	template<class _BitmapClass> static void *draw_band_static(void *param, int threadid);
 	template<class _BitmapClass> void draw_roz_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, UINT32 startx, UINT32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, UINT32 flags, UINT8 priority, UINT8 priority_mask);
 	template<class _BitmapClass> void draw_instance(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int xpos, int ypos);
 	template<class _BitmapClass> void draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit, UINT32 startx, UINT32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound);
@@ -690,6 +707,8 @@ public:
 
 	// getters
 	running_machine &machine() const { return m_machine; }
+	osd_work_queue *work_queue() const { return m_work_queue; }
+	int bands() const { return m_bands; }
 
 	// tilemap creation
 	tilemap_t &create(device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_mapper_delegate mapper, int tilewidth, int tileheight, int cols, int rows, tilemap_t *allocated = NULL);
@@ -711,6 +730,8 @@ private:
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	osd_work_queue *        m_work_queue;           // queue for banded drawing, or NULL
+	int                     m_bands;                // number of bands to split drawing into
 };
 
 
@@ -11,6 +11,7 @@
 #include "emu.h"
 #include "validity.h"
 #include "emuopts.h"
+#include "video/rgbutil.h"
 #include <ctype.h>
 
 
@@ -360,6 +361,10 @@ void validity_checker::validate_core()
 #else
 	if (lsbtest == 0x00ff) osd_printf_error("LSB_FIRST not specified, but running on a little-endian machine\n");
 #endif
+
+	// check that the optimized drawing cores still match the reference ones
+	drawgfx_validate_row_cores();
+	rgbutil_validate();
 }
 
 
@@ -100,13 +100,24 @@ video_manager::video_manager(running_machine &machine)
 		m_snap_native(true),
 		m_snap_width(0),
 		m_snap_height(0),
+		m_snap_work_queue(NULL),
+		m_snap_bands(machine.options().render_bands()),
+		m_snap_signature(0),
 		m_mng_frame_period(attotime::zero),
 		m_mng_next_frame_time(attotime::zero),
 		m_mng_frame(0),
 		m_avi_file(NULL),
 		m_avi_frame_period(attotime::zero),
 		m_avi_next_frame_time(attotime::zero),
-		m_avi_frame(0)
+		m_avi_frame(0),
+		m_record_work_queue(NULL),
+		m_record_primlist(NULL),
+		m_record_avi_frames(0),
+		m_record_mng_frames(0),
+		m_record_mng_first(false),
+		m_record_redraw(true),
+		m_record_avi_failed(false),
+		m_record_mng_failed(false)
 {
 	// request a callback upon exiting
 	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(video_manager::exit), this));
@@ -144,6 +155,14 @@ video_manager::video_manager(running_machine &machine)
 	if (sscanf(machine.options().snap_size(), "%dx%d", &m_snap_width, &m_snap_height) != 2)
 		m_snap_width = m_snap_height = 0;
 
+	// snapshots and movie frames can be rendered in bands on a work queue
+	if (m_snap_bands > 1)
+		m_snap_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
+	// movie frames can be written on their own thread while the next frame runs
+	if (machine.options().record_async())
+		m_record_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+
 	// start recording movie if specified
 	const char *filename = machine.options().mng_write();
 	if (filename[0] != 0)
@@ -299,6 +318,9 @@ void video_manager::save_snapshot(screen_device *screen, emu_file &file)
 	// validate
 	assert(!m_snap_native || screen != NULL);
 
+	// the snapshot bitmap may still be in use by a movie frame
+	flush_recording();
+
 	// create the bitmap to pass in
 	create_snapshot_bitmap(screen);
 
@@ -360,6 +382,9 @@ void video_manager::save_active_screen_snapshots()
 
 void video_manager::begin_recording(const char *name, movie_format format)
 {
+	// finish writing any pending movie frames
+	flush_recording();
+
 	// create a snapshot bitmap so we know what the target size is
 	create_snapshot_bitmap(NULL);
 
@@ -468,6 +493,9 @@ void video_manager::begin_recording(const char *name, movie_format format)
 
 void video_manager::end_recording(movie_format format)
 {
+	// finish writing any pending movie frames
+	flush_recording();
+
 	if (format == MF_AVI)
 	{
 		// close the file if it exists
@@ -507,6 +535,19 @@ void video_manager::add_sound_to_recording(const INT16 *sound, int numsamples)
 	{
 		g_profiler.start(PROFILER_MOVIE_REC);
 
+		// when writing asynchronously, copy the samples and queue them behind the pending frame
+		if (m_record_work_queue != NULL)
+		{
+			record_sound_item *item = global_alloc(record_sound_item);
+			item->m_manager = this;
+			item->m_samples.resize(numsamples * 2);
+			memcpy(&item->m_samples[0], sound, numsamples * 2 * sizeof(INT16));
+			item->m_numsamples = numsamples;
+			osd_work_item_queue(m_record_work_queue, record_sound_static, item, WORK_ITEM_FLAG_AUTO_RELEASE);
+			g_profiler.stop();
+			return;
+		}
+
 		// write the next frame
 		avi_error avierr = avi_append_sound_samples(m_avi_file, 0, sound + 0, numsamples, 1);
 		if (avierr == AVIERR_NONE)
@@ -533,6 +574,12 @@ void video_manager::exit()
 	// free the snapshot target
 	machine().render().target_free(m_snap_target);
 	m_snap_bitmap.reset();
+	if (m_snap_work_queue != NULL)
+		osd_work_queue_free(m_snap_work_queue);
+	m_snap_work_queue = NULL;
+	if (m_record_work_queue != NULL)
+		osd_work_queue_free(m_record_work_queue);
+	m_record_work_queue = NULL;
 
 	// print a final result if we have at least 2 seconds' worth of data
 	if (m_overall_emutime.seconds >= 1)
@@ -1061,10 +1108,67 @@ void video_manager::recompute_speed(const attotime &emutime)
 //  given screen
 //-------------------------------------------------
 
+//-------------------------------------------------
+//  signature_add - fold a block of data into a
+//  primitive list signature
+//-------------------------------------------------
+
+inline void signature_add(UINT64 &signature, const void *data, size_t length)
+{
+	const UINT8 *bytes = reinterpret_cast<const UINT8 *>(data);
+	for (size_t index = 0; index < length; index++)
+		signature = (signature ^ bytes[index]) * U64(0x100000001b3);
+}
+
+
+//-------------------------------------------------
+//  primlist_signature - compute a signature of
+//  everything in a primitive list that affects
+//  the rendered image; textures only change their
+//  seqid when their contents change
+//-------------------------------------------------
+
+static UINT64 primlist_signature(render_primitive_list &primlist)
+{
+	UINT64 signature = U64(0xcbf29ce484222325);
+	for (const render_primitive *prim = primlist.first(); prim != NULL; prim = prim->next())
+	{
+		const rgb_t *palette = prim->texture.palette();
+		signature_add(signature, &prim->type, sizeof(prim->type));
+		signature_add(signature, &prim->bounds, sizeof(prim->bounds));
+		signature_add(signature, &prim->color, sizeof(prim->color));
+		signature_add(signature, &prim->flags, sizeof(prim->flags));
+		signature_add(signature, &prim->width, sizeof(prim->width));
+		signature_add(signature, &prim->texture.base, sizeof(prim->texture.base));
+		signature_add(signature, &prim->texture.width, sizeof(prim->texture.width));
+		signature_add(signature, &prim->texture.height, sizeof(prim->texture.height));
+		signature_add(signature, &prim->texture.seqid, sizeof(prim->texture.seqid));
+		signature_add(signature, &palette, sizeof(palette));
+		signature_add(signature, &prim->texcoords, sizeof(prim->texcoords));
+	}
+	return signature;
+}
+
+
 typedef software_renderer<UINT32, 0,0,0, 16,8,0, false, true> snap_renderer_bilinear;
 typedef software_renderer<UINT32, 0,0,0, 16,8,0, false, false> snap_renderer;
 
 void video_manager::create_snapshot_bitmap(screen_device *screen)
+{
+	render_snapshot_bitmap(prepare_snapshot_bitmap(screen));
+
+	// the bitmap no longer holds the last movie frame
+	m_snap_signature = 0;
+}
+
+
+//-------------------------------------------------
+//  prepare_snapshot_bitmap - size the snapshot
+//  target and bitmap for the given screen and
+//  return the primitives to render into it
+//-------------------------------------------------
+
+render_primitive_list &video_manager::prepare_snapshot_bitmap(screen_device *screen)
 {
 	// select the appropriate view in our dummy target
 	if (m_snap_native && screen != NULL)
@@ -1084,15 +1188,29 @@ void video_manager::create_snapshot_bitmap(screen_device *screen)
 
 	// if we don't have a bitmap, or if it's not the right size, allocate a new one
 	if (!m_snap_bitmap.valid() || width != m_snap_bitmap.width() || height != m_snap_bitmap.height())
+	{
 		m_snap_bitmap.allocate(width, height);
+		m_snap_signature = 0;
+	}
+
+	// fetch the primitives for the screen
+	return m_snap_target->get_primitives();
+}
+
 
-	// render the screen there
-	render_primitive_list &primlist = m_snap_target->get_primitives();
+//-------------------------------------------------
+//  render_snapshot_bitmap - render a list of
+//  primitives into the snapshot bitmap
+//-------------------------------------------------
+
+void video_manager::render_snapshot_bitmap(render_primitive_list &primlist)
+{
+	// the list lock also holds off texture invalidation while we draw
 	primlist.acquire_lock();
 	if (machine().options().snap_bilinear())
-		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix32(0), m_snap_bitmap.width(), m_snap_bitmap.height(), m_snap_bitmap.rowpixels(), m_snap_work_queue, m_snap_bands);
 	else
-		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix32(0), m_snap_bitmap.width(), m_snap_bitmap.height(), m_snap_bitmap.rowpixels(), m_snap_work_queue, m_snap_bands);
 	primlist.release_lock();
 }
 
@@ -1239,65 +1357,154 @@ void video_manager::record_frame()
 	g_profiler.start(PROFILER_MOVIE_REC);
 	attotime curtime = machine().time();
 
-	// create the bitmap
-	create_snapshot_bitmap(NULL);
+	// wait for the previous frame to be written; this keeps us at most one frame behind
+	flush_recording();
 
-	// handle an AVI recording
+	// count the AVI frames due up to the current time
+	m_record_avi_frames = 0;
 	if (m_avi_file != NULL)
-	{
-		// loop until we hit the right time
-		while (m_avi_next_frame_time <= curtime)
+		for ( ; m_avi_next_frame_time <= curtime; m_avi_next_frame_time += m_avi_frame_period)
 		{
-			// write the next frame
-			avi_error avierr = avi_append_video_frame(m_avi_file, m_snap_bitmap);
-			if (avierr != AVIERR_NONE)
-			{
-				g_profiler.stop();
-				end_recording(MF_AVI);
-				break;
-			}
-
-			// advance time
-			m_avi_next_frame_time += m_avi_frame_period;
+			m_record_avi_frames++;
 			m_avi_frame++;
 		}
+
+	// count the MNG frames due up to the current time
+	m_record_mng_frames = 0;
+	m_record_mng_first = (m_mng_frame == 0);
+	if (m_mng_file != NULL)
+		for ( ; m_mng_next_frame_time <= curtime; m_mng_next_frame_time += m_mng_frame_period)
+		{
+			m_record_mng_frames++;
+			m_mng_frame++;
+		}
+
+	// nothing to write if no frame is due yet
+	if (m_record_avi_frames == 0 && m_record_mng_frames == 0)
+	{
+		g_profiler.stop();
+		return;
 	}
 
+	// capture everything that belongs to the emulation side now
+	m_record_primlist = &prepare_snapshot_bitmap(NULL);
+
+	// if the primitives and their texture contents match the last frame, reuse its bitmap
+	UINT64 signature = primlist_signature(*m_record_primlist);
+	m_record_redraw = (signature != m_snap_signature);
+	m_snap_signature = signature;
+
+	// either hand the frame to the recording thread or write it out now
+	if (m_record_work_queue != NULL)
+		osd_work_item_queue(m_record_work_queue, record_frame_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+	else
+	{
+		write_recorded_frame();
+		flush_recording();
+	}
+
+	g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  write_recorded_frame - render the pending
+//  movie frame and append it to the open movies
+//-------------------------------------------------
+
+void video_manager::write_recorded_frame()
+{
+	// create the bitmap
+	if (m_record_redraw)
+		render_snapshot_bitmap(*m_record_primlist);
+
+	// handle an AVI recording
+	for (int framenum = 0; framenum < m_record_avi_frames && !m_record_avi_failed; framenum++)
+		if (avi_append_video_frame(m_avi_file, m_snap_bitmap) != AVIERR_NONE)
+			m_record_avi_failed = true;
+
 	// handle a MNG recording
-	if (m_mng_file != NULL)
+	for (int framenum = 0; framenum < m_record_mng_frames && !m_record_mng_failed; framenum++)
 	{
-		// loop until we hit the right time
-		while (m_mng_next_frame_time <= curtime)
+		// set up the text fields in the movie info
+		png_info pnginfo = { 0 };
+		if (m_record_mng_first && framenum == 0)
 		{
-			// set up the text fields in the movie info
-			png_info pnginfo = { 0 };
-			if (m_mng_frame == 0)
-			{
-				astring text1(emulator_info::get_appname(), " ", build_version);
-				astring text2(machine().system().manufacturer, " ", machine().system().description);
-				png_add_text(&pnginfo, "Software", text1);
-				png_add_text(&pnginfo, "System", text2);
-			}
+			astring text1(emulator_info::get_appname(), " ", build_version);
+			astring text2(machine().system().manufacturer, " ", machine().system().description);
+			png_add_text(&pnginfo, "Software", text1);
+			png_add_text(&pnginfo, "System", text2);
+		}
 
-			// write the next frame
-			const rgb_t *palette = (machine().first_screen() !=NULL && machine().first_screen()->palette() != NULL) ? machine().first_screen()->palette()->palette()->entry_list_adjusted() : NULL;
-			int entries = (machine().first_screen() !=NULL && machine().first_screen()->palette() != NULL) ? machine().first_screen()->palette()->entries() : 0;
-			png_error error = mng_capture_frame(*m_mng_file, &pnginfo, m_snap_bitmap, entries, palette);
-			png_free(&pnginfo);
-			if (error != PNGERR_NONE)
-			{
-				g_profiler.stop();
-				end_recording(MF_MNG);
-				break;
-			}
+		// write the next frame; the snapshot bitmap is RGB32, so no palette is needed
+		assert(m_snap_bitmap.format() == BITMAP_FORMAT_RGB32);
+		png_error error = mng_capture_frame(*m_mng_file, &pnginfo, m_snap_bitmap, 0, NULL);
+		png_free(&pnginfo);
+		if (error != PNGERR_NONE)
+			m_record_mng_failed = true;
+	}
+}
 
-			// advance time
-			m_mng_next_frame_time += m_mng_frame_period;
-			m_mng_frame++;
-		}
+
+//-------------------------------------------------
+//  flush_recording - wait for pending movie
+//  frames to be written and stop any movie that
+//  could not be written
+//-------------------------------------------------
+
+void video_manager::flush_recording()
+{
+	if (m_record_work_queue != NULL)
+		osd_work_queue_wait(m_record_work_queue, osd_ticks_per_second() * 10);
+
+	// clear the flags before ending, since end_recording flushes as well
+	if (m_record_avi_failed)
+	{
+		m_record_avi_failed = false;
+		end_recording(MF_AVI);
 	}
+	if (m_record_mng_failed)
+	{
+		m_record_mng_failed = false;
+		end_recording(MF_MNG);
+	}
+}
 
-	g_profiler.stop();
+
+//-------------------------------------------------
+//  record_frame_static - work item callback for
+//  writing a movie frame
+//-------------------------------------------------
+
+void *video_manager::record_frame_static(void *param, int threadid)
+{
+	reinterpret_cast<video_manager *>(param)->write_recorded_frame();
+	return NULL;
+}
+
+
+//-------------------------------------------------
+//  record_sound_static - work item callback for
+//  writing a block of movie sound samples
+//-------------------------------------------------
+
+void *video_manager::record_sound_static(void *param, int threadid)
+{
+	record_sound_item *item = reinterpret_cast<record_sound_item *>(param);
+	video_manager &manager = *item->m_manager;
+
+	// skip the samples if the movie has already failed
+	if (!manager.m_record_avi_failed)
+	{
+		avi_error avierr = avi_append_sound_samples(manager.m_avi_file, 0, &item->m_samples[0], item->m_numsamples, 1);
+		if (avierr == AVIERR_NONE)
+			avierr = avi_append_sound_samples(manager.m_avi_file, 1, &item->m_samples[1], item->m_numsamples, 1);
+		if (avierr != AVIERR_NONE)
+			manager.m_record_avi_failed = true;
+	}
+
+	global_free(item);
+	return NULL;
 }
 
 //-------------------------------------------------
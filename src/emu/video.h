@@ -34,6 +34,7 @@ const int MAX_FRAMESKIP = FRAMESKIP_LEVELS - 2;
 
 // forward references
 class render_target;
+class render_primitive_list;
 class screen_device;
 struct avi_file;
 
@@ -115,8 +116,22 @@ private:
 
 	// snapshot/movie helpers
 	void create_snapshot_bitmap(screen_device *screen);
+	render_primitive_list &prepare_snapshot_bitmap(screen_device *screen);
+	void render_snapshot_bitmap(render_primitive_list &primlist);
 	file_error open_next(emu_file &file, const char *extension);
 	void record_frame();
+	void write_recorded_frame();
+	void flush_recording();
+	static void *record_frame_static(void *param, int threadid);
+	static void *record_sound_static(void *param, int threadid);
+
+	// a block of sound samples waiting to be written by the recording thread
+	struct record_sound_item
+	{
+		video_manager *     m_manager;              // owning manager
+		dynamic_array<INT16> m_samples;             // interleaved stereo samples
+		int                 m_numsamples;           // number of samples per channel
+	};
 
 	// internal state
 	running_machine &   m_machine;                  // reference to our machine
@@ -164,6 +179,9 @@ private:
 	bool                m_snap_native;              // are we using native per-screen layouts?
 	INT32               m_snap_width;               // width of snapshots (0 == auto)
 	INT32               m_snap_height;              // height of snapshots (0 == auto)
+	osd_work_queue *    m_snap_work_queue;          // work queue for banded snapshot rendering
+	int                 m_snap_bands;               // number of bands to render snapshots in
+	UINT64              m_snap_signature;           // signature of the primitives in the snapshot bitmap
 
 	// movie recording - MNG
 	auto_pointer<emu_file> m_mng_file;              // handle to the open movie file
@@ -177,6 +195,16 @@ private:
 	attotime            m_avi_next_frame_time;      // time of next frame
 	UINT32              m_avi_frame;                // current movie frame number
 
+	// movie recording - asynchronous writing
+	osd_work_queue *    m_record_work_queue;        // work queue for writing movie frames, or NULL
+	render_primitive_list *m_record_primlist;       // primitives of the frame being written
+	int                 m_record_avi_frames;        // number of AVI frames to write
+	int                 m_record_mng_frames;        // number of MNG frames to write
+	bool                m_record_mng_first;         // is this the first MNG frame?
+	bool                m_record_redraw;            // do the primitives need to be redrawn?
+	bool                m_record_avi_failed;        // flag: TRUE if writing the AVI failed
+	bool                m_record_mng_failed;        // flag: TRUE if writing the MNG failed
+
 	static const UINT8      s_skiptable[FRAMESKIP_LEVELS][FRAMESKIP_LEVELS];
 
 	static const attoseconds_t ATTOSECONDS_PER_SPEED_UPDATE = ATTOSECONDS_PER_SECOND / 4;
@@ -7,6 +7,14 @@
 
 #include "sound/sn76496.h"
 
+// use SSE2 for the priority merge under the same conditions as rgbutil.h
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define MEGADRIVE_USE_SSE2  (1)
+#include <emmintrin.h>
+#else
+#define MEGADRIVE_USE_SSE2  (0)
+#endif
+
 #define MAX_HPOSITION 480
 
 
@@ -2384,117 +2392,161 @@ void sega315_5313_device::render_videoline_to_videobuffer(int scanline)
 	}
 		/* END */
 
-/* MEGADRIVE_REG0C_SHADOW_HIGLIGHT */
-		/* Low Priority Sprites */
-		for (x=0;x<320;x++)
+	/* merge the low priority sprites, high priority A+B tiles and high priority sprites over
+	   the low priority tiles; each stage only looks at its own pixel, so all three are
+	   applied to a pixel in one pass */
+	if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
+		merge_priority_layers();
+	else
+		merge_priority_layers_shadow_highlight();
+}
+
+
+/* Normal processing: the last layer with an opaque pixel wins */
+void sega315_5313_device::merge_priority_layers()
+{
+	int x = 0;
+
+#if MEGADRIVE_USE_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i mask3f = _mm_set1_epi8(0x3f);
+	const __m128i mask0f = _mm_set1_epi8(0x0f);
+	const __m128i mask40 = _mm_set1_epi8(0x40);
+	const __m128i mask80 = _mm_set1_epi8(0x80);
+	const __m128i spriteflag = _mm_set1_epi32(0x10000);
+
+	for ( ; x < 320; x += 16)
+	{
+		__m128i spr = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&m_sprite_renderline[x+128]));
+		__m128i hp = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&m_highpri_renderline[x]));
+
+		/* high priority sprites beat high priority tiles, which beat low priority sprites */
+		__m128i lowspr = _mm_cmpeq_epi8(_mm_and_si128(spr, mask40), mask40);
+		__m128i highspr = _mm_cmpeq_epi8(_mm_and_si128(spr, mask80), mask80);
+		__m128i hightile = _mm_andnot_si128(_mm_cmpeq_epi8(_mm_and_si128(hp, mask0f), zero), _mm_cmpeq_epi8(_mm_and_si128(hp, mask80), mask80));
+		__m128i spritesel = _mm_or_si128(highspr, _mm_andnot_si128(hightile, lowspr));
+		__m128i anysel = _mm_or_si128(spritesel, hightile);
+		__m128i colour = _mm_and_si128(_mm_or_si128(_mm_and_si128(spritesel, spr), _mm_andnot_si128(spritesel, hp)), mask3f);
+
+		/* widen to 4 groups of 4 32-bit pixels */
+		__m128i colour16[2] = { _mm_unpacklo_epi8(colour, zero), _mm_unpackhi_epi8(colour, zero) };
+		__m128i sprite16[2] = { _mm_unpacklo_epi8(spritesel, spritesel), _mm_unpackhi_epi8(spritesel, spritesel) };
+		__m128i any16[2] = { _mm_unpacklo_epi8(anysel, anysel), _mm_unpackhi_epi8(anysel, anysel) };
+
+		for (int i = 0; i < 4; i++)
 		{
-			if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
+			__m128i *dest = reinterpret_cast<__m128i *>(&m_video_renderline[x + i*4]);
+			__m128i value, sprite, any;
+
+			if (i & 1)
 			{
-				if (m_sprite_renderline[x+128] & 0x40)
-				{
-					m_video_renderline[x] = m_sprite_renderline[x+128]&0x3f;
-					m_video_renderline[x] |= 0x10000; // mark as sprite pixel
-				}
+				value = _mm_unpackhi_epi16(colour16[i>>1], zero);
+				sprite = _mm_unpackhi_epi16(sprite16[i>>1], sprite16[i>>1]);
+				any = _mm_unpackhi_epi16(any16[i>>1], any16[i>>1]);
 			}
 			else
-			{   /* Special Shadow / Highlight processing */
+			{
+				value = _mm_unpacklo_epi16(colour16[i>>1], zero);
+				sprite = _mm_unpacklo_epi16(sprite16[i>>1], sprite16[i>>1]);
+				any = _mm_unpacklo_epi16(any16[i>>1], any16[i>>1]);
+			}
 
-				if (m_sprite_renderline[x+128] & 0x40)
-				{
-					UINT8 spritedata;
-					spritedata = m_sprite_renderline[x+128]&0x3f;
+			value = _mm_or_si128(value, _mm_and_si128(sprite, spriteflag));
+			_mm_storeu_si128(dest, _mm_or_si128(_mm_and_si128(any, value), _mm_andnot_si128(any, _mm_loadu_si128(dest))));
+		}
+	}
+#endif
 
-					if ((spritedata==0x0e) || (spritedata==0x1e) || (spritedata==0x2e))
-					{
-						/* BUG in sprite chip, these colours are always normal intensity */
-						m_video_renderline[x] = spritedata | 0x4000;
-						m_video_renderline[x] |= 0x10000; // mark as sprite pixel
-					}
-					else if (spritedata==0x3e)
-					{
-						/* Everything below this is half colour, mark with 0x8000 to mark highlight' */
-						m_video_renderline[x] = m_video_renderline[x]|0x8000; // spiderwebs..
-					}
-					else if (spritedata==0x3f)
-					{
-						/* This is a Shadow operator, but everything below is already low pri, no effect */
-						m_video_renderline[x] = m_video_renderline[x]|0x2000;
+	for ( ; x < 320; x++)
+	{
+		UINT8 spritedata = m_sprite_renderline[x+128];
+		UINT8 dat = m_highpri_renderline[x];
 
-					}
-					else
-					{
-						m_video_renderline[x] = spritedata;
-						m_video_renderline[x] |= 0x10000; // mark as sprite pixel
-					}
+		/* Low Priority Sprites */
+		if (spritedata & 0x40)
+			m_video_renderline[x] = (spritedata & 0x3f) | 0x10000; // mark as sprite pixel
 
-				}
-			}
-		}
 		/* High Priority A+B Tiles */
-		for (x=0;x<320;x++)
+		if ((dat & 0x80) && (dat & 0x0f))
+			m_video_renderline[x] = dat & 0x3f;
+
+		/* High Priority Sprites */
+		if (spritedata & 0x80)
+			m_video_renderline[x] = (spritedata & 0x3f) | 0x10000; // mark as sprite pixel
+	}
+}
+
+
+/* Special Shadow / Highlight processing */
+void sega315_5313_device::merge_priority_layers_shadow_highlight()
+{
+	for (int x = 0; x < 320; x++)
+	{
+		UINT32 video = m_video_renderline[x];
+		UINT8 spritedata;
+		int dat;
+
+		/* Low Priority Sprites */
+		if (m_sprite_renderline[x+128] & 0x40)
 		{
-			if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
-			{
-				/* Normal Processing */
-				int dat;
-				dat = m_highpri_renderline[x];
+			spritedata = m_sprite_renderline[x+128]&0x3f;
 
-				if (dat&0x80)
-				{
-						if (dat&0x0f) m_video_renderline[x] = m_highpri_renderline[x]&0x3f;
-				}
+			if ((spritedata==0x0e) || (spritedata==0x1e) || (spritedata==0x2e))
+			{
+				/* BUG in sprite chip, these colours are always normal intensity */
+				video = spritedata | 0x4000;
+				video |= 0x10000; // mark as sprite pixel
+			}
+			else if (spritedata==0x3e)
+			{
+				/* Everything below this is half colour, mark with 0x8000 to mark highlight' */
+				video = video|0x8000; // spiderwebs..
+			}
+			else if (spritedata==0x3f)
+			{
+				/* This is a Shadow operator, but everything below is already low pri, no effect */
+				video = video|0x2000;
 			}
 			else
 			{
-				/* Shadow / Highlight Mode */
-				int dat;
-				dat = m_highpri_renderline[x];
-
-				if (dat&0x80)
-				{
-						if (dat&0x0f) m_video_renderline[x] = (m_highpri_renderline[x]&0x3f) | 0x4000;
-						else m_video_renderline[x] = m_video_renderline[x] | 0x4000; // set 'normal'
-				}
+				video = spritedata;
+				video |= 0x10000; // mark as sprite pixel
 			}
 		}
 
+		/* High Priority A+B Tiles */
+		dat = m_highpri_renderline[x];
+
+		if (dat&0x80)
+		{
+				if (dat&0x0f) video = (dat&0x3f) | 0x4000;
+				else video = video | 0x4000; // set 'normal'
+		}
+
 		/* High Priority Sprites */
-		for (x=0;x<320;x++)
+		if (m_sprite_renderline[x+128] & 0x80)
 		{
-			if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
+			spritedata = m_sprite_renderline[x+128]&0x3f;
+
+			if (spritedata==0x3e)
 			{
-				/* Normal */
-				if (m_sprite_renderline[x+128] & 0x80)
-				{
-					m_video_renderline[x] = m_sprite_renderline[x+128]&0x3f;
-					m_video_renderline[x] |= 0x10000; // mark as sprite pixel
-				}
+				/* set flag 0x8000 to indicate highlight */
+				video = video|0x8000;
+			}
+			else if (spritedata==0x3f)
+			{
+				/* This is a Shadow operator set shadow bit */
+				video = video|0x2000;
 			}
 			else
 			{
-				if (m_sprite_renderline[x+128] & 0x80)
-				{
-					UINT8 spritedata;
-					spritedata = m_sprite_renderline[x+128]&0x3f;
-
-					if (spritedata==0x3e)
-					{
-						/* set flag 0x8000 to indicate highlight */
-						m_video_renderline[x] = m_video_renderline[x]|0x8000;
-					}
-					else if (spritedata==0x3f)
-					{
-						/* This is a Shadow operator set shadow bit */
-						m_video_renderline[x] = m_video_renderline[x]|0x2000;
-					}
-					else
-					{
-						m_video_renderline[x] = spritedata | 0x4000;
-						m_video_renderline[x] |= 0x10000; // mark as sprite pixel
-					}
-				}
+				video = spritedata | 0x4000;
+				video |= 0x10000; // mark as sprite pixel
 			}
 		}
+
+		m_video_renderline[x] = video;
+	}
 }
 
 
@@ -2516,32 +2568,36 @@ void sega315_5313_device::render_videobuffer_to_screenbuffer(int scanline)
 	else
 		lineptr = m_render_line;
 
-	for (int x = 0; x < 320; x++)
+	if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
 	{
-		UINT32 dat = m_video_renderline[x];
-
-		if (!(dat & 0x20000))
-			m_render_line_raw[x] = 0x100;
-		else
-			m_render_line_raw[x] = 0x000;
-
-
-		if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
+		for (int x = 0; x < 320; x++)
 		{
+			UINT32 dat = m_video_renderline[x];
+			UINT16 raw = (dat & 0x20000) ? 0x000 : 0x100;
+
 			if (dat & 0x10000)
 			{
 				lineptr[x] = m_palette_lookup_sprite[(dat & 0x3f)];
-				m_render_line_raw[x] |= (dat & 0x3f) | 0x080;
+				m_render_line_raw[x] = raw | (dat & 0x3f) | 0x080;
 			}
 			else
 			{
 				lineptr[x] = m_palette_lookup[(dat & 0x3f)];
-				m_render_line_raw[x] |= (dat & 0x3f) | 0x040;
+				m_render_line_raw[x] = raw | (dat & 0x3f) | 0x040;
 			}
-
 		}
-		else
+	}
+	else
+	{
+		for (int x = 0; x < 320; x++)
 		{
+			UINT32 dat = m_video_renderline[x];
+
+			if (!(dat & 0x20000))
+				m_render_line_raw[x] = 0x100;
+			else
+				m_render_line_raw[x] = 0x000;
+
 			/* Verify my handling.. I'm not sure all cases are correct */
 			switch (dat & 0x1e000)
 			{
@@ -338,6 +338,8 @@ private:
 	void render_spriteline_to_spritebuffer(int scanline);
 	void render_videoline_to_videobuffer(int scanline);
 	void render_videobuffer_to_screenbuffer(int scanline);
+	void merge_priority_layers();
+	void merge_priority_layers_shadow_highlight();
 
 	/* variables used during emulation - not saved */
 	UINT8* m_sprite_renderline;
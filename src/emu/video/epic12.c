@@ -21,11 +21,18 @@ epic12_device::epic12_device(const machine_config &mconfig, const char *tag, dev
 	m_gfx_scroll_0_y = 0;
 	m_gfx_scroll_1_x = 0;
 	m_gfx_scroll_1_y = 0;
-	m_gfx_addr_shadowcopy = 0;
-	m_gfx_scroll_0_x_shadowcopy = 0;
-	m_gfx_scroll_0_y_shadowcopy = 0;
-	m_gfx_scroll_1_x_shadowcopy = 0;
-	m_gfx_scroll_1_y_shadowcopy = 0;
+	for (int i = 0; i < ARRAY_LENGTH(m_blit_list); i++)
+	{
+		m_blit_list[i].device = this;
+		m_blit_list[i].request = 0;
+		m_blit_list[i].ram16_copy = 0;
+		m_blit_list[i].gfx_addr = 0;
+		m_blit_list[i].gfx_scroll_1_x = 0;
+		m_blit_list[i].gfx_scroll_1_y = 0;
+	}
+	m_blit_list_next = 0;
+	m_ram16_copy = 0;
+	m_shadow_blit_delay = 0;
 	epic12_device_blit_delay = 0;
 }
 
@@ -42,7 +49,9 @@ void epic12_device::device_start()
 	m_clip = m_bitmaps->cliprect();
 	m_clip.set(0, 0x2000-1, 0, 0x1000-1);
 
-	m_ram16_copy = auto_alloc_array(machine(), UINT16, m_main_ramsize/2);
+	for (int i = 0; i < ARRAY_LENGTH(m_blit_list); i++)
+		m_blit_list[i].ram16_copy = auto_alloc_array(machine(), UINT16, m_main_ramsize/2);
+	m_ram16_copy = m_blit_list[0].ram16_copy;
 
 	m_blitter_delay_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(epic12_device::blitter_delay_callback),this));
 	m_blitter_delay_timer->adjust(attotime::never);
@@ -57,7 +66,7 @@ void epic12_device::device_reset()
 	}
 	else
 	{
-		m_use_ram = m_ram16_copy; // slow mode
+		m_use_ram = m_blit_list[0].ram16_copy; // slow mode
 		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ);
 	}
 
@@ -303,7 +312,7 @@ inline void epic12_device::gfx_draw_shadow_copy(address_space &space, offs_t *ad
 
 
 	// todo, calcualte clipping.
-	epic12_device_blit_delay += w*h;
+	m_shadow_blit_delay += w*h;
 
 }
 
@@ -528,7 +537,6 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 void epic12_device::gfx_create_shadow_copy(address_space &space)
 {
 	offs_t addr = m_gfx_addr & 0x1fffffff;
-	m_clip.set(m_gfx_scroll_1_x_shadowcopy, m_gfx_scroll_1_x_shadowcopy + 320-1, m_gfx_scroll_1_y_shadowcopy, m_gfx_scroll_1_y_shadowcopy + 240-1);
 
 	while (1)
 	{
@@ -541,10 +549,7 @@ void epic12_device::gfx_create_shadow_copy(address_space &space)
 				return;
 
 			case 0xc000:
-				if (COPY_NEXT_WORD(space, &addr)) // cliptype
-					m_clip.set(m_gfx_scroll_1_x_shadowcopy, m_gfx_scroll_1_x_shadowcopy + 320-1, m_gfx_scroll_1_y_shadowcopy, m_gfx_scroll_1_y_shadowcopy + 240-1);
-				else
-					m_clip.set(0, 0x2000-1, 0, 0x1000-1);
+				COPY_NEXT_WORD(space, &addr); // cliptype, only the blitter thread needs m_clip
 				break;
 
 			case 0x2000:
@@ -565,10 +570,11 @@ void epic12_device::gfx_create_shadow_copy(address_space &space)
 }
 
 
-void epic12_device::gfx_exec(void)
+void epic12_device::gfx_exec(const blit_list &list)
 {
-	offs_t addr = m_gfx_addr_shadowcopy & 0x1fffffff;
-	m_clip.set(m_gfx_scroll_1_x_shadowcopy, m_gfx_scroll_1_x_shadowcopy + 320-1, m_gfx_scroll_1_y_shadowcopy, m_gfx_scroll_1_y_shadowcopy + 240-1);
+	offs_t addr = list.gfx_addr & 0x1fffffff;
+	m_use_ram = list.ram16_copy;
+	m_clip.set(list.gfx_scroll_1_x, list.gfx_scroll_1_x + 320-1, list.gfx_scroll_1_y, list.gfx_scroll_1_y + 240-1);
 
 //  logerror("GFX EXEC: %08X\n", addr);
 
@@ -584,7 +590,7 @@ void epic12_device::gfx_exec(void)
 
 			case 0xc000:
 				if (READ_NEXT_WORD(&addr)) // cliptype
-					m_clip.set(m_gfx_scroll_1_x_shadowcopy, m_gfx_scroll_1_x_shadowcopy + 320-1, m_gfx_scroll_1_y_shadowcopy, m_gfx_scroll_1_y_shadowcopy + 240-1);
+					m_clip.set(list.gfx_scroll_1_x, list.gfx_scroll_1_x + 320-1, list.gfx_scroll_1_y, list.gfx_scroll_1_y + 240-1);
 				else
 					m_clip.set(0, 0x2000-1, 0, 0x1000-1);
 				break;
@@ -652,9 +658,9 @@ void epic12_device::gfx_exec_unsafe(void)
 
 void *epic12_device::blit_request_callback(void *param, int threadid)
 {
-	epic12_device *object = reinterpret_cast<epic12_device *>(param);
+	blit_list *list = reinterpret_cast<blit_list *>(param);
 
-	object->gfx_exec();
+	list->device->gfx_exec(*list);
 	return NULL;
 }
 
@@ -670,6 +676,21 @@ void *epic12_device::blit_request_callback_unsafe(void *param, int threadid)
 }
 
 
+void epic12_device::wait_blit_list(blit_list &list)
+{
+	if (list.request)
+	{
+		int result;
+		do
+		{
+			result = osd_work_item_wait(list.request, 1000);
+		} while (result==0);
+		osd_work_item_release(list.request);
+		list.request = 0;
+	}
+}
+
+
 READ32_MEMBER( epic12_device::gfx_ready_r )
 {
 	return 0x00000010;
@@ -693,32 +714,26 @@ WRITE32_MEMBER( epic12_device::gfx_exec_w )
 		if (data & 1)
 		{
 			//g_profiler.start(PROFILER_USER1);
-			// make sure we've not already got a request running
-			if (m_blitter_request)
-			{
-				int result;
-				do
-				{
-					result = osd_work_item_wait(m_blitter_request, 1000);
-				} while (result==0);
-				osd_work_item_release(m_blitter_request);
-			}
-
-			epic12_device_blit_delay = 0;
+			// the lists alternate between shadow copies, so only wait for the list that last used
+			// this one; the previous list can keep drawing while we build the next
+			blit_list &list = m_blit_list[m_blit_list_next];
+			m_blit_list_next = (m_blit_list_next + 1) % ARRAY_LENGTH(m_blit_list);
+			wait_blit_list(list);
+
+			m_ram16_copy = list.ram16_copy;
+			m_shadow_blit_delay = 0;
 			gfx_create_shadow_copy(space); // create a copy of the blit list so we can safely thread it.
 
-			if (epic12_device_blit_delay)
+			if (m_shadow_blit_delay)
 			{
 				m_blitter_busy = 1;
-				m_blitter_delay_timer->adjust(attotime::from_nsec(epic12_device_blit_delay*8)); // NOT accurate timing (currently ignored anyway)
+				m_blitter_delay_timer->adjust(attotime::from_nsec(m_shadow_blit_delay*8)); // NOT accurate timing (currently ignored anyway)
 			}
 
-			m_gfx_addr_shadowcopy = m_gfx_addr;
-			m_gfx_scroll_0_x_shadowcopy =  m_gfx_scroll_0_x;
-			m_gfx_scroll_0_y_shadowcopy = m_gfx_scroll_0_y;
-			m_gfx_scroll_1_x_shadowcopy = m_gfx_scroll_1_x;
-			m_gfx_scroll_1_y_shadowcopy = m_gfx_scroll_1_y;
-			m_blitter_request = osd_work_item_queue(m_work_queue, blit_request_callback, (void*)this, 0);
+			list.gfx_addr = m_gfx_addr;
+			list.gfx_scroll_1_x = m_gfx_scroll_1_x;
+			list.gfx_scroll_1_y = m_gfx_scroll_1_y;
+			list.request = osd_work_item_queue(m_work_queue, blit_request_callback, (void*)&list, 0);
 			//g_profiler.stop();
 		}
 	}
@@ -766,15 +781,9 @@ void epic12_device::draw_screen(bitmap_rgb32 &bitmap, const rectangle &cliprect
 {
 	if (!m_is_unsafe)
 	{
-		if (m_blitter_request)
-		{
-			int result;
-			do
-			{
-				result = osd_work_item_wait(m_blitter_request, 1000);
-			} while (result==0);
-			osd_work_item_release(m_blitter_request);
-		}
+		// lists are queued in order, so waiting for both finishes everything requested so far
+		for (int i = 0; i < ARRAY_LENGTH(m_blit_list); i++)
+			wait_blit_list(m_blit_list[(m_blit_list_next + i) % ARRAY_LENGTH(m_blit_list)]);
 	}
 
 	int scroll_0_x, scroll_0_y;
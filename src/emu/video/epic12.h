@@ -90,17 +90,28 @@ public:
 	// thread safe mode, with no delays & shadow ram copy
 	DECLARE_READ32_MEMBER(blitter_r);
 	DECLARE_WRITE32_MEMBER(blitter_w);
-	UINT32 m_gfx_addr_shadowcopy;
-	UINT32 m_gfx_scroll_0_x_shadowcopy, m_gfx_scroll_0_y_shadowcopy;
-	UINT32 m_gfx_scroll_1_x_shadowcopy, m_gfx_scroll_1_y_shadowcopy;
+	// a blit list handed to the blitter thread, with the RAM words it reads copied out
+	// so the main cpu can build the next list while this one is still being drawn
+	struct blit_list
+	{
+		epic12_device *device;
+		osd_work_item *request;
+		UINT16* ram16_copy;
+		UINT32 gfx_addr;
+		UINT32 gfx_scroll_1_x, gfx_scroll_1_y;
+	};
+	blit_list m_blit_list[2];
+	int m_blit_list_next;
 	UINT16* m_ram16_copy;
+	UINT64 m_shadow_blit_delay;
+	void wait_blit_list(blit_list &list);
 	inline void gfx_upload_shadow_copy(address_space &space, offs_t *addr);
 	inline void gfx_create_shadow_copy(address_space &space);
 	inline UINT16 COPY_NEXT_WORD(address_space &space, offs_t *addr);
 	inline void gfx_draw_shadow_copy(address_space &space, offs_t *addr);
 	inline void gfx_upload(offs_t *addr);
 	inline void gfx_draw(offs_t *addr);
-	void gfx_exec(void);
+	void gfx_exec(const blit_list &list);
 	DECLARE_READ32_MEMBER( gfx_ready_r );
 	DECLARE_WRITE32_MEMBER( gfx_exec_w );
 
@@ -352,8 +352,15 @@ UINT16 vga_device::offset()
 		return vga.crtc.offset << 2;
 }
 
+/* spread the 8 pixels of a plane byte into the low bit of 8 byte lanes, leftmost pixel in the lowest lane */
+static inline UINT64 planar_expand(UINT8 data)
+{
+	return ((((data * U64(0x0101010101010101)) & U64(0x0102040810204080)) + U64(0x7f7f7f7f7f7f7f7f)) >> 7) & U64(0x0101010101010101);
+}
+
 void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle &visarea = machine().first_screen()->visible_area();
 	UINT8 ch, attr;
 	UINT8 bits;
 	UINT32 font_base;
@@ -395,7 +402,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 					else
 						pen = vga.pens[back_col];
 
-					if(!machine().first_screen()->visible_area().contains(column*width+w, line+h))
+					if(!visarea.contains(column*width+w, line+h))
 						continue;
 					bitmapline[column*width+w] = pen;
 
@@ -408,7 +415,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 					else
 						pen = vga.pens[back_col];
 
-					if(!machine().first_screen()->visible_area().contains(column*width+w, line+h))
+					if(!visarea.contains(column*width+w, line+h))
 						continue;
 					bitmapline[column*width+w] = pen;
 				}
@@ -419,7 +426,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 						(h<=vga.crtc.cursor_scan_end)&&(h<height)&&(line+h<TEXT_LINES);
 						h++)
 				{
-					if(!machine().first_screen()->visible_area().contains(column*width, line+h))
+					if(!visarea.contains(column*width, line+h))
 						continue;
 					bitmap.plot_box(column*width, line+h, width, 1, vga.pens[attr&0xf]);
 				}
@@ -430,6 +437,7 @@ void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 {
+	const rectangle &visarea = machine().first_screen()->visible_area();
 	int pos, line, column, c, addr, i, yi;
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
 	UINT32 *bitmapline;
@@ -448,23 +456,17 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 
 			for (pos=addr, c=0, column=0; column<EGA_COLUMNS+1; column++, c+=8, pos=(pos+1)&0xffff)
 			{
-				int data[4];
+				/* convert the four planes to eight 4bpp pixels at once */
+				UINT64 data = planar_expand(vga.memory[(pos & 0xffff)]);
+				data |= planar_expand(vga.memory[(pos & 0xffff)+0x10000])<<1;
+				data |= planar_expand(vga.memory[(pos & 0xffff)+0x20000])<<2;
+				data |= planar_expand(vga.memory[(pos & 0xffff)+0x30000])<<3;
 
-				data[0]=vga.memory[(pos & 0xffff)];
-				data[1]=vga.memory[(pos & 0xffff)+0x10000]<<1;
-				data[2]=vga.memory[(pos & 0xffff)+0x20000]<<2;
-				data[3]=vga.memory[(pos & 0xffff)+0x30000]<<3;
-
-				for (i = 7; i >= 0; i--)
+				for (i = 0; i < 8; i++, data >>= 8)
 				{
-					pen = vga.pens[(data[0]&1) | (data[1]&2) | (data[2]&4) | (data[3]&8)];
-
-					data[0]>>=1;
-					data[1]>>=1;
-					data[2]>>=1;
-					data[3]>>=1;
+					pen = vga.pens[data & 0x0f];
 
-					if(!machine().first_screen()->visible_area().contains(c+i-pel_shift, line + yi))
+					if(!visarea.contains(c+i-pel_shift, line + yi))
 						continue;
 					bitmapline[c+i-pel_shift] = pen;
 				}
@@ -476,6 +478,7 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 /* TODO: I'm guessing that in 256 colors mode every pixel actually outputs two pixels. Is it right? */
 void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle &visarea = machine().first_screen()->visible_area();
 	int pos, line, column, c, addr, curr_addr;
 	UINT32 *bitmapline;
 	UINT16 mask_comp;
@@ -508,7 +511,7 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 					for(xi=0;xi<8;xi++)
 					{
-						if(!machine().first_screen()->visible_area().contains(c+xi-(pel_shift), line + yi))
+						if(!visarea.contains(c+xi-(pel_shift), line + yi))
 							continue;
 						bitmapline[c+xi-(pel_shift)] = m_palette->pen(vga.memory[(pos & 0xffff)+((xi >> 1)*0x10000)]);
 					}
@@ -535,7 +538,7 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 					for(xi=0;xi<0x10;xi++)
 					{
-						if(!machine().first_screen()->visible_area().contains(c+xi-(pel_shift), line + yi))
+						if(!visarea.contains(c+xi-(pel_shift), line + yi))
 							continue;
 						bitmapline[c+xi-pel_shift] = m_palette->pen(vga.memory[(pos+(xi >> 1)) & 0xffff]);
 					}
@@ -547,6 +550,7 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void vga_device::vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle &visarea = machine().first_screen()->visible_area();
 	UINT32 *bitmapline;
 	int height = (vga.crtc.scan_doubling + 1);
 	int x,xi,y,yi;
@@ -569,7 +573,7 @@ void vga_device::vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				for(xi=0;xi<4;xi++)
 				{
 					pen = vga.pens[(vga.memory[addr] >> (6-xi*2)) & 3];
-					if(!machine().first_screen()->visible_area().contains(x+xi, y * height + yi))
+					if(!visarea.contains(x+xi, y * height + yi))
 						continue;
 					bitmapline[x+xi] = pen;
 				}
@@ -582,6 +586,7 @@ void vga_device::vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void vga_device::vga_vh_mono(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle &visarea = machine().first_screen()->visible_area();
 	UINT32 *bitmapline;
 	int height = (vga.crtc.scan_doubling + 1);
 	int x,xi,y,yi;
@@ -604,7 +609,7 @@ void vga_device::vga_vh_mono(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 				for(xi=0;xi<8;xi++)
 				{
 					pen = vga.pens[(vga.memory[addr] >> (7-xi)) & 1];
-					if(!machine().first_screen()->visible_area().contains(x+xi, y * height + yi))
+					if(!visarea.contains(x+xi, y * height + yi))
 						continue;
 					bitmapline[x+xi] = pen;
 				}
@@ -617,6 +622,7 @@ void vga_device::vga_vh_mono(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle &visarea = machine().first_screen()->visible_area();
 	int pos, line, column, c, addr, curr_addr;
 	UINT32 *bitmapline;
 	UINT16 mask_comp;
@@ -657,7 +663,7 @@ void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 					for(xi=0;xi<8;xi++)
 					{
-						if(!machine().first_screen()->visible_area().contains(c+xi, line + yi))
+						if(!visarea.contains(c+xi, line + yi))
 							continue;
 						bitmapline[c+xi] = m_palette->pen(vga.memory[(pos+(xi))]);
 					}
@@ -669,6 +675,7 @@ void svga_device::svga_vh_rgb8(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle &visarea = machine().first_screen()->visible_area();
 	#define MV(x) (vga.memory[x]+(vga.memory[x+1]<<8))
 	#define IV 0xff000000
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -696,12 +703,13 @@ void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 			{
 				int r,g,b;
 
-				if(!machine().first_screen()->visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
-				r = (MV(pos+xm)&0x7c00)>>10;
-				g = (MV(pos+xm)&0x03e0)>>5;
-				b = (MV(pos+xm)&0x001f)>>0;
+				UINT16 data = MV(pos+xm);
+				r = (data&0x7c00)>>10;
+				g = (data&0x03e0)>>5;
+				b = (data&0x001f)>>0;
 				r = (r << 3) | (r & 0x7);
 				g = (g << 3) | (g & 0x7);
 				b = (b << 3) | (b & 0x7);
@@ -713,6 +721,7 @@ void svga_device::svga_vh_rgb15(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle &visarea = machine().first_screen()->visible_area();
 	#define MV(x) (vga.memory[x]+(vga.memory[x+1]<<8))
 	#define IV 0xff000000
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -740,12 +749,13 @@ void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 			{
 				int r,g,b;
 
-				if(!machine().first_screen()->visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
-				r = (MV(pos+xm)&0xf800)>>11;
-				g = (MV(pos+xm)&0x07e0)>>5;
-				b = (MV(pos+xm)&0x001f)>>0;
+				UINT16 data = MV(pos+xm);
+				r = (data&0xf800)>>11;
+				g = (data&0x07e0)>>5;
+				b = (data&0x001f)>>0;
 				r = (r << 3) | (r & 0x7);
 				g = (g << 2) | (g & 0x3);
 				b = (b << 3) | (b & 0x7);
@@ -757,6 +767,7 @@ void svga_device::svga_vh_rgb16(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle &visarea = machine().first_screen()->visible_area();
 	#define MD(x) (vga.memory[x]+(vga.memory[x+1]<<8)+(vga.memory[x+2]<<16))
 	#define ID 0xff000000
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -784,12 +795,13 @@ void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 			{
 				int r,g,b;
 
-				if(!machine().first_screen()->visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
-				r = (MD(pos+xm)&0xff0000)>>16;
-				g = (MD(pos+xm)&0x00ff00)>>8;
-				b = (MD(pos+xm)&0x0000ff)>>0;
+				UINT32 data = MD(pos+xm);
+				r = (data&0xff0000)>>16;
+				g = (data&0x00ff00)>>8;
+				b = (data&0x0000ff)>>0;
 				bitmapline[c+xi] = IV|(r<<16)|(g<<8)|(b<<0);
 			}
 		}
@@ -798,6 +810,7 @@ void svga_device::svga_vh_rgb24(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 
 void svga_device::svga_vh_rgb32(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	const rectangle &visarea = machine().first_screen()->visible_area();
 	#define MD(x) (vga.memory[x]+(vga.memory[x+1]<<8)+(vga.memory[x+2]<<16))
 	#define ID 0xff000000
 	int height = vga.crtc.maximum_scan_line * (vga.crtc.scan_doubling + 1);
@@ -825,12 +838,13 @@ void svga_device::svga_vh_rgb32(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 			{
 				int r,g,b;
 
-				if(!machine().first_screen()->visible_area().contains(c+xi, line + yi))
+				if(!visarea.contains(c+xi, line + yi))
 					continue;
 
-				r = (MD(pos+xm)&0xff0000)>>16;
-				g = (MD(pos+xm)&0x00ff00)>>8;
-				b = (MD(pos+xm)&0x0000ff)>>0;
+				UINT32 data = MD(pos+xm);
+				r = (data&0xff0000)>>16;
+				g = (data&0x00ff00)>>8;
+				b = (data&0x0000ff)>>0;
 				bitmapline[c+xi] = IV|(r<<16)|(g<<8)|(b<<0);
 			}
 		}
@@ -59,6 +59,8 @@
 #define POLYFLAG_INCLUDE_BOTTOM_EDGE        0x01
 #define POLYFLAG_INCLUDE_RIGHT_EDGE         0x02
 #define POLYFLAG_NO_WORK_QUEUE              0x04
+#define POLYFLAG_DEFERRED_SETUP             0x08        // triangle extents are computed by the workers
+#define POLYFLAG_TILE_BINNING               0x10        // work is binned per bucket and queued on wait()
 
 #define SCANLINES_PER_BUCKET                8
 #define CACHE_LINE_SIZE                     64          // this is a general guess
@@ -136,28 +138,50 @@ public:
 	_ObjectData &object_data_last() const { return m_object.last(); }
 
 	// tiles
-	UINT32 render_tile(const rectangle &cliprect, render_delegate callback, int paramcount, const vertex_t &v1, const vertex_t &v2);
+	UINT32 render_tile(const rectangle &cliprect, const render_delegate &callback, int paramcount, const vertex_t &v1, const vertex_t &v2);
 
 	// triangles
-	UINT32 render_triangle(const rectangle &cliprect, render_delegate callback, int paramcount, const vertex_t &v1, const vertex_t &v2, const vertex_t &v3);
-	UINT32 render_triangle_fan(const rectangle &cliprect, render_delegate callback, int paramcount, int numverts, const vertex_t *v);
-	UINT32 render_triangle_strip(const rectangle &cliprect, render_delegate callback, int paramcount, int numverts, const vertex_t *v);
-	UINT32 render_triangle_custom(const rectangle &cliprect, render_delegate callback, int startscanline, int numscanlines, const extent_t *extents);
+	UINT32 render_triangle(const rectangle &cliprect, const render_delegate &callback, int paramcount, const vertex_t &v1, const vertex_t &v2, const vertex_t &v3);
+	UINT32 render_triangle_fan(const rectangle &cliprect, const render_delegate &callback, int paramcount, int numverts, const vertex_t *v);
+	UINT32 render_triangle_strip(const rectangle &cliprect, const render_delegate &callback, int paramcount, int numverts, const vertex_t *v);
+	UINT32 render_triangle_custom(const rectangle &cliprect, const render_delegate &callback, int startscanline, int numscanlines, const extent_t *extents);
+	UINT32 render_triangle_batch(const rectangle &cliprect, const render_delegate &callback, int paramcount, int numtris, const vertex_t *v, const _ObjectData *objects = NULL);
 
 	// polygons
 	template<int _NumVerts>
-	UINT32 render_polygon(const rectangle &cliprect, render_delegate callback, int paramcount, const vertex_t *v);
+	UINT32 render_polygon(const rectangle &cliprect, const render_delegate &callback, int paramcount, const vertex_t *v);
+	UINT32 render_quad_fan(const rectangle &cliprect, const render_delegate &callback, int paramcount, int numverts, const vertex_t *v);
 
 	// public helpers
 	int zclip_if_less(int numverts, const vertex_t *v, vertex_t *outv, int paramcount, _BaseType clipval);
 
 private:
+	// triangle_setup holds what is needed to compute a triangle's extents
+	struct triangle_setup
+	{
+		_BaseType           v1x, v1y;               // top vertex
+		_BaseType           v2x, v2y;               // middle vertex
+		_BaseType           dxdy_v1v2;              // edge slopes
+		_BaseType           dxdy_v1v3;
+		_BaseType           dxdy_v2v3;
+		_BaseType           param_start[_MaxParams]; // parameter values at (0,0)
+		_BaseType           param_dpdx[_MaxParams]; // parameter deltas along X
+		_BaseType           param_dpdy[_MaxParams]; // parameter deltas along Y
+		INT32               clipminx, clipmaxx;     // horizontal clip
+		int                 paramcount;             // number of parameters
+	};
+
+	// computes extents for deferred triangles; only bound where render_triangle is used
+	typedef UINT32 (poly_manager::*extents_func)(const triangle_setup &setup, INT32 scanline, int count, extent_t *extent);
+
 	// polygon_info describes a single polygon, which includes the poly_params
 	struct polygon_info
 	{
 		poly_manager *      m_owner;                // pointer back to the poly manager
 		_ObjectData *       m_object;               // object data pointer
-		render_delegate     m_callback;             // callback to handle a scanline's worth of work
+		const render_delegate *m_callback;          // callback to handle a scanline's worth of work
+		extents_func        m_deferred;             // if non-NULL, the worker computes the extents
+		const triangle_setup *m_setup;              // triangle setup for deferred extents
 	};
 
 	// internal unit of work
@@ -221,7 +245,9 @@ private:
 	// internal array types
 	typedef poly_array<polygon_info, _MaxPolys> polygon_array;
 	typedef poly_array<_ObjectData, _MaxPolys + 1> objectdata_array;
+	typedef poly_array<render_delegate, _MaxPolys> callback_array;
 	typedef poly_array<work_unit, MIN(_MaxPolys * UNITS_PER_POLY, 65535)> unit_array;
+	typedef poly_array<triangle_setup, _MaxPolys> setup_array;
 
 	// round in a cross-platform consistent manner
 	inline INT32 round_coordinate(_BaseType value)
@@ -234,20 +260,29 @@ private:
 	}
 
 	// internal helpers
-	polygon_info &polygon_alloc(int minx, int maxx, int miny, int maxy, render_delegate callback)
+	polygon_info &polygon_alloc(int minx, int maxx, int miny, int maxy, const render_delegate &callback)
 	{
-		// wait for space in the polygon and unit arrays
+		// wait for space in the polygon, unit and callback arrays
 		m_polygon.wait_for_space();
 		m_unit.wait_for_space((maxy - miny) / SCANLINES_PER_BUCKET + 2);
+		m_callback.wait_for_space();
+
+		// only copy the callback when it differs from the previous polygon's
+		if (m_callback.count() == 0 || !(m_callback.last() == callback))
+			m_callback.next() = callback;
 
 		// return and initialize the next one
 		polygon_info &polygon = m_polygon.next();
 		polygon.m_owner = this;
 		polygon.m_object = &object_data_last();
-		polygon.m_callback = callback;
+		polygon.m_callback = &m_callback.last();
+		polygon.m_deferred = NULL;
+		polygon.m_setup = NULL;
 		return polygon;
 	}
 
+	UINT32 triangle_extents(const triangle_setup &setup, INT32 scanline, int count, extent_t *extent);
+	void queue_units(UINT32 startunit);
 	static void *work_item_callback(void *param, int threadid);
 	void presave() { wait("pre-save"); }
 
@@ -259,13 +294,17 @@ private:
 	// arrays
 	polygon_array       m_polygon;                  // array of polygons
 	objectdata_array    m_object;                   // array of object data
+	callback_array      m_callback;                 // array of distinct scanline callbacks
 	unit_array          m_unit;                     // array of work units
+	setup_array *       m_setup;                    // triangle setups, only with POLYFLAG_DEFERRED_SETUP
 
 	// misc data
 	UINT8               m_flags;                    // flags
 
 	// buckets
 	UINT16              m_unit_bucket[TOTAL_BUCKETS]; // buckets for tracking unit usage
+	UINT16              m_bin_head[TOTAL_BUCKETS];  // first unit of each binned bucket chain
+	int                 m_bin_count;                // number of binned chains waiting to be queued
 
 	// statistics
 	UINT32              m_tiles;                    // number of tiles queued
@@ -275,6 +314,7 @@ private:
 #if KEEP_POLY_STATISTICS
 	UINT32              m_conflicts[WORK_MAX_THREADS]; // number of conflicts found, per thread
 	UINT32              m_resolved[WORK_MAX_THREADS];   // number of conflicts resolved, per thread
+	UINT32              m_scanlines[WORK_MAX_THREADS];  // number of scanlines rendered, per thread
 #endif
 };
 
@@ -290,15 +330,20 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(runnin
 		m_queue(NULL),
 		m_polygon(machine, *this),
 		m_object(machine, *this),
+		m_callback(machine, *this),
 		m_unit(machine, *this),
+		m_setup((flags & POLYFLAG_DEFERRED_SETUP) ? auto_alloc(machine, setup_array(machine, *this)) : NULL),
 		m_flags(flags),
+		m_bin_count(0),
 		m_triangles(0),
 		m_quads(0),
 		m_pixels(0)
 {
+	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
 #if KEEP_POLY_STATISTICS
 	memset(m_conflicts, 0, sizeof(m_conflicts));
 	memset(m_resolved, 0, sizeof(m_resolved));
+	memset(m_scanlines, 0, sizeof(m_scanlines));
 #endif
 
 	// create the work queue
@@ -317,15 +362,20 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(screen
 		m_queue(NULL),
 		m_polygon(screen.machine(), *this),
 		m_object(screen.machine(), *this),
+		m_callback(screen.machine(), *this),
 		m_unit(screen.machine(), *this),
+		m_setup((flags & POLYFLAG_DEFERRED_SETUP) ? auto_alloc(screen.machine(), setup_array(screen.machine(), *this)) : NULL),
 		m_flags(flags),
+		m_bin_count(0),
 		m_triangles(0),
 		m_quads(0),
 		m_pixels(0)
 {
+	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
 #if KEEP_POLY_STATISTICS
 	memset(m_conflicts, 0, sizeof(m_conflicts));
 	memset(m_resolved, 0, sizeof(m_resolved));
+	memset(m_scanlines, 0, sizeof(m_scanlines));
 #endif
 
 	// create the work queue
@@ -363,15 +413,25 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::~poly_manager()
 		printf("Total pixels   = %d\n", (UINT32)m_pixels);
 
 	printf("Conflicts:   %d resolved, %d total\n", resolved, conflicts);
+	for (int i = 0; i < ARRAY_LENGTH(m_scanlines); i++)
+		if (m_scanlines[i] != 0)
+			printf("Thread %2d:   %d scanlines, %d conflicts\n", i, m_scanlines[i], m_conflicts[i]);
 	printf("Units:       %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_unit.max(), m_unit.allocated(), m_unit.waits(), m_unit.itemsize(), m_unit.allocated() * m_unit.itemsize());
 	printf("Polygons:    %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_polygon.max(), m_polygon.allocated(), m_polygon.waits(), m_polygon.itemsize(), m_polygon.allocated() * m_polygon.itemsize());
+	printf("Callbacks:   %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_callback.max(), m_callback.allocated(), m_callback.waits(), m_callback.itemsize(), m_callback.allocated() * m_callback.itemsize());
 	printf("Object data: %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_object.max(), m_object.allocated(), m_object.waits(), m_object.itemsize(), m_object.allocated() * m_object.itemsize());
+	if (m_setup != NULL)
+		printf("Setups:      %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_setup->max(), m_setup->allocated(), m_setup->waits(), m_setup->itemsize(), m_setup->allocated() * m_setup->itemsize());
 }
 #endif
 
 	// free the work queue
 	if (m_queue != NULL)
 		osd_work_queue_free(m_queue);
+
+	// free the deferred triangle setups
+	if (m_setup != NULL)
+		auto_free(m_machine, m_setup);
 }
 
 
@@ -417,9 +477,16 @@ void *poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::work_item_cal
 			}
 		}
 
+		// compute deferred triangle extents for our scanlines
+		if (polygon.m_deferred != NULL)
+			(polygon.m_owner->*polygon.m_deferred)(*polygon.m_setup, unit.scanline, count, unit.extent);
+
 		// iterate over extents
 		for (int curscan = 0; curscan < count; curscan++)
-			polygon.m_callback(unit.scanline + curscan, unit.extent[curscan], *polygon.m_object, threadid);
+			(*polygon.m_callback)(unit.scanline + curscan, unit.extent[curscan], *polygon.m_object, threadid);
+#if KEEP_POLY_STATISTICS
+		polygon.m_owner->m_scanlines[threadid] += count;
+#endif
 
 		// set our count to 0 and re-fetch the original count value
 		do
@@ -450,6 +517,11 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 	if (LOG_WAITS)
 		time = get_profile_ticks();
 
+	// queue the binned chains, one work item per bucket
+	for (int binnum = 0; binnum < m_bin_count; binnum++)
+		osd_work_item_queue(m_queue, work_item_callback, &m_unit[m_bin_head[binnum]], WORK_ITEM_FLAG_AUTO_RELEASE);
+	m_bin_count = 0;
+
 	// wait for all pending work items to complete
 	if (m_queue != NULL)
 		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
@@ -470,6 +542,9 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 	// reset the state
 	m_polygon.reset();
 	m_unit.reset();
+	m_callback.reset();
+	if (m_setup != NULL)
+		m_setup->reset();
 	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
 
 	// we need to preserve the last object data that was supplied
@@ -502,7 +577,7 @@ _ObjectData &poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::object
 //-------------------------------------------------
 
 template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
-UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tile(const rectangle &cliprect, render_delegate callback, int paramcount, const vertex_t &_v1, const vertex_t &_v2)
+UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tile(const rectangle &cliprect, const render_delegate &callback, int paramcount, const vertex_t &_v1, const vertex_t &_v2)
 {
 	const vertex_t *v1 = &_v1;
 	const vertex_t *v2 = &_v2;
@@ -618,8 +693,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tile(
 	}
 
 	// enqueue the work items
-	if (m_queue != NULL)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit);
 
 	// return the total number of pixels in the triangle
 	m_tiles++;
@@ -634,7 +708,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tile(
 //-------------------------------------------------
 
 template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
-UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_triangle(const rectangle &cliprect, render_delegate callback, int paramcount, const vertex_t &_v1, const vertex_t &_v2, const vertex_t &_v3)
+UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_triangle(const rectangle &cliprect, const render_delegate &callback, int paramcount, const vertex_t &_v1, const vertex_t &_v2, const vertex_t &_v3)
 {
 	const vertex_t *v1 = &_v1;
 	const vertex_t *v2 = &_v2;
@@ -684,14 +758,24 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 	polygon_info &polygon = polygon_alloc(round_coordinate(minx), round_coordinate(maxx), v1yclip, v3yclip, callback);
 
 	// compute the slopes for each portion of the triangle
-	_BaseType dxdy_v1v2 = (v2->y == v1->y) ? _BaseType(0.0) : (v2->x - v1->x) / (v2->y - v1->y);
-	_BaseType dxdy_v1v3 = (v3->y == v1->y) ? _BaseType(0.0) : (v3->x - v1->x) / (v3->y - v1->y);
-	_BaseType dxdy_v2v3 = (v3->y == v2->y) ? _BaseType(0.0) : (v3->x - v2->x) / (v3->y - v2->y);
+	// deferred triangles keep their setup for the workers; otherwise it is only needed here
+	triangle_setup localsetup;
+	triangle_setup &setup = (m_setup != NULL) ? m_setup->next() : localsetup;
+	setup.v1x = v1->x;
+	setup.v1y = v1->y;
+	setup.v2x = v2->x;
+	setup.v2y = v2->y;
+	setup.dxdy_v1v2 = (v2->y == v1->y) ? _BaseType(0.0) : (v2->x - v1->x) / (v2->y - v1->y);
+	setup.dxdy_v1v3 = (v3->y == v1->y) ? _BaseType(0.0) : (v3->x - v1->x) / (v3->y - v1->y);
+	setup.dxdy_v2v3 = (v3->y == v2->y) ? _BaseType(0.0) : (v3->x - v2->x) / (v3->y - v2->y);
+	setup.clipminx = cliprect.min_x;
+	setup.clipmaxx = cliprect.max_x;
+	setup.paramcount = paramcount;
 
 	// compute parameter starting points and deltas
-	_BaseType param_start[_MaxParams];
-	_BaseType param_dpdx[_MaxParams];
-	_BaseType param_dpdy[_MaxParams];
+	_BaseType *param_start = setup.param_start;
+	_BaseType *param_dpdx = setup.param_dpdx;
+	_BaseType *param_dpdy = setup.param_dpdy;
 	if (paramcount > 0)
 	{
 		_BaseType a00 = v2->y - v3->y;
@@ -732,7 +816,14 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 		param_dpdy[0] = _BaseType(0.0);
 	}
 
-	// compute the X extents for each scanline
+	// with deferred setup the workers compute the extents from the setup above
+	if (m_flags & POLYFLAG_DEFERRED_SETUP)
+	{
+		polygon.m_setup = &setup;
+		polygon.m_deferred = &poly_manager::triangle_extents;
+	}
+
+	// split the triangle into work units, computing the X extents for each scanline now if not deferred
 	INT32 pixels = 0;
 	UINT32 startunit = m_unit.count();
 	INT32 scaninc = 1;
@@ -746,73 +837,118 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
 
 		// fill in the work unit basics
+		int count = MIN(v3yclip - curscan, scaninc);
 		unit.polygon = &polygon;
-		unit.count_next = MIN(v3yclip - curscan, scaninc);
+		unit.count_next = count;
 		unit.scanline = curscan;
 		unit.previtem = m_unit_bucket[bucketnum];
 		m_unit_bucket[bucketnum] = unit_index;
 
-		// iterate over extents
-		for (int extnum = 0; extnum < unit.count_next; extnum++)
-		{
-			// compute the ending X based on which part of the triangle we're in
-			_BaseType fully = _BaseType(curscan + extnum) + _BaseType(0.5);
-			_BaseType startx = v1->x + (fully - v1->y) * dxdy_v1v3;
-			_BaseType stopx;
-			if (fully < v2->y)
-				stopx = v1->x + (fully - v1->y) * dxdy_v1v2;
-			else
-				stopx = v2->x + (fully - v2->y) * dxdy_v2v3;
+		if (polygon.m_deferred == NULL)
+			pixels += triangle_extents(setup, curscan, count, unit.extent);
+	}
 
-			// clamp to full pixels
-			INT32 istartx = round_coordinate(startx);
-			INT32 istopx = round_coordinate(stopx);
+	// enqueue the work items
+	queue_units(startunit);
 
-			// force start < stop
-			if (istartx > istopx)
-			{
-				INT32 temp = istartx;
-				istartx = istopx;
-				istopx = temp;
-			}
+	// return the total number of pixels in the triangle (0 if deferred, as it isn't known yet)
+	m_triangles++;
+	m_pixels += pixels;
+	return pixels;
+}
 
-			// include the right edge if requested
-			if (m_flags & POLYFLAG_INCLUDE_RIGHT_EDGE)
-				istopx++;
 
-			// apply left/right clipping
-			if (istartx < cliprect.min_x)
-				istartx = cliprect.min_x;
-			if (istopx > cliprect.max_x)
-				istopx = cliprect.max_x + 1;
+//-------------------------------------------------
+//  triangle_extents - compute the extents of
+//  count scanlines of a set-up triangle
+//-------------------------------------------------
 
-			// set the extent and update the total pixel count
-			if (istartx >= istopx)
-				istartx = istopx = 0;
-			extent_t &extent = unit.extent[extnum];
-			extent.startx = istartx;
-			extent.stopx = istopx;
-			extent.userdata = NULL;
-			pixels += istopx - istartx;
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::triangle_extents(const triangle_setup &setup, INT32 scanline, int count, extent_t *extent)
+{
+	UINT32 pixels = 0;
+	for (int extnum = 0; extnum < count; extnum++, extent++)
+	{
+		// compute the ending X based on which part of the triangle we're in
+		_BaseType fully = _BaseType(scanline + extnum) + _BaseType(0.5);
+		_BaseType startx = setup.v1x + (fully - setup.v1y) * setup.dxdy_v1v3;
+		_BaseType stopx;
+		if (fully < setup.v2y)
+			stopx = setup.v1x + (fully - setup.v1y) * setup.dxdy_v1v2;
+		else
+			stopx = setup.v2x + (fully - setup.v2y) * setup.dxdy_v2v3;
 
-			// fill in the parameters for the extent
-			_BaseType fullstartx = _BaseType(istartx) + _BaseType(0.5);
-			for (int paramnum = 0; paramnum < paramcount; paramnum++)
-			{
-				extent.param[paramnum].start = param_start[paramnum] + fullstartx * param_dpdx[paramnum] + fully * param_dpdy[paramnum];
-				extent.param[paramnum].dpdx = param_dpdx[paramnum];
-			}
+		// clamp to full pixels
+		INT32 istartx = round_coordinate(startx);
+		INT32 istopx = round_coordinate(stopx);
+
+		// force start < stop
+		if (istartx > istopx)
+		{
+			INT32 temp = istartx;
+			istartx = istopx;
+			istopx = temp;
+		}
+
+		// include the right edge if requested
+		if (m_flags & POLYFLAG_INCLUDE_RIGHT_EDGE)
+			istopx++;
+
+		// apply left/right clipping
+		if (istartx < setup.clipminx)
+			istartx = setup.clipminx;
+		if (istopx > setup.clipmaxx)
+			istopx = setup.clipmaxx + 1;
+
+		// set the extent and update the total pixel count
+		if (istartx >= istopx)
+			istartx = istopx = 0;
+		extent->startx = istartx;
+		extent->stopx = istopx;
+		extent->userdata = NULL;
+		pixels += istopx - istartx;
+
+		// fill in the parameters for the extent
+		_BaseType fullstartx = _BaseType(istartx) + _BaseType(0.5);
+		for (int paramnum = 0; paramnum < setup.paramcount; paramnum++)
+		{
+			extent->param[paramnum].start = setup.param_start[paramnum] + fullstartx * setup.param_dpdx[paramnum] + fully * setup.param_dpdy[paramnum];
+			extent->param[paramnum].dpdx = setup.param_dpdx[paramnum];
 		}
 	}
+	return pixels;
+}
 
-	// enqueue the work items
-	if (m_queue != NULL)
+
+//-------------------------------------------------
+//  queue_units - hand the units from startunit
+//  on to the work queue, or bin them per bucket
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::queue_units(UINT32 startunit)
+{
+	if (m_queue == NULL)
+		return;
+
+	// without binning, queue each unit now and let the workers chain conflicting ones
+	if (!(m_flags & POLYFLAG_TILE_BINNING))
+	{
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+		return;
+	}
 
-	// return the total number of pixels in the triangle
-	m_triangles++;
-	m_pixels += pixels;
-	return pixels;
+	// with binning, link each unit behind the previous one in its bucket; wait() queues
+	// one item per chain, so a single worker owns each band and never hits a conflict
+	for (UINT32 unitnum = startunit; unitnum < m_unit.count(); unitnum++)
+	{
+		work_unit &unit = m_unit[unitnum];
+		if (unit.previtem == 0xffff)
+			m_bin_head[m_bin_count++] = unitnum;
+		else
+			m_unit[unit.previtem].count_next |= unitnum << 16;
+		unit.previtem = 0xffff;
+	}
 }
 
 
@@ -822,7 +958,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 //-------------------------------------------------
 
 template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
-UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_triangle_fan(const rectangle &cliprect, render_delegate callback, int paramcount, int numverts, const vertex_t *v)
+UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_triangle_fan(const rectangle &cliprect, const render_delegate &callback, int paramcount, int numverts, const vertex_t *v)
 {
 	// iterate over vertices
 	UINT32 pixels = 0;
@@ -838,7 +974,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 //-------------------------------------------------
 
 template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
-UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_triangle_strip(const rectangle &cliprect, render_delegate callback, int paramcount, int numverts, const vertex_t *v)
+UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_triangle_strip(const rectangle &cliprect, const render_delegate &callback, int paramcount, int numverts, const vertex_t *v)
 {
 	// iterate over vertices
 	UINT32 pixels = 0;
@@ -848,13 +984,34 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 }
 
 
+//-------------------------------------------------
+//  render_triangle_batch - render a list of
+//  independent, already transformed triangles,
+//  optionally with one object data per triangle
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_triangle_batch(const rectangle &cliprect, const render_delegate &callback, int paramcount, int numtris, const vertex_t *v, const _ObjectData *objects)
+{
+	// iterate over triangles; the callback is only stored once for the run
+	UINT32 pixels = 0;
+	for (int trinum = 0; trinum < numtris; trinum++, v += 3)
+	{
+		if (objects != NULL)
+			object_data_alloc() = objects[trinum];
+		pixels += render_triangle(cliprect, callback, paramcount, v[0], v[1], v[2]);
+	}
+	return pixels;
+}
+
+
 //-------------------------------------------------
 //  render_triangle_custom - perform a custom
 //  render of an object, given specific extents
 //-------------------------------------------------
 
 template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
-UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_triangle_custom(const rectangle &cliprect, render_delegate callback, int startscanline, int numscanlines, const extent_t *extents)
+UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_triangle_custom(const rectangle &cliprect, const render_delegate &callback, int startscanline, int numscanlines, const extent_t *extents)
 {
 	// clip coordinates
 	INT32 v1yclip = MAX(startscanline, cliprect.min_y);
@@ -922,8 +1079,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 	}
 
 	// enqueue the work items
-	if (m_queue != NULL)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit);
 
 	// return the total number of pixels in the object
 	m_triangles++;
@@ -939,7 +1095,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 
 template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
 template<int _NumVerts>
-UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_polygon(const rectangle &cliprect, render_delegate callback, int paramcount, const vertex_t *v)
+UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_polygon(const rectangle &cliprect, const render_delegate &callback, int paramcount, const vertex_t *v)
 {
 	// determine min/max Y vertices
 	_BaseType minx = v[0].x;
@@ -1121,8 +1277,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_polyg
 	}
 
 	// enqueue the work items
-	if (m_queue != NULL)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit);
 
 	// return the total number of pixels in the triangle
 	m_quads++;
@@ -1131,6 +1286,30 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_polyg
 }
 
 
+//-------------------------------------------------
+//  render_quad_fan - render a set of quads in a
+//  fan, repeating the last vertex to close an
+//  odd one
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_quad_fan(const rectangle &cliprect, const render_delegate &callback, int paramcount, int numverts, const vertex_t *v)
+{
+	// iterate over vertices
+	UINT32 pixels = 0;
+	vertex_t quad[4];
+	for (int vertnum = 2; vertnum < numverts; vertnum += 2)
+	{
+		quad[0] = v[0];
+		quad[1] = v[vertnum - 1];
+		quad[2] = v[vertnum];
+		quad[3] = v[MIN(vertnum + 1, numverts - 1)];
+		pixels += render_polygon<4>(cliprect, callback, paramcount, quad);
+	}
+	return pixels;
+}
+
+
 //-------------------------------------------------
 //  zclip_if_less - clip a polygon using p[0] as
 //  a z coordinate
@@ -44,6 +44,35 @@ void psxgpu_device::device_start( void )
 	{
 		psx_gpu_init( 2 );
 	}
+
+	m_render_queue = NULL;
+	m_render_batchnum = 0;
+	for( int n_batch = 0; n_batch < RENDER_BATCHES; n_batch++ )
+	{
+		m_render_batch[ n_batch ].gpu = this;
+		m_render_batch[ n_batch ].item = NULL;
+		m_render_batch[ n_batch ].n_count = 0;
+	}
+
+#if !DEBUG_VIEWER
+	if( machine().options().gpu_async() )
+	{
+		m_render_queue = osd_work_queue_alloc( WORK_QUEUE_FLAG_HIGH_FREQ );
+	}
+#endif
+	machine().save().register_presave( save_prepost_delegate( FUNC( psxgpu_device::render_sync ), this ) );
+	machine().save().register_preload( save_prepost_delegate( FUNC( psxgpu_device::render_discard ), this ) );
+	machine().save().register_postload( save_prepost_delegate( FUNC( psxgpu_device::render_reset ), this ) );
+}
+
+void psxgpu_device::device_stop( void )
+{
+	if( m_render_queue != NULL )
+	{
+		render_sync();
+		osd_work_queue_free( m_render_queue );
+		m_render_queue = NULL;
+	}
 }
 
 void psxgpu_device::device_reset( void )
@@ -568,7 +597,7 @@ void psxgpu_device::psx_gpu_init( int n_gputype )
 	}
 
 	// icky!!!
-	machine().save().save_memory( this, "globals", NULL, 0, "m_packet", (UINT8 *)&m_packet, 1, sizeof( m_packet ) );
+	machine().save().save_memory( this, "globals", NULL, 0, "m_packet", (UINT8 *)&m_gpu_buffer, 1, sizeof( m_gpu_buffer ) );
 
 	save_pointer(NAME(p_vram), width * height );
 	save_item(NAME(n_gpu_buffer_offset));
@@ -630,6 +659,8 @@ UINT32 psxgpu_device::update_screen(screen_device &screen, bitmap_ind16 &bitmap,
 	}
 #endif
 
+	render_sync();
+
 	if( ( n_gpustatus & ( 1 << 0x17 ) ) != 0 )
 	{
 		/* todo: only draw to necessary area */
@@ -775,12 +806,22 @@ f  e| d  c| b| a  9| 8  7| 6  5| 4| 3  2  1  0
     |iy|ix|ty|     |   tp|  abr|ty|         tx
 */
 
-void psxgpu_device::decode_tpage( UINT32 tpage )
+void psxgpu_device::update_tpage_status( UINT32 tpage )
 {
 	if( m_n_gputype == 2 )
 	{
 		n_gpustatus = ( n_gpustatus & 0xfffff800 ) | ( tpage & 0x7ff );
+	}
+	else
+	{
+		n_gpustatus = ( n_gpustatus & 0xffffe000 ) | ( tpage & 0x1fff );
+	}
+}
 
+void psxgpu_device::decode_tpage( UINT32 tpage )
+{
+	if( m_n_gputype == 2 )
+	{
 		m_n_tx = ( tpage & 0x0f ) << 6;
 		m_n_ty = ( ( tpage & 0x10 ) << 4 ) | ( ( tpage & 0x800 ) >> 2 );
 		n_abr = ( tpage & 0x60 ) >> 5;
@@ -799,8 +840,6 @@ void psxgpu_device::decode_tpage( UINT32 tpage )
 	}
 	else
 	{
-		n_gpustatus = ( n_gpustatus & 0xffffe000 ) | ( tpage & 0x1fff );
-
 		m_n_tx = ( tpage & 0x0f ) << 6;
 		m_n_ty = ( ( tpage & 0x60 ) << 3 );
 		n_abr = ( tpage & 0x180 ) >> 7;
@@ -3035,6 +3074,284 @@ void psxgpu_device::MoveImage( void )
 	}
 }
 
+void psxgpu_device::render_packet( void )
+{
+	switch( m_packet.n_entry[ 0 ] >> 24 )
+	{
+	case 0x02:
+		FrameBufferRectangleDraw();
+		break;
+	case 0x20:
+	case 0x21:
+	case 0x22:
+	case 0x23:
+		FlatPolygon( 3 );
+		break;
+	case 0x24:
+	case 0x25:
+	case 0x26:
+	case 0x27:
+		FlatTexturedPolygon( 3 );
+		break;
+	case 0x28:
+	case 0x29:
+	case 0x2a:
+	case 0x2b:
+		FlatPolygon( 4 );
+		break;
+	case 0x2c:
+	case 0x2d:
+	case 0x2e:
+	case 0x2f:
+		FlatTexturedPolygon( 4 );
+		break;
+	case 0x30:
+	case 0x31:
+	case 0x32:
+	case 0x33:
+		GouraudPolygon( 3 );
+		break;
+	case 0x34:
+	case 0x35:
+	case 0x36:
+	case 0x37:
+		GouraudTexturedPolygon( 3 );
+		break;
+	case 0x38:
+	case 0x39:
+	case 0x3a:
+	case 0x3b:
+		GouraudPolygon( 4 );
+		break;
+	case 0x3c:
+	case 0x3d:
+	case 0x3e:
+	case 0x3f:
+		GouraudTexturedPolygon( 4 );
+		break;
+	case 0x40:
+	case 0x41:
+	case 0x42:
+	case 0x48:
+	case 0x4a:
+	case 0x4c:
+	case 0x4e:
+		MonochromeLine();
+		break;
+	case 0x50:
+	case 0x51:
+	case 0x52:
+	case 0x53:
+	case 0x58:
+	case 0x5a:
+	case 0x5c:
+	case 0x5e:
+		GouraudLine();
+		break;
+	case 0x60:
+	case 0x61:
+	case 0x62:
+	case 0x63:
+		FlatRectangle();
+		break;
+	case 0x64:
+	case 0x65:
+	case 0x66:
+	case 0x67:
+		FlatTexturedRectangle();
+		break;
+	case 0x68:
+	case 0x6a:
+		Dot();
+		break;
+	case 0x70:
+	case 0x71:
+		FlatRectangle8x8();
+		break;
+	case 0x74:
+	case 0x75:
+	case 0x76:
+	case 0x77:
+		Sprite8x8();
+		break;
+	case 0x78:
+	case 0x79:
+		FlatRectangle16x16();
+		break;
+	case 0x7c:
+	case 0x7d:
+	case 0x7e:
+	case 0x7f:
+		Sprite16x16();
+		break;
+	case 0x80:
+		MoveImage();
+		break;
+	case 0xe1:
+		decode_tpage( m_packet.n_entry[ 0 ] & 0xffffff );
+		break;
+	case 0xe2:
+		n_twy = ( ( ( m_packet.n_entry[ 0 ] >> 15 ) & 0x1f ) << 3 );
+		n_twx = ( ( ( m_packet.n_entry[ 0 ] >> 10 ) & 0x1f ) << 3 );
+		n_twh = 255 - ( ( ( m_packet.n_entry[ 0 ] >> 5 ) & 0x1f ) << 3 );
+		n_tww = 255 - ( ( m_packet.n_entry[ 0 ] & 0x1f ) << 3 );
+		verboselog( machine(), 1, "%02x: texture window %u,%u %u,%u\n", m_packet.n_entry[ 0 ] >> 24,
+			n_twx, n_twy, n_tww, n_twh );
+		break;
+	case 0xe3:
+		n_drawarea_x1 = m_packet.n_entry[ 0 ] & 1023;
+		if( m_n_gputype == 2 )
+		{
+			n_drawarea_y1 = ( m_packet.n_entry[ 0 ] >> 10 ) & 1023;
+		}
+		else
+		{
+			n_drawarea_y1 = ( m_packet.n_entry[ 0 ] >> 12 ) & 1023;
+		}
+		verboselog( machine(), 1, "%02x: drawing area top left %d,%d\n", m_packet.n_entry[ 0 ] >> 24,
+			n_drawarea_x1, n_drawarea_y1 );
+		break;
+	case 0xe4:
+		n_drawarea_x2 = m_packet.n_entry[ 0 ] & 1023;
+		if( m_n_gputype == 2 )
+		{
+			n_drawarea_y2 = ( m_packet.n_entry[ 0 ] >> 10 ) & 1023;
+		}
+		else
+		{
+			n_drawarea_y2 = ( m_packet.n_entry[ 0 ] >> 12 ) & 1023;
+		}
+		verboselog( machine(), 1, "%02x: drawing area bottom right %d,%d\n", m_packet.n_entry[ 0 ] >> 24,
+			n_drawarea_x2, n_drawarea_y2 );
+		break;
+	case 0xe5:
+		n_drawoffset_x = SINT11( m_packet.n_entry[ 0 ] & 2047 );
+		if( m_n_gputype == 2 )
+		{
+			n_drawoffset_y = SINT11( ( m_packet.n_entry[ 0 ] >> 11 ) & 2047 );
+		}
+		else
+		{
+			n_drawoffset_y = SINT11( ( m_packet.n_entry[ 0 ] >> 12 ) & 2047 );
+		}
+		verboselog( machine(), 1, "%02x: drawing offset %d,%d\n", m_packet.n_entry[ 0 ] >> 24,
+			n_drawoffset_x, n_drawoffset_y );
+		break;
+	}
+}
+
+/*
+In asynchronous mode complete packets are copied into batches, and each
+full batch is handed to a single worker thread which runs them in order.
+Everything that can observe VRAM or the drawing state from outside (VRAM
+transfers, GPU info requests, reset, screen updates and save states) waits
+for the worker first, so the result is the same as drawing immediately.
+*/
+
+void psxgpu_device::draw_packet( void )
+{
+	if( m_render_queue == NULL )
+	{
+		m_packet = m_gpu_buffer;
+		render_packet();
+		return;
+	}
+
+	render_batch &batch = m_render_batch[ m_render_batchnum ];
+	batch.packet[ batch.n_count++ ] = m_gpu_buffer;
+	if( batch.n_count == RENDER_BATCH_PACKETS )
+	{
+		render_submit();
+	}
+}
+
+void psxgpu_device::render_submit( void )
+{
+	render_batch &batch = m_render_batch[ m_render_batchnum ];
+	if( batch.n_count == 0 )
+	{
+		return;
+	}
+
+	batch.item = osd_work_item_queue( m_render_queue, render_batch_callback, &batch, 0 );
+	if( batch.item == NULL )
+	{
+		// the queue is unavailable, so draw the batch here
+		render_batch_callback( &batch, 0 );
+	}
+
+	// reuse the oldest batch once the worker has finished with it
+	m_render_batchnum = ( m_render_batchnum + 1 ) % RENDER_BATCHES;
+	render_wait( m_render_batch[ m_render_batchnum ] );
+}
+
+void psxgpu_device::render_wait( render_batch &batch )
+{
+	if( batch.item != NULL )
+	{
+		osd_work_item_wait( batch.item, 100 * osd_ticks_per_second() );
+		osd_work_item_release( batch.item );
+		batch.item = NULL;
+	}
+	batch.n_count = 0;
+}
+
+void psxgpu_device::render_sync( void )
+{
+	if( m_render_queue == NULL )
+	{
+		return;
+	}
+
+	render_submit();
+	for( int n_batch = 0; n_batch < RENDER_BATCHES; n_batch++ )
+	{
+		render_wait( m_render_batch[ n_batch ] );
+	}
+}
+
+/*
+Loading a state replaces VRAM and the drawing state, so packets from before
+the load must not be drawn afterwards. Batches already on the worker can't be
+recalled and are waited for; packets still being collected are dropped.
+*/
+
+void psxgpu_device::render_discard( void )
+{
+	if( m_render_queue == NULL )
+	{
+		return;
+	}
+
+	for( int n_batch = 0; n_batch < RENDER_BATCHES; n_batch++ )
+	{
+		render_wait( m_render_batch[ n_batch ] );
+	}
+}
+
+void psxgpu_device::render_reset( void )
+{
+	for( int n_batch = 0; n_batch < RENDER_BATCHES; n_batch++ )
+	{
+		assert( m_render_batch[ n_batch ].item == NULL );
+		m_render_batch[ n_batch ].n_count = 0;
+	}
+	m_render_batchnum = 0;
+}
+
+void *psxgpu_device::render_batch_callback( void *param, int threadid )
+{
+	render_batch *batch = (render_batch *)param;
+	psxgpu_device *gpu = batch->gpu;
+
+	for( int n_packet = 0; n_packet < batch->n_count; n_packet++ )
+	{
+		gpu->m_packet = batch->packet[ n_packet ];
+		gpu->render_packet();
+	}
+	return NULL;
+}
+
 void psxgpu_device::dma_write( UINT32 *p_n_psxram, UINT32 n_address, INT32 n_size )
 {
 	gpu_write( &p_n_psxram[ n_address / 4 ], n_size );
@@ -3047,8 +3364,8 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		UINT32 data = *( p_ram );
 
 		verboselog( machine(), 2, "PSX Packet #%u %08x\n", n_gpu_buffer_offset, data );
-		m_packet.n_entry[ n_gpu_buffer_offset ] = data;
-		switch( m_packet.n_entry[ 0 ] >> 24 )
+		m_gpu_buffer.n_entry[ n_gpu_buffer_offset ] = data;
+		switch( m_gpu_buffer.n_entry[ 0 ] >> 24 )
 		{
 		case 0x00:
 			verboselog( machine(), 1, "not handled: GPU Command 0x00: (%08x)\n", data );
@@ -3063,9 +3380,9 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: frame buffer rectangle %u,%u %u,%u\n", m_packet.n_entry[ 0 ] >> 24,
-					m_packet.n_entry[ 1 ] & 0xffff, m_packet.n_entry[ 1 ] >> 16, m_packet.n_entry[ 2 ] & 0xffff, m_packet.n_entry[ 2 ] >> 16 );
-				FrameBufferRectangleDraw();
+				verboselog( machine(), 1, "%02x: frame buffer rectangle %u,%u %u,%u\n", m_gpu_buffer.n_entry[ 0 ] >> 24,
+					m_gpu_buffer.n_entry[ 1 ] & 0xffff, m_gpu_buffer.n_entry[ 1 ] >> 16, m_gpu_buffer.n_entry[ 2 ] & 0xffff, m_gpu_buffer.n_entry[ 2 ] >> 16 );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3079,8 +3396,8 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: monochrome 3 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				FlatPolygon( 3 );
+				verboselog( machine(), 1, "%02x: monochrome 3 point polygon\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3094,8 +3411,9 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: textured 3 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				FlatTexturedPolygon( 3 );
+				verboselog( machine(), 1, "%02x: textured 3 point polygon\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
+				update_tpage_status( m_gpu_buffer.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3109,8 +3427,8 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: monochrome 4 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				FlatPolygon( 4 );
+				verboselog( machine(), 1, "%02x: monochrome 4 point polygon\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3124,8 +3442,9 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: textured 4 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				FlatTexturedPolygon( 4 );
+				verboselog( machine(), 1, "%02x: textured 4 point polygon\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
+				update_tpage_status( m_gpu_buffer.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3139,8 +3458,8 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: gouraud 3 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				GouraudPolygon( 3 );
+				verboselog( machine(), 1, "%02x: gouraud 3 point polygon\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3154,8 +3473,9 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: gouraud textured 3 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				GouraudTexturedPolygon( 3 );
+				verboselog( machine(), 1, "%02x: gouraud textured 3 point polygon\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
+				update_tpage_status( m_gpu_buffer.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3169,8 +3489,8 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: gouraud 4 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				GouraudPolygon( 4 );
+				verboselog( machine(), 1, "%02x: gouraud 4 point polygon\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3184,8 +3504,9 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: gouraud textured 4 point polygon\n", m_packet.n_entry[ 0 ] >> 24 );
-				GouraudTexturedPolygon( 4 );
+				verboselog( machine(), 1, "%02x: gouraud textured 4 point polygon\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
+				update_tpage_status( m_gpu_buffer.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3198,8 +3519,8 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: monochrome line\n", m_packet.n_entry[ 0 ] >> 24 );
-				MonochromeLine();
+				verboselog( machine(), 1, "%02x: monochrome line\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3213,12 +3534,12 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: monochrome polyline\n", m_packet.n_entry[ 0 ] >> 24 );
-				MonochromeLine();
-				if( ( m_packet.n_entry[ 3 ] & 0xf000f000 ) != 0x50005000 )
+				verboselog( machine(), 1, "%02x: monochrome polyline\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
+				draw_packet();
+				if( ( m_gpu_buffer.n_entry[ 3 ] & 0xf000f000 ) != 0x50005000 )
 				{
-					m_packet.n_entry[ 1 ] = m_packet.n_entry[ 2 ];
-					m_packet.n_entry[ 2 ] = m_packet.n_entry[ 3 ];
+					m_gpu_buffer.n_entry[ 1 ] = m_gpu_buffer.n_entry[ 2 ];
+					m_gpu_buffer.n_entry[ 2 ] = m_gpu_buffer.n_entry[ 3 ];
 					n_gpu_buffer_offset = 3;
 				}
 				else
@@ -3237,8 +3558,8 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: gouraud line\n", m_packet.n_entry[ 0 ] >> 24 );
-				GouraudLine();
+				verboselog( machine(), 1, "%02x: gouraud line\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3247,20 +3568,20 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x5c:
 		case 0x5e:
 			if( n_gpu_buffer_offset < 5 &&
-				( n_gpu_buffer_offset != 4 || ( m_packet.n_entry[ 4 ] & 0xf000f000 ) != 0x50005000 ) )
+				( n_gpu_buffer_offset != 4 || ( m_gpu_buffer.n_entry[ 4 ] & 0xf000f000 ) != 0x50005000 ) )
 			{
 				n_gpu_buffer_offset++;
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: gouraud polyline\n", m_packet.n_entry[ 0 ] >> 24 );
-				GouraudLine();
-				if( ( m_packet.n_entry[ 4 ] & 0xf000f000 ) != 0x50005000 )
+				verboselog( machine(), 1, "%02x: gouraud polyline\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
+				draw_packet();
+				if( ( m_gpu_buffer.n_entry[ 4 ] & 0xf000f000 ) != 0x50005000 )
 				{
-					m_packet.n_entry[ 0 ] = ( m_packet.n_entry[ 0 ] & 0xff000000 ) | ( m_packet.n_entry[ 2 ] & 0x00ffffff );
-					m_packet.n_entry[ 1 ] = m_packet.n_entry[ 3 ];
-					m_packet.n_entry[ 2 ] = m_packet.n_entry[ 4 ];
-					m_packet.n_entry[ 3 ] = m_packet.n_entry[ 5 ];
+					m_gpu_buffer.n_entry[ 0 ] = ( m_gpu_buffer.n_entry[ 0 ] & 0xff000000 ) | ( m_gpu_buffer.n_entry[ 2 ] & 0x00ffffff );
+					m_gpu_buffer.n_entry[ 1 ] = m_gpu_buffer.n_entry[ 3 ];
+					m_gpu_buffer.n_entry[ 2 ] = m_gpu_buffer.n_entry[ 4 ];
+					m_gpu_buffer.n_entry[ 3 ] = m_gpu_buffer.n_entry[ 5 ];
 					n_gpu_buffer_offset = 4;
 				}
 				else
@@ -3280,10 +3601,10 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			else
 			{
 				verboselog( machine(), 1, "%02x: rectangle %d,%d %d,%d\n",
-					m_packet.n_entry[ 0 ] >> 24,
-					(INT16)( m_packet.n_entry[ 1 ] & 0xffff ), (INT16)( m_packet.n_entry[ 1 ] >> 16 ),
-					(INT16)( m_packet.n_entry[ 2 ] & 0xffff ), (INT16)( m_packet.n_entry[ 2 ] >> 16 ) );
-				FlatRectangle();
+					m_gpu_buffer.n_entry[ 0 ] >> 24,
+					(INT16)( m_gpu_buffer.n_entry[ 1 ] & 0xffff ), (INT16)( m_gpu_buffer.n_entry[ 1 ] >> 16 ),
+					(INT16)( m_gpu_buffer.n_entry[ 2 ] & 0xffff ), (INT16)( m_gpu_buffer.n_entry[ 2 ] >> 16 ) );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3298,11 +3619,11 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			else
 			{
 				verboselog( machine(), 1, "%02x: sprite %d,%d %u,%u %08x, %08x\n",
-					m_packet.n_entry[ 0 ] >> 24,
-					(INT16)( m_packet.n_entry[ 1 ] & 0xffff ), (INT16)( m_packet.n_entry[ 1 ] >> 16 ),
-					m_packet.n_entry[ 3 ] & 0xffff, m_packet.n_entry[ 3 ] >> 16,
-					m_packet.n_entry[ 0 ], m_packet.n_entry[ 2 ] );
-				FlatTexturedRectangle();
+					m_gpu_buffer.n_entry[ 0 ] >> 24,
+					(INT16)( m_gpu_buffer.n_entry[ 1 ] & 0xffff ), (INT16)( m_gpu_buffer.n_entry[ 1 ] >> 16 ),
+					m_gpu_buffer.n_entry[ 3 ] & 0xffff, m_gpu_buffer.n_entry[ 3 ] >> 16,
+					m_gpu_buffer.n_entry[ 0 ], m_gpu_buffer.n_entry[ 2 ] );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3315,10 +3636,10 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			else
 			{
 				verboselog( machine(), 1, "%02x: dot %d,%d %08x\n",
-					m_packet.n_entry[ 0 ] >> 24,
-					(INT16)( m_packet.n_entry[ 1 ] & 0xffff ), (INT16)( m_packet.n_entry[ 1 ] >> 16 ),
-					m_packet.n_entry[ 0 ] & 0xffffff );
-				Dot();
+					m_gpu_buffer.n_entry[ 0 ] >> 24,
+					(INT16)( m_gpu_buffer.n_entry[ 1 ] & 0xffff ), (INT16)( m_gpu_buffer.n_entry[ 1 ] >> 16 ),
+					m_gpu_buffer.n_entry[ 0 ] & 0xffffff );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3331,9 +3652,9 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: 16x16 rectangle %08x %08x\n", m_packet.n_entry[ 0 ] >> 24,
-					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ] );
-				FlatRectangle8x8();
+				verboselog( machine(), 1, "%02x: 16x16 rectangle %08x %08x\n", m_gpu_buffer.n_entry[ 0 ] >> 24,
+					m_gpu_buffer.n_entry[ 0 ], m_gpu_buffer.n_entry[ 1 ] );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3347,9 +3668,9 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: 8x8 sprite %08x %08x %08x\n", m_packet.n_entry[ 0 ] >> 24,
-					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ] );
-				Sprite8x8();
+				verboselog( machine(), 1, "%02x: 8x8 sprite %08x %08x %08x\n", m_gpu_buffer.n_entry[ 0 ] >> 24,
+					m_gpu_buffer.n_entry[ 0 ], m_gpu_buffer.n_entry[ 1 ], m_gpu_buffer.n_entry[ 2 ] );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3362,9 +3683,9 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: 16x16 rectangle %08x %08x\n", m_packet.n_entry[ 0 ] >> 24,
-					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ] );
-				FlatRectangle16x16();
+				verboselog( machine(), 1, "%02x: 16x16 rectangle %08x %08x\n", m_gpu_buffer.n_entry[ 0 ] >> 24,
+					m_gpu_buffer.n_entry[ 0 ], m_gpu_buffer.n_entry[ 1 ] );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3378,9 +3699,9 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: 16x16 sprite %08x %08x %08x\n", m_packet.n_entry[ 0 ] >> 24,
-					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ] );
-				Sprite16x16();
+				verboselog( machine(), 1, "%02x: 16x16 sprite %08x %08x %08x\n", m_gpu_buffer.n_entry[ 0 ] >> 24,
+					m_gpu_buffer.n_entry[ 0 ], m_gpu_buffer.n_entry[ 1 ], m_gpu_buffer.n_entry[ 2 ] );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3391,8 +3712,8 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "move image in frame buffer %08x %08x %08x %08x\n", m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ], m_packet.n_entry[ 3 ] );
-				MoveImage();
+				verboselog( machine(), 1, "move image in frame buffer %08x %08x %08x %08x\n", m_gpu_buffer.n_entry[ 0 ], m_gpu_buffer.n_entry[ 1 ], m_gpu_buffer.n_entry[ 2 ], m_gpu_buffer.n_entry[ 3 ] );
+				draw_packet();
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3403,28 +3724,31 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
+				// queued drawing has to land before the upload overwrites it
+				render_sync();
+
 				UINT32 n_pixel;
 				for( n_pixel = 0; n_pixel < 2; n_pixel++ )
 				{
 					UINT16 *p_vram;
 
 					verboselog( machine(), 2, "send image to framebuffer ( pixel %u,%u = %u )\n",
-						( n_vramx + m_packet.n_entry[ 1 ] ) & 1023,
-						( n_vramy + ( m_packet.n_entry[ 1 ] >> 16 ) ) & 1023,
+						( n_vramx + m_gpu_buffer.n_entry[ 1 ] ) & 1023,
+						( n_vramy + ( m_gpu_buffer.n_entry[ 1 ] >> 16 ) ) & 1023,
 						data & 0xffff );
 
-					p_vram = p_p_vram[ ( n_vramy + ( m_packet.n_entry[ 1 ] >> 16 ) ) & 1023 ] + ( ( n_vramx + m_packet.n_entry[ 1 ] ) & 1023 );
+					p_vram = p_p_vram[ ( n_vramy + ( m_gpu_buffer.n_entry[ 1 ] >> 16 ) ) & 1023 ] + ( ( n_vramx + m_gpu_buffer.n_entry[ 1 ] ) & 1023 );
 					WRITE_PIXEL( data & 0xffff );
 					n_vramx++;
-					if( n_vramx >= ( m_packet.n_entry[ 2 ] & 0xffff ) )
+					if( n_vramx >= ( m_gpu_buffer.n_entry[ 2 ] & 0xffff ) )
 					{
 						n_vramx = 0;
 						n_vramy++;
-						if( n_vramy >= ( m_packet.n_entry[ 2 ] >> 16 ) )
+						if( n_vramy >= ( m_gpu_buffer.n_entry[ 2 ] >> 16 ) )
 						{
-							verboselog( machine(), 1, "%02x: send image to framebuffer %u,%u %u,%u\n", m_packet.n_entry[ 0 ] >> 24,
-								m_packet.n_entry[ 1 ] & 0xffff, ( m_packet.n_entry[ 1 ] >> 16 ),
-								m_packet.n_entry[ 2 ] & 0xffff, ( m_packet.n_entry[ 2 ] >> 16 ) );
+							verboselog( machine(), 1, "%02x: send image to framebuffer %u,%u %u,%u\n", m_gpu_buffer.n_entry[ 0 ] >> 24,
+								m_gpu_buffer.n_entry[ 1 ] & 0xffff, ( m_gpu_buffer.n_entry[ 1 ] >> 16 ),
+								m_gpu_buffer.n_entry[ 2 ] & 0xffff, ( m_gpu_buffer.n_entry[ 2 ] >> 16 ) );
 							n_gpu_buffer_offset = 0;
 							n_vramx = 0;
 							n_vramy = 0;
@@ -3442,79 +3766,39 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			else
 			{
-				verboselog( machine(), 1, "%02x: copy image from frame buffer\n", m_packet.n_entry[ 0 ] >> 24 );
+				verboselog( machine(), 1, "%02x: copy image from frame buffer\n", m_gpu_buffer.n_entry[ 0 ] >> 24 );
 				n_gpustatus |= ( 1L << 0x1b );
 			}
 			break;
 		case 0xe1:
-			verboselog( machine(), 1, "%02x: draw mode %06x\n", m_packet.n_entry[ 0 ] >> 24,
-				m_packet.n_entry[ 0 ] & 0xffffff );
-			decode_tpage( m_packet.n_entry[ 0 ] & 0xffffff );
+			verboselog( machine(), 1, "%02x: draw mode %06x\n", m_gpu_buffer.n_entry[ 0 ] >> 24,
+				m_gpu_buffer.n_entry[ 0 ] & 0xffffff );
+			update_tpage_status( m_gpu_buffer.n_entry[ 0 ] & 0xffffff );
+			draw_packet();
 			break;
 		case 0xe2:
-			n_twy = ( ( ( m_packet.n_entry[ 0 ] >> 15 ) & 0x1f ) << 3 );
-			n_twx = ( ( ( m_packet.n_entry[ 0 ] >> 10 ) & 0x1f ) << 3 );
-			n_twh = 255 - ( ( ( m_packet.n_entry[ 0 ] >> 5 ) & 0x1f ) << 3 );
-			n_tww = 255 - ( ( m_packet.n_entry[ 0 ] & 0x1f ) << 3 );
-			verboselog( machine(), 1, "%02x: texture window %u,%u %u,%u\n", m_packet.n_entry[ 0 ] >> 24,
-				n_twx, n_twy, n_tww, n_twh );
-			break;
 		case 0xe3:
-			n_drawarea_x1 = m_packet.n_entry[ 0 ] & 1023;
-			if( m_n_gputype == 2 )
-			{
-				n_drawarea_y1 = ( m_packet.n_entry[ 0 ] >> 10 ) & 1023;
-			}
-			else
-			{
-				n_drawarea_y1 = ( m_packet.n_entry[ 0 ] >> 12 ) & 1023;
-			}
-			verboselog( machine(), 1, "%02x: drawing area top left %d,%d\n", m_packet.n_entry[ 0 ] >> 24,
-				n_drawarea_x1, n_drawarea_y1 );
-			break;
 		case 0xe4:
-			n_drawarea_x2 = m_packet.n_entry[ 0 ] & 1023;
-			if( m_n_gputype == 2 )
-			{
-				n_drawarea_y2 = ( m_packet.n_entry[ 0 ] >> 10 ) & 1023;
-			}
-			else
-			{
-				n_drawarea_y2 = ( m_packet.n_entry[ 0 ] >> 12 ) & 1023;
-			}
-			verboselog( machine(), 1, "%02x: drawing area bottom right %d,%d\n", m_packet.n_entry[ 0 ] >> 24,
-				n_drawarea_x2, n_drawarea_y2 );
-			break;
 		case 0xe5:
-			n_drawoffset_x = SINT11( m_packet.n_entry[ 0 ] & 2047 );
-			if( m_n_gputype == 2 )
-			{
-				n_drawoffset_y = SINT11( ( m_packet.n_entry[ 0 ] >> 11 ) & 2047 );
-			}
-			else
-			{
-				n_drawoffset_y = SINT11( ( m_packet.n_entry[ 0 ] >> 12 ) & 2047 );
-			}
-			verboselog( machine(), 1, "%02x: drawing offset %d,%d\n", m_packet.n_entry[ 0 ] >> 24,
-				n_drawoffset_x, n_drawoffset_y );
+			draw_packet();
 			break;
 		case 0xe6:
 			n_gpustatus &= ~( 3L << 0xb );
 			n_gpustatus |= ( data & 0x03 ) << 0xb;
-			if( ( m_packet.n_entry[ 0 ] & 3 ) != 0 )
+			if( ( m_gpu_buffer.n_entry[ 0 ] & 3 ) != 0 )
 			{
-				verboselog( machine(), 1, "not handled: mask setting %d\n", m_packet.n_entry[ 0 ] & 3 );
+				verboselog( machine(), 1, "not handled: mask setting %d\n", m_gpu_buffer.n_entry[ 0 ] & 3 );
 			}
 			else
 			{
-				verboselog( machine(), 1, "mask setting %d\n", m_packet.n_entry[ 0 ] & 3 );
+				verboselog( machine(), 1, "mask setting %d\n", m_gpu_buffer.n_entry[ 0 ] & 3 );
 			}
 			break;
 		default:
 #if defined( MAME_DEBUG )
-			popmessage( "unknown GPU packet %08x", m_packet.n_entry[ 0 ] );
+			popmessage( "unknown GPU packet %08x", m_gpu_buffer.n_entry[ 0 ] );
 #endif
-			verboselog( machine(), 0, "unknown GPU packet %08x (%08x)\n", m_packet.n_entry[ 0 ], data );
+			verboselog( machine(), 0, "unknown GPU packet %08x (%08x)\n", m_gpu_buffer.n_entry[ 0 ], data );
 #if ( STOP_ON_ERROR )
 			n_gpu_buffer_offset = 1;
 #endif
@@ -3601,6 +3885,7 @@ WRITE32_MEMBER( psxgpu_device::write )
 			n_lightgun_y = 0;
 			break;
 		case 0x10:
+			render_sync();
 			switch( data & 0xff )
 			{
 			case 0x03:
@@ -3682,18 +3967,20 @@ void psxgpu_device::gpu_read( UINT32 *p_ram, INT32 n_size )
 			UINT32 n_pixel;
 			PAIR data;
 
+			render_sync();
+
 			verboselog( machine(), 2, "copy image from frame buffer ( %d, %d )\n", n_vramx, n_vramy );
 			data.d = 0;
 			for( n_pixel = 0; n_pixel < 2; n_pixel++ )
 			{
 				data.w.l = data.w.h;
-				data.w.h = *( p_p_vram[ ( n_vramy + ( m_packet.n_entry[ 1 ] >> 16 ) ) & 0x3ff ] + ( ( n_vramx + ( m_packet.n_entry[ 1 ] & 0xffff ) ) & 0x3ff ) );
+				data.w.h = *( p_p_vram[ ( n_vramy + ( m_gpu_buffer.n_entry[ 1 ] >> 16 ) ) & 0x3ff ] + ( ( n_vramx + ( m_gpu_buffer.n_entry[ 1 ] & 0xffff ) ) & 0x3ff ) );
 				n_vramx++;
-				if( n_vramx >= ( m_packet.n_entry[ 2 ] & 0xffff ) )
+				if( n_vramx >= ( m_gpu_buffer.n_entry[ 2 ] & 0xffff ) )
 				{
 					n_vramx = 0;
 					n_vramy++;
-					if( n_vramy >= ( m_packet.n_entry[ 2 ] >> 16 ) )
+					if( n_vramy >= ( m_gpu_buffer.n_entry[ 2 ] >> 16 ) )
 					{
 						verboselog( machine(), 1, "copy image from frame buffer end\n" );
 						n_gpustatus &= ~( 1L << 0x1b );
@@ -3758,6 +4045,7 @@ void psxgpu_device::vblank(screen_device &screen, bool vblank_state)
 void psxgpu_device::gpu_reset( void )
 {
 	verboselog( machine(), 1, "reset gpu\n" );
+	render_sync();
 	n_gpu_buffer_offset = 0;
 	n_gpustatus = 0x14802000;
 	n_drawarea_x1 = 0;
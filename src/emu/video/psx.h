@@ -207,10 +207,24 @@ public:
 
 protected:
 	virtual void device_start();
+	virtual void device_stop();
 	virtual void device_reset();
 
 private:
+	static const int RENDER_BATCH_PACKETS = 64;
+	static const int RENDER_BATCHES = 8;
+
+	// a run of complete packets drawn together on the render thread
+	struct render_batch
+	{
+		psxgpu_device *gpu;
+		osd_work_item *item;
+		int n_count;
+		PACKET packet[ RENDER_BATCH_PACKETS ];
+	};
+
 	void updatevisiblearea();
+	void update_tpage_status( UINT32 tpage );
 	void decode_tpage( UINT32 tpage );
 	void FlatPolygon( int n_points );
 	void FlatTexturedPolygon( int n_points );
@@ -231,6 +245,14 @@ private:
 	void gpu_reset();
 	void gpu_read( UINT32 *p_ram, INT32 n_size );
 	void gpu_write( UINT32 *p_ram, INT32 n_size );
+	void render_packet( void );
+	void draw_packet( void );
+	void render_submit( void );
+	void render_wait( render_batch &batch );
+	void render_sync( void );
+	void render_discard( void );
+	void render_reset( void );
+	static void *render_batch_callback( void *param, int threadid );
 
 	INT32 m_n_tx;
 	INT32 m_n_ty;
@@ -269,8 +291,13 @@ private:
 	UINT32 n_screenwidth;
 	UINT32 n_screenheight;
 
+	PACKET m_gpu_buffer;
 	PACKET m_packet;
 
+	osd_work_queue *m_render_queue;
+	render_batch m_render_batch[ RENDER_BATCHES ];
+	int m_render_batchnum;
+
 	UINT16 *p_p_vram[ 1024 ];
 
 	UINT16 p_n_redshade[ MAX_LEVEL * MAX_SHADE ];
@@ -469,4 +469,46 @@ INLINE void rgbaint_bilinear_filter(rgbaint *color, UINT32 rgb00, UINT32 rgb01,
 }
 
 
+/***************************************************************************
+    SPAN OPERATIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    rgba_blend_span - blend two runs of packed
+    colors by the given scale factor; each result
+    matches rgbaint_blend on that pixel
+-------------------------------------------------*/
+
+INLINE void rgba_blend_span(UINT32 *dest, const UINT32 *color1, const UINT32 *color2, int count, UINT8 color1scale)
+{
+	for (int i = 0; i < count; i++)
+	{
+		rgbaint c1, c2;
+		rgba_to_rgbaint(&c1, color1[i]);
+		rgba_to_rgbaint(&c2, color2[i]);
+		rgbaint_blend(&c1, &c2, color1scale);
+		dest[i] = rgbaint_to_rgba_clamp(&c1);
+	}
+}
+
+
+/*-------------------------------------------------
+    rgba_scale_span_and_clamp - scale a run of
+    packed colors by an 8.8 scale factor and clamp
+    to byte values; each result matches
+    rgbaint_scale_immediate_and_clamp on that pixel
+-------------------------------------------------*/
+
+INLINE void rgba_scale_span_and_clamp(UINT32 *dest, const UINT32 *src, int count, INT16 colorscale)
+{
+	for (int i = 0; i < count; i++)
+	{
+		rgbaint color;
+		rgba_to_rgbaint(&color, src[i]);
+		rgbaint_scale_immediate_and_clamp(&color, colorscale);
+		dest[i] = rgbaint_to_rgba_clamp(&color);
+	}
+}
+
+
 #endif /* __RGBUTIL__ */
@@ -321,7 +321,7 @@ INLINE void rgbaint_scale_immediate_and_clamp(rgbaint *color, INT16 colorscale)
 
 INLINE void rgbaint_scale_channel_and_clamp(rgbaint *color, const rgbint *colorscale)
 {
-	rgbint_scale_channel_and_clamp(color, color);
+	rgbint_scale_channel_and_clamp(color, colorscale);
 }
 
 
@@ -405,4 +405,86 @@ INLINE void rgbaint_bilinear_filter(rgbaint *color, UINT32 rgb00, UINT32 rgb01,
 }
 
 
+/***************************************************************************
+    SPAN OPERATIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    rgba_blend_span - blend two runs of packed
+    colors by the given scale factor; each result
+    matches rgbaint_blend on that pixel
+-------------------------------------------------*/
+
+INLINE void rgba_blend_span(UINT32 *dest, const UINT32 *color1, const UINT32 *color2, int count, UINT8 color1scale)
+{
+	__m128i scale = *(__m128i *)&rgbsse_statics.scale_table[color1scale][0];
+	__m128i zero = _mm_setzero_si128();
+	int i;
+
+	/* four pixels per iteration, widened to two pixels per register */
+	for (i = 0; i + 4 <= count; i += 4)
+	{
+		__m128i c1 = _mm_loadu_si128((const __m128i *)&color1[i]);
+		__m128i c2 = _mm_loadu_si128((const __m128i *)&color2[i]);
+		__m128i c1lo = _mm_unpacklo_epi8(c1, zero);
+		__m128i c2lo = _mm_unpacklo_epi8(c2, zero);
+		__m128i c1hi = _mm_unpackhi_epi8(c1, zero);
+		__m128i c2hi = _mm_unpackhi_epi8(c2, zero);
+		__m128i p0 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(c1lo, c2lo), scale), 8);
+		__m128i p1 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(c1lo, c2lo), scale), 8);
+		__m128i p2 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(c1hi, c2hi), scale), 8);
+		__m128i p3 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(c1hi, c2hi), scale), 8);
+		_mm_storeu_si128((__m128i *)&dest[i], _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3)));
+	}
+
+	for ( ; i < count; i++)
+	{
+		rgbaint c1, c2;
+		rgba_to_rgbaint(&c1, color1[i]);
+		rgba_to_rgbaint(&c2, color2[i]);
+		rgbaint_blend(&c1, &c2, color1scale);
+		dest[i] = rgbaint_to_rgba_clamp(&c1);
+	}
+}
+
+
+/*-------------------------------------------------
+    rgba_scale_span_and_clamp - scale a run of
+    packed colors by an 8.8 scale factor and clamp
+    to byte values; each result matches
+    rgbaint_scale_immediate_and_clamp on that pixel
+-------------------------------------------------*/
+
+INLINE void rgba_scale_span_and_clamp(UINT32 *dest, const UINT32 *src, int count, INT16 colorscale)
+{
+	__m128i mscale = _mm_set1_epi16(colorscale);
+	__m128i maxbyte = *(__m128i *)&rgbsse_statics.maxbyte;
+	__m128i zero = _mm_setzero_si128();
+	int i;
+
+	/* four pixels per iteration, widened to two pixels per register */
+	for (i = 0; i + 4 <= count; i += 4)
+	{
+		__m128i color = _mm_loadu_si128((const __m128i *)&src[i]);
+		__m128i lo = _mm_unpacklo_epi8(color, zero);
+		__m128i hi = _mm_unpackhi_epi8(color, zero);
+		__m128i p0 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(lo, zero), mscale), 8);
+		__m128i p1 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(lo, zero), mscale), 8);
+		__m128i p2 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(hi, zero), mscale), 8);
+		__m128i p3 = _mm_srli_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(hi, zero), mscale), 8);
+		lo = _mm_min_epi16(_mm_packs_epi32(p0, p1), maxbyte);
+		hi = _mm_min_epi16(_mm_packs_epi32(p2, p3), maxbyte);
+		_mm_storeu_si128((__m128i *)&dest[i], _mm_packus_epi16(lo, hi));
+	}
+
+	for ( ; i < count; i++)
+	{
+		rgbaint color;
+		rgba_to_rgbaint(&color, src[i]);
+		rgbaint_scale_immediate_and_clamp(&color, colorscale);
+		dest[i] = rgbaint_to_rgba_clamp(&color);
+	}
+}
+
+
 #endif /* __RGBSSE__ */
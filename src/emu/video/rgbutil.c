@@ -299,3 +299,128 @@ const struct _rgbvmx_statics rgbvmx_statics =
 	}
 };
 #endif // defined(__ALTIVEC__)
+
+
+
+/***************************************************************************
+    SELF TESTS
+***************************************************************************/
+
+/*-------------------------------------------------
+    rgbutil_next_random - reproducible random
+    numbers for the self tests
+-------------------------------------------------*/
+
+static UINT32 rgbutil_next_random(UINT32 &seed)
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 8;
+}
+
+
+/*-------------------------------------------------
+    rgbutil_validate - check that the span
+    operations match the single-pixel ones and
+    that bilinear filtering stays within two
+    steps of the exact result; returns the number
+    of failures
+-------------------------------------------------*/
+
+int rgbutil_validate()
+{
+	UINT32 seed = 0x5eed;
+	int errors = 0;
+
+	/* spans of every length around the four-pixel blocks, at every alignment, including in place */
+	for (int test = 0; test < 256; test++)
+	{
+		UINT32 color1[48], color2[48], dest[48];
+		int count = test % 41;
+		int offset = (test / 41) % 4;
+		bool inplace = (test & 1) != 0;
+		UINT8 blendscale = rgbutil_next_random(seed);
+		INT16 colorscale = rgbutil_next_random(seed) % 0x200;
+
+		for (int i = 0; i < ARRAY_LENGTH(color1); i++)
+		{
+			color1[i] = rgbutil_next_random(seed) ^ (rgbutil_next_random(seed) << 16);
+			color2[i] = rgbutil_next_random(seed) ^ (rgbutil_next_random(seed) << 16);
+		}
+
+		/* blend */
+		UINT32 *out = inplace ? &color1[offset] : &dest[offset];
+		UINT32 expected[48];
+		for (int i = 0; i < count; i++)
+		{
+			rgbaint c1, c2;
+			rgba_to_rgbaint(&c1, color1[offset + i]);
+			rgba_to_rgbaint(&c2, color2[offset + i]);
+			rgbaint_blend(&c1, &c2, blendscale);
+			expected[i] = rgbaint_to_rgba_clamp(&c1);
+		}
+		rgba_blend_span(out, &color1[offset], &color2[offset], count, blendscale);
+		for (int i = 0; i < count; i++)
+			if (out[i] != expected[i])
+			{
+				osd_printf_error("rgba_blend_span mismatch (count %d, offset %d, scale %d, pixel %d: %08X, expected %08X)\n", count, offset, blendscale, i, out[i], expected[i]);
+				errors++;
+				break;
+			}
+
+		/* scale and clamp */
+		out = inplace ? &color2[offset] : &dest[offset];
+		for (int i = 0; i < count; i++)
+		{
+			rgbaint color;
+			rgba_to_rgbaint(&color, color2[offset + i]);
+			rgbaint_scale_immediate_and_clamp(&color, colorscale);
+			expected[i] = rgbaint_to_rgba_clamp(&color);
+		}
+		rgba_scale_span_and_clamp(out, &color2[offset], count, colorscale);
+		for (int i = 0; i < count; i++)
+			if (out[i] != expected[i])
+			{
+				osd_printf_error("rgba_scale_span_and_clamp mismatch (count %d, offset %d, scale %d, pixel %d: %08X, expected %08X)\n", count, offset, colorscale, i, out[i], expected[i]);
+				errors++;
+				break;
+			}
+	}
+
+	/* bilinear filtering: the packed and unpacked forms agree, and every channel is less than two steps from the exact blend */
+	for (int test = 0; test < 4096; test++)
+	{
+		UINT32 rgb00 = rgbutil_next_random(seed) ^ (rgbutil_next_random(seed) << 16);
+		UINT32 rgb01 = rgbutil_next_random(seed) ^ (rgbutil_next_random(seed) << 16);
+		UINT32 rgb10 = rgbutil_next_random(seed) ^ (rgbutil_next_random(seed) << 16);
+		UINT32 rgb11 = rgbutil_next_random(seed) ^ (rgbutil_next_random(seed) << 16);
+		UINT8 u = (test < 16) ? (test & 3) * 0x55 : rgbutil_next_random(seed);
+		UINT8 v = (test < 16) ? (test >> 2) * 0x55 : rgbutil_next_random(seed);
+
+		UINT32 rgb = rgb_bilinear_filter(rgb00, rgb01, rgb10, rgb11, u, v);
+		UINT32 rgba = rgba_bilinear_filter(rgb00, rgb01, rgb10, rgb11, u, v);
+		rgbint irgb;
+		rgbaint irgba;
+		rgbint_bilinear_filter(&irgb, rgb00, rgb01, rgb10, rgb11, u, v);
+		rgbaint_bilinear_filter(&irgba, rgb00, rgb01, rgb10, rgb11, u, v);
+
+		bool match = ((rgb ^ rgbint_to_rgb(&irgb)) & 0xffffff) == 0 && rgba == rgbaint_to_rgba(&irgba) && ((rgb ^ rgba) & 0xffffff) == 0;
+		for (int shift = 0; shift < 32 && match; shift += 8)
+		{
+			INT32 c00 = (rgb00 >> shift) & 0xff, c01 = (rgb01 >> shift) & 0xff;
+			INT32 c10 = (rgb10 >> shift) & 0xff, c11 = (rgb11 >> shift) & 0xff;
+			INT32 exact = c00 * (256 - u) * (256 - v) + c01 * u * (256 - v) + c10 * (256 - u) * v + c11 * u * v;
+			INT32 result = ((rgba >> shift) & 0xff) << 16;
+			if (result <= exact - 0x20000 || result >= exact + 0x20000)
+				match = false;
+		}
+		if (u == 0 && v == 0 && ((rgba ^ rgb00) & 0xffffff) != 0)
+			match = false;
+
+		if (!match)
+		{
+			osd_printf_error("Bilinear filter mismatch (%08X %08X %08X %08X, u=%02X v=%02X: rgb %08X, rgba %08X)\n", rgb00, rgb01, rgb10, rgb11, u, v, rgb, rgba);
+			errors++;
+		}
+	}
+	return errors;
+}
@@ -22,4 +22,7 @@
 #include "rgbgen.h"
 #endif
 
+/* self test: compares the span operations with the single-pixel ones; returns the number of failures */
+int rgbutil_validate();
+
 #endif /* __RGBUTIL__ */
@@ -304,7 +304,7 @@ INLINE void rgbaint_scale_immediate_and_clamp(rgbaint *color, INT16 colorscale)
 
 INLINE void rgbaint_scale_channel_and_clamp(rgbaint *color, const rgbint *colorscale)
 {
-	rgbaint vecscale = (rgbaint)vec_mergeh(*color, (rgbaint)vec_splat_s32(0));
+	rgbaint vecscale = (rgbaint)vec_mergeh(*colorscale, (rgbaint)vec_splat_s32(0));
 	vector signed int temp;
 	*color = (rgbaint)vec_mergeh(*color, (rgbaint)vec_splat_s32(0));
 	temp = vec_msum(*color, vecscale, vec_splat_s32(0));
@@ -434,6 +434,49 @@ INLINE void rgbaint_bilinear_filter(rgbaint *color, rgb_t const &rgb00, rgb_t co
 	*color = vec_packs((vector signed int)color01, (vector signed int)color01);
 }
 
+
+/***************************************************************************
+    SPAN OPERATIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    rgba_blend_span - blend two runs of packed
+    colors by the given scale factor; each result
+    matches rgbaint_blend on that pixel
+-------------------------------------------------*/
+
+INLINE void rgba_blend_span(UINT32 *dest, const UINT32 *color1, const UINT32 *color2, int count, UINT8 color1scale)
+{
+	for (int i = 0; i < count; i++)
+	{
+		rgbaint c1, c2;
+		rgba_to_rgbaint(&c1, color1[i]);
+		rgba_to_rgbaint(&c2, color2[i]);
+		rgbaint_blend(&c1, &c2, color1scale);
+		dest[i] = rgbaint_to_rgba_clamp(&c1);
+	}
+}
+
+
+/*-------------------------------------------------
+    rgba_scale_span_and_clamp - scale a run of
+    packed colors by an 8.8 scale factor and clamp
+    to byte values; each result matches
+    rgbaint_scale_immediate_and_clamp on that pixel
+-------------------------------------------------*/
+
+INLINE void rgba_scale_span_and_clamp(UINT32 *dest, const UINT32 *src, int count, INT16 colorscale)
+{
+	for (int i = 0; i < count; i++)
+	{
+		rgbaint color;
+		rgba_to_rgbaint(&color, src[i]);
+		rgbaint_scale_immediate_and_clamp(&color, colorscale);
+		dest[i] = rgbaint_to_rgba_clamp(&color);
+	}
+}
+
+
 // altivec.h somehow redefines "bool" in a bad way on PowerPC Mac OS X.  really.
 #ifdef SDLMAME_MACOSX
 #undef vector
@@ -264,6 +264,8 @@ void saturn_state::stv_set_framebuffer_config( void )
 	if ( m_vdp1.framebuffer_mode == STV_VDP1_TVM &&
 			m_vdp1.framebuffer_double_interlace == STV_VDP1_DIE ) return;
 
+	stv_vdp1_sync();
+
 	if ( VDP1_LOG ) logerror( "Setting framebuffer config\n" );
 	m_vdp1.framebuffer_mode = STV_VDP1_TVM;
 	m_vdp1.framebuffer_double_interlace = STV_VDP1_DIE;
@@ -337,6 +339,9 @@ WRITE32_MEMBER ( saturn_state::saturn_vdp1_vram_w )
 {
 	UINT8 *vdp1 = m_vdp1.gfx_decode;
 
+	/* the list being drawn may still read sprite data from here */
+	stv_vdp1_sync();
+
 	COMBINE_DATA (&m_vdp1_vram[offset]);
 
 //  if (((offset * 4) > 0xdf) && ((offset * 4) < 0x140))
@@ -354,6 +359,8 @@ WRITE32_MEMBER ( saturn_state::saturn_vdp1_vram_w )
 
 WRITE32_MEMBER ( saturn_state::saturn_vdp1_framebuffer0_w )
 {
+	stv_vdp1_sync();
+
 	//popmessage ("STV VDP1 Framebuffer 0 WRITE offset %08x data %08x",offset, data);
 	if ( STV_VDP1_TVM & 1 )
 	{
@@ -397,6 +404,9 @@ WRITE32_MEMBER ( saturn_state::saturn_vdp1_framebuffer0_w )
 READ32_MEMBER ( saturn_state::saturn_vdp1_framebuffer0_r )
 {
 	UINT32 result = 0;
+
+	stv_vdp1_sync();
+
 	//popmessage ("STV VDP1 Framebuffer 0 READ offset %08x",offset);
 	if ( STV_VDP1_TVM & 1 )
 	{
@@ -1367,12 +1377,12 @@ void saturn_state::vdp1_fill_quad(const rectangle &cliprect, int patterndata, in
 
 int saturn_state::x2s(int v)
 {
-	return (INT32)(INT16)v + m_vdp1.local_x;
+	return (INT32)(INT16)v + m_vdp1.draw_local_x;
 }
 
 int saturn_state::y2s(int v)
 {
-	return (INT32)(INT16)v + m_vdp1.local_y;
+	return (INT32)(INT16)v + m_vdp1.draw_local_y;
 }
 
 void saturn_state::stv_vdp1_draw_line(const rectangle &cliprect)
@@ -1762,12 +1772,117 @@ TIMER_CALLBACK_MEMBER(saturn_state::vdp1_draw_end )
 }
 
 
+/*
+With -gpu_async, drawing commands are recorded while the list is walked and
+then drawn on a worker thread. Walking the list (jumps, clipping and local
+coordinate commands, COPR and the draw end timing) still happens here, so
+only the pixels are deferred. Anything that reads or writes VDP1 VRAM or the
+framebuffers, or changes their layout, waits for the worker first.
+*/
+
+void saturn_state::stv_vdp1_begin_list( void )
+{
+	if (m_vdp1.work_queue == NULL)
+	{
+		stv_clear_gouraud_shading();
+		return;
+	}
+
+	/* the other buffer may still be drawing */
+	m_vdp1.commands[m_vdp1.commands_filling].resize(0);
+}
+
+void saturn_state::stv_vdp1_queue_command( struct stv_vdp1_command &cmd, const rectangle &cliprect )
+{
+	cmd.cliprect = cliprect;
+	cmd.local_x = m_vdp1.local_x;
+	cmd.local_y = m_vdp1.local_y;
+
+	if (m_vdp1.work_queue == NULL)
+		stv_vdp1_draw_command(cmd);
+	else
+		m_vdp1.commands[m_vdp1.commands_filling].append() = cmd;
+}
+
+void saturn_state::stv_vdp1_end_list( void )
+{
+	if (m_vdp1.work_queue == NULL)
+		return;
+
+	/* one list at a time: wait for the previous one, then hand this one over */
+	stv_vdp1_sync();
+	if (m_vdp1.commands[m_vdp1.commands_filling].count() == 0)
+		return;
+
+	m_vdp1.commands_drawing = m_vdp1.commands_filling;
+	m_vdp1.commands_filling ^= 1;
+	m_vdp1.draw_item = osd_work_item_queue(m_vdp1.work_queue, stv_vdp1_draw_list_callback, this, 0);
+	if (m_vdp1.draw_item == NULL)
+		stv_vdp1_draw_list_callback(this, 0);
+}
+
+void saturn_state::stv_vdp1_sync( void )
+{
+	if (m_vdp1.draw_item != NULL)
+	{
+		osd_work_item_wait(m_vdp1.draw_item, 100 * osd_ticks_per_second());
+		osd_work_item_release(m_vdp1.draw_item);
+		m_vdp1.draw_item = NULL;
+	}
+}
+
+void *saturn_state::stv_vdp1_draw_list_callback( void *param, int threadid )
+{
+	saturn_state *state = (saturn_state *)param;
+	dynamic_array<stv_vdp1_command> &commands = state->m_vdp1.commands[state->m_vdp1.commands_drawing];
+
+	state->stv_clear_gouraud_shading();
+	for (int cmdnum = 0; cmdnum < commands.count(); cmdnum++)
+		state->stv_vdp1_draw_command(commands[cmdnum]);
+	return NULL;
+}
+
+void saturn_state::stv_vdp1_draw_command( const struct stv_vdp1_command &cmd )
+{
+	stv2_current_sprite = cmd.sprite;
+	m_vdp1.draw_local_x = cmd.local_x;
+	m_vdp1.draw_local_y = cmd.local_y;
+
+	stv_vdp1_set_drawpixel();
+
+	switch (stv2_current_sprite.CMDCTRL & 0x000f)
+	{
+		case 0x0000:
+			stv_vdp1_draw_normal_sprite(cmd.cliprect, 0);
+			break;
+
+		case 0x0001:
+			stv_vdp1_draw_scaled_sprite(cmd.cliprect);
+			break;
+
+		case 0x0002:
+		case 0x0003:
+		case 0x0004:
+			stv_vdp1_draw_distorted_sprite(cmd.cliprect);
+			break;
+
+		case 0x0005:
+			stv_vdp1_draw_poly_line(cmd.cliprect);
+			break;
+
+		case 0x0006:
+			stv_vdp1_draw_line(cmd.cliprect);
+			break;
+	}
+}
+
 void saturn_state::stv_vdp1_process_list( void )
 {
 	int position;
 	int spritecount;
 	int vdp1_nest;
 	rectangle *cliprect;
+	struct stv_vdp1_command cmd;
 
 	spritecount = 0;
 	position = 0;
@@ -1776,7 +1891,7 @@ void saturn_state::stv_vdp1_process_list( void )
 
 	vdp1_nest = -1;
 
-	stv_clear_gouraud_shading();
+	stv_vdp1_begin_list();
 
 	/*Set CEF bit to 0*/
 	CEF_0;
@@ -1795,47 +1910,47 @@ void saturn_state::stv_vdp1_process_list( void )
 
 		spritecount++;
 
-		stv2_current_sprite.CMDCTRL = (m_vdp1_vram[position * (0x20/4)+0] & 0xffff0000) >> 16;
+		cmd.sprite.CMDCTRL = (m_vdp1_vram[position * (0x20/4)+0] & 0xffff0000) >> 16;
 
-		if (stv2_current_sprite.CMDCTRL == 0x8000)
+		if (cmd.sprite.CMDCTRL == 0x8000)
 		{
 			if (VDP1_LOG) logerror ("List Terminator (0x8000) Encountered, Sprite List Process END\n");
 			goto end; // end of list
 		}
 
-		stv2_current_sprite.CMDLINK = (m_vdp1_vram[position * (0x20/4)+0] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDPMOD = (m_vdp1_vram[position * (0x20/4)+1] & 0xffff0000) >> 16;
-		stv2_current_sprite.CMDCOLR = (m_vdp1_vram[position * (0x20/4)+1] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDSRCA = (m_vdp1_vram[position * (0x20/4)+2] & 0xffff0000) >> 16;
-		stv2_current_sprite.CMDSIZE = (m_vdp1_vram[position * (0x20/4)+2] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDXA   = (m_vdp1_vram[position * (0x20/4)+3] & 0xffff0000) >> 16;
-		stv2_current_sprite.CMDYA   = (m_vdp1_vram[position * (0x20/4)+3] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDXB   = (m_vdp1_vram[position * (0x20/4)+4] & 0xffff0000) >> 16;
-		stv2_current_sprite.CMDYB   = (m_vdp1_vram[position * (0x20/4)+4] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDXC   = (m_vdp1_vram[position * (0x20/4)+5] & 0xffff0000) >> 16;
-		stv2_current_sprite.CMDYC   = (m_vdp1_vram[position * (0x20/4)+5] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDXD   = (m_vdp1_vram[position * (0x20/4)+6] & 0xffff0000) >> 16;
-		stv2_current_sprite.CMDYD   = (m_vdp1_vram[position * (0x20/4)+6] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDGRDA = (m_vdp1_vram[position * (0x20/4)+7] & 0xffff0000) >> 16;
-//      stv2_current_sprite.UNUSED  = (m_vdp1_vram[position * (0x20/4)+7] & 0x0000ffff) >> 0;
+		cmd.sprite.CMDLINK = (m_vdp1_vram[position * (0x20/4)+0] & 0x0000ffff) >> 0;
+		cmd.sprite.CMDPMOD = (m_vdp1_vram[position * (0x20/4)+1] & 0xffff0000) >> 16;
+		cmd.sprite.CMDCOLR = (m_vdp1_vram[position * (0x20/4)+1] & 0x0000ffff) >> 0;
+		cmd.sprite.CMDSRCA = (m_vdp1_vram[position * (0x20/4)+2] & 0xffff0000) >> 16;
+		cmd.sprite.CMDSIZE = (m_vdp1_vram[position * (0x20/4)+2] & 0x0000ffff) >> 0;
+		cmd.sprite.CMDXA   = (m_vdp1_vram[position * (0x20/4)+3] & 0xffff0000) >> 16;
+		cmd.sprite.CMDYA   = (m_vdp1_vram[position * (0x20/4)+3] & 0x0000ffff) >> 0;
+		cmd.sprite.CMDXB   = (m_vdp1_vram[position * (0x20/4)+4] & 0xffff0000) >> 16;
+		cmd.sprite.CMDYB   = (m_vdp1_vram[position * (0x20/4)+4] & 0x0000ffff) >> 0;
+		cmd.sprite.CMDXC   = (m_vdp1_vram[position * (0x20/4)+5] & 0xffff0000) >> 16;
+		cmd.sprite.CMDYC   = (m_vdp1_vram[position * (0x20/4)+5] & 0x0000ffff) >> 0;
+		cmd.sprite.CMDXD   = (m_vdp1_vram[position * (0x20/4)+6] & 0xffff0000) >> 16;
+		cmd.sprite.CMDYD   = (m_vdp1_vram[position * (0x20/4)+6] & 0x0000ffff) >> 0;
+		cmd.sprite.CMDGRDA = (m_vdp1_vram[position * (0x20/4)+7] & 0xffff0000) >> 16;
+//      cmd.sprite.UNUSED  = (m_vdp1_vram[position * (0x20/4)+7] & 0x0000ffff) >> 0;
 
 		/* proecess jump / skip commands, set position for next sprite */
-		switch (stv2_current_sprite.CMDCTRL & 0x7000)
+		switch (cmd.sprite.CMDCTRL & 0x7000)
 		{
 			case 0x0000: // jump next
 				if (VDP1_LOG) logerror ("Sprite List Process + Next (Normal)\n");
 				position++;
 				break;
 			case 0x1000: // jump assign
-				if (VDP1_LOG) logerror ("Sprite List Process + Jump Old %06x New %06x\n", position, (stv2_current_sprite.CMDLINK>>2));
-				position= (stv2_current_sprite.CMDLINK>>2);
+				if (VDP1_LOG) logerror ("Sprite List Process + Jump Old %06x New %06x\n", position, (cmd.sprite.CMDLINK>>2));
+				position= (cmd.sprite.CMDLINK>>2);
 				break;
 			case 0x2000: // jump call
 				if (vdp1_nest == -1)
 				{
-					if (VDP1_LOG) logerror ("Sprite List Process + Call Old %06x New %06x\n",position, (stv2_current_sprite.CMDLINK>>2));
+					if (VDP1_LOG) logerror ("Sprite List Process + Call Old %06x New %06x\n",position, (cmd.sprite.CMDLINK>>2));
 					vdp1_nest = position+1;
-					position = (stv2_current_sprite.CMDLINK>>2);
+					position = (cmd.sprite.CMDLINK>>2);
 				}
 				else
 				{
@@ -1862,19 +1977,19 @@ void saturn_state::stv_vdp1_process_list( void )
 				position++;
 				break;
 			case 0x5000:
-				if (VDP1_LOG) logerror ("Sprite List Skip + Jump Old %06x New %06x\n", position, (stv2_current_sprite.CMDLINK>>2));
+				if (VDP1_LOG) logerror ("Sprite List Skip + Jump Old %06x New %06x\n", position, (cmd.sprite.CMDLINK>>2));
 				draw_this_sprite = 0;
-				position= (stv2_current_sprite.CMDLINK>>2);
+				position= (cmd.sprite.CMDLINK>>2);
 
 				break;
 			case 0x6000:
 				draw_this_sprite = 0;
 				if (vdp1_nest == -1)
 				{
-					if (VDP1_LOG) logerror ("Sprite List Skip + Call To Subroutine Old %06x New %06x\n",position, (stv2_current_sprite.CMDLINK>>2));
+					if (VDP1_LOG) logerror ("Sprite List Skip + Call To Subroutine Old %06x New %06x\n",position, (cmd.sprite.CMDLINK>>2));
 
 					vdp1_nest = position+1;
-					position = (stv2_current_sprite.CMDLINK>>2);
+					position = (cmd.sprite.CMDLINK>>2);
 				}
 				else
 				{
@@ -1903,9 +2018,9 @@ void saturn_state::stv_vdp1_process_list( void )
 		/* continue to draw this sprite only if the command wasn't to skip it */
 		if (draw_this_sprite ==1)
 		{
-			if ( stv2_current_sprite.CMDPMOD & 0x0400 )
+			if ( cmd.sprite.CMDPMOD & 0x0400 )
 			{
-				//if(stv2_current_sprite.CMDPMOD & 0x0200) /* TODO: Bio Hazard inventory screen uses outside cliprect */
+				//if(cmd.sprite.CMDPMOD & 0x0200) /* TODO: Bio Hazard inventory screen uses outside cliprect */
 				//  cliprect = &m_vdp1.system_cliprect;
 				//else
 					cliprect = &m_vdp1.user_cliprect;
@@ -1915,75 +2030,74 @@ void saturn_state::stv_vdp1_process_list( void )
 				cliprect = &m_vdp1.system_cliprect;
 			}
 
-			stv_vdp1_set_drawpixel();
-
-			switch (stv2_current_sprite.CMDCTRL & 0x000f)
+			switch (cmd.sprite.CMDCTRL & 0x000f)
 			{
 				case 0x0000:
-					if (VDP1_LOG) logerror ("Sprite List Normal Sprite (%d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
-					stv2_current_sprite.ispoly = 0;
-					stv_vdp1_draw_normal_sprite(*cliprect, 0);
+					if (VDP1_LOG) logerror ("Sprite List Normal Sprite (%d %d)\n",cmd.sprite.CMDXA,cmd.sprite.CMDYA);
+					cmd.sprite.ispoly = 0;
+					stv_vdp1_queue_command(cmd, *cliprect);
 					break;
 
 				case 0x0001:
-					if (VDP1_LOG) logerror ("Sprite List Scaled Sprite (%d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
-					stv2_current_sprite.ispoly = 0;
-					stv_vdp1_draw_scaled_sprite(*cliprect);
+					if (VDP1_LOG) logerror ("Sprite List Scaled Sprite (%d %d)\n",cmd.sprite.CMDXA,cmd.sprite.CMDYA);
+					cmd.sprite.ispoly = 0;
+					stv_vdp1_queue_command(cmd, *cliprect);
 					break;
 
 				case 0x0002:
 				case 0x0003: // used by Hardcore 4x4
 					if (VDP1_LOG) logerror ("Sprite List Distorted Sprite\n");
-					if (VDP1_LOG) logerror ("(A: %d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
-					if (VDP1_LOG) logerror ("(B: %d %d)\n",stv2_current_sprite.CMDXB,stv2_current_sprite.CMDYB);
-					if (VDP1_LOG) logerror ("(C: %d %d)\n",stv2_current_sprite.CMDXC,stv2_current_sprite.CMDYC);
-					if (VDP1_LOG) logerror ("(D: %d %d)\n",stv2_current_sprite.CMDXD,stv2_current_sprite.CMDYD);
-					if (VDP1_LOG) logerror ("CMDPMOD = %04x\n",stv2_current_sprite.CMDPMOD);
-
-					stv2_current_sprite.ispoly = 0;
-					stv_vdp1_draw_distorted_sprite(*cliprect);
+					if (VDP1_LOG) logerror ("(A: %d %d)\n",cmd.sprite.CMDXA,cmd.sprite.CMDYA);
+					if (VDP1_LOG) logerror ("(B: %d %d)\n",cmd.sprite.CMDXB,cmd.sprite.CMDYB);
+					if (VDP1_LOG) logerror ("(C: %d %d)\n",cmd.sprite.CMDXC,cmd.sprite.CMDYC);
+					if (VDP1_LOG) logerror ("(D: %d %d)\n",cmd.sprite.CMDXD,cmd.sprite.CMDYD);
+					if (VDP1_LOG) logerror ("CMDPMOD = %04x\n",cmd.sprite.CMDPMOD);
+
+					cmd.sprite.ispoly = 0;
+					stv_vdp1_queue_command(cmd, *cliprect);
 					break;
 
 				case 0x0004:
 					if (VDP1_LOG) logerror ("Sprite List Polygon\n");
-					stv2_current_sprite.ispoly = 1;
-					stv_vdp1_draw_distorted_sprite(*cliprect);
+					cmd.sprite.ispoly = 1;
+					stv_vdp1_queue_command(cmd, *cliprect);
 					break;
 
 				case 0x0005:
 //              case 0x0007: // mirror? Baroque uses it, crashes for whatever reason
 					if (VDP1_LOG) logerror ("Sprite List Polyline\n");
-					stv2_current_sprite.ispoly = 1;
-					stv_vdp1_draw_poly_line(*cliprect);
+					cmd.sprite.ispoly = 1;
+					stv_vdp1_queue_command(cmd, *cliprect);
 					break;
 
 				case 0x0006:
 					if (VDP1_LOG) logerror ("Sprite List Line\n");
-					stv2_current_sprite.ispoly = 1;
-					stv_vdp1_draw_line(*cliprect);
+					cmd.sprite.ispoly = 1;
+					stv_vdp1_queue_command(cmd, *cliprect);
 					break;
 
 				case 0x0008:
 //              case 0x000b: // mirror? Bug 2
-					if (VDP1_LOG) logerror ("Sprite List Set Command for User Clipping (%d,%d),(%d,%d)\n", stv2_current_sprite.CMDXA, stv2_current_sprite.CMDYA, stv2_current_sprite.CMDXC, stv2_current_sprite.CMDYC);
-					m_vdp1.user_cliprect.set(stv2_current_sprite.CMDXA, stv2_current_sprite.CMDXC, stv2_current_sprite.CMDYA, stv2_current_sprite.CMDYC);
+					if (VDP1_LOG) logerror ("Sprite List Set Command for User Clipping (%d,%d),(%d,%d)\n", cmd.sprite.CMDXA, cmd.sprite.CMDYA, cmd.sprite.CMDXC, cmd.sprite.CMDYC);
+					m_vdp1.user_cliprect.set(cmd.sprite.CMDXA, cmd.sprite.CMDXC, cmd.sprite.CMDYA, cmd.sprite.CMDYC);
 					break;
 
 				case 0x0009:
-					if (VDP1_LOG) logerror ("Sprite List Set Command for System Clipping (0,0),(%d,%d)\n", stv2_current_sprite.CMDXC, stv2_current_sprite.CMDYC);
-					m_vdp1.system_cliprect.set(0, stv2_current_sprite.CMDXC, 0, stv2_current_sprite.CMDYC);
+					if (VDP1_LOG) logerror ("Sprite List Set Command for System Clipping (0,0),(%d,%d)\n", cmd.sprite.CMDXC, cmd.sprite.CMDYC);
+					m_vdp1.system_cliprect.set(0, cmd.sprite.CMDXC, 0, cmd.sprite.CMDYC);
 					break;
 
 				case 0x000a:
-					if (VDP1_LOG) logerror ("Sprite List Local Co-Ordinate Set (%d %d)\n",(INT16)stv2_current_sprite.CMDXA,(INT16)stv2_current_sprite.CMDYA);
-					m_vdp1.local_x = (INT16)stv2_current_sprite.CMDXA;
-					m_vdp1.local_y = (INT16)stv2_current_sprite.CMDYA;
+					if (VDP1_LOG) logerror ("Sprite List Local Co-Ordinate Set (%d %d)\n",(INT16)cmd.sprite.CMDXA,(INT16)cmd.sprite.CMDYA);
+					m_vdp1.local_x = (INT16)cmd.sprite.CMDXA;
+					m_vdp1.local_y = (INT16)cmd.sprite.CMDYA;
 					break;
 
 				default:
-					popmessage ("VDP1: Sprite List Illegal %02x, contact MAMEdev",stv2_current_sprite.CMDCTRL & 0xf);
+					popmessage ("VDP1: Sprite List Illegal %02x, contact MAMEdev",cmd.sprite.CMDCTRL & 0xf);
 					m_vdp1.lopr = (position * 0x20) >> 3;
 					m_vdp1.copr = (position * 0x20) >> 3;
+					stv_vdp1_end_list();
 					return;
 			}
 		}
@@ -1993,6 +2107,7 @@ void saturn_state::stv_vdp1_process_list( void )
 
 	end:
 	m_vdp1.copr = (position * 0x20) >> 3;
+	stv_vdp1_end_list();
 
 	/* TODO: what's the exact formula? Guess it should be a mix between number of pixels written and actual command data fetched. */
 	machine().scheduler().timer_set(m_maincpu->cycles_to_attotime(spritecount*16), timer_expired_delegate(FUNC(saturn_state::vdp1_draw_end),this));
@@ -2020,6 +2135,9 @@ void saturn_state::video_update_vdp1( void )
 //      }
 //  }
 	if (VDP1_LOG) logerror("video_update_vdp1 called\n");
+
+	/* the framebuffers are about to be swapped or erased */
+	stv_vdp1_sync();
 	if (VDP1_LOG) logerror( "FBCR = %0x, accessed = %d\n", STV_VDP1_FBCR, m_vdp1.fbcr_accessed );
 
 	if(STV_VDP1_CEF)
@@ -2101,6 +2219,8 @@ void saturn_state::stv_vdp1_state_save_postload( void )
 	int offset;
 	UINT32 data;
 
+	stv_vdp1_sync();
+
 	m_vdp1.framebuffer_mode = -1;
 	m_vdp1.framebuffer_double_interlace = -1;
 
@@ -2153,6 +2273,26 @@ int saturn_state::stv_vdp1_start ( void )
 	save_item(NAME(m_vdp1.framebuffer_clear_on_next_frame));
 	save_item(NAME(m_vdp1.local_x));
 	save_item(NAME(m_vdp1.local_y));
+	machine().save().register_presave(save_prepost_delegate(FUNC(saturn_state::stv_vdp1_sync), this));
 	machine().save().register_postload(save_prepost_delegate(FUNC(saturn_state::stv_vdp1_state_save_postload), this));
+
+	/* command lists can optionally be drawn on a worker thread */
+	m_vdp1.work_queue = NULL;
+	m_vdp1.draw_item = NULL;
+	m_vdp1.commands_filling = 0;
+	m_vdp1.commands_drawing = 0;
+	m_vdp1.draw_local_x = m_vdp1.draw_local_y = 0;
+	if (machine().options().gpu_async())
+	{
+		m_vdp1.work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ);
+		machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(saturn_state::stv_vdp1_exit), this));
+	}
 	return 0;
 }
+
+void saturn_state::stv_vdp1_exit( void )
+{
+	stv_vdp1_sync();
+	osd_work_queue_free(m_vdp1.work_queue);
+	m_vdp1.work_queue = NULL;
+}
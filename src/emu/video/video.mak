@@ -393,15 +393,6 @@ VIDEOOBJS+= $(VIDEOOBJ)/pc_vga.o
 VIDEOOBJS+= $(BUSOBJ)/isa/trident.o
 endif
 
-#-------------------------------------------------
-#
-#@src/emu/video/polylgcy.h,VIDEOS += POLY
-#-------------------------------------------------
-
-ifneq ($(filter POLY,$(VIDEOS)),)
-VIDEOOBJS+= $(VIDEOOBJ)/polylgcy.o
-endif
-
 #-------------------------------------------------
 #
 #@src/emu/video/psx.h,VIDEOS += PSX
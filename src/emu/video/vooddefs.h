@@ -1358,6 +1358,9 @@ static const UINT8 dither_matrix_2x2[16] =
 struct voodoo_state;
 struct poly_extra_data;
 
+/* rasterizers draw one scanline span of a triangle */
+typedef void (*voodoo_raster_func)(void *destbase, INT32 y, INT32 startx, INT32 stopx, const poly_extra_data *extra, int threadid);
+
 
 struct rgba
 {
@@ -1608,7 +1611,7 @@ struct dac_state
 struct raster_info
 {
 	raster_info *       next;                   /* pointer to next entry with the same hash */
-	poly_draw_scanline_func callback;           /* callback pointer */
+	voodoo_raster_func  callback;               /* callback pointer */
 	UINT8               is_generic;             /* TRUE if this is one of the generic rasterizers */
 	UINT8               display;                /* display index */
 	UINT32              hits;                   /* how many hits (pixels) we've used this for */
@@ -1626,6 +1629,8 @@ struct poly_extra_data
 {
 	voodoo_state *      state;                  /* pointer back to the voodoo state */
 	raster_info *       info;                   /* pointer to rasterizer information */
+	voodoo_raster_func  callback;               /* rasterizer to run on each span */
+	void *              destbase;               /* buffer being drawn into */
 
 	INT16               ax, ay;                 /* vertex A x,y (12.4) */
 	INT32               startr, startg, startb, starta; /* starting R,G,B,A (12.12) */
@@ -1658,6 +1663,20 @@ struct poly_extra_data
 };
 
 
+class voodoo_renderer : public poly_manager<float, poly_extra_data, 1, 64>
+{
+public:
+	voodoo_renderer(running_machine &machine)
+		: poly_manager<float, poly_extra_data, 1, 64>(machine) { }
+
+	/* hand each span to the rasterizer chosen for its polygon */
+	void render_span(INT32 y, const extent_t &extent, const poly_extra_data &extra, int threadid)
+	{
+		(*extra.callback)(extra.destbase, y, extent.startx, extent.stopx, &extra, threadid);
+	}
+};
+
+
 struct banshee_info
 {
 	UINT32              io[0x40];               /* I/O registers */
@@ -1714,7 +1733,7 @@ struct voodoo_state
 	tmu_shared_state    tmushare;               /* TMU shared state */
 	banshee_info        banshee;                /* Banshee state */
 
-	legacy_poly_manager * poly;                 /* polygon manager */
+	voodoo_renderer *   poly;                   /* polygon manager */
 	stats_block *       thread_stats;           /* per-thread statistics */
 
 	voodoo_stats        stats;                  /* internal statistics */
@@ -3541,14 +3560,11 @@ while (0)
 
 #define RASTERIZER(name, TMUS, FBZCOLORPATH, FBZMODE, ALPHAMODE, FOGMODE, TEXMODE0, TEXMODE1) \
 																				\
-static void raster_##name(void *destbase, INT32 y, const poly_extent *extent, const void *extradata, int threadid) \
+static void raster_##name(void *destbase, INT32 y, INT32 startx, INT32 stopx, const poly_extra_data *extra, int threadid) \
 {                                                                               \
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;          \
 	voodoo_state *v = extra->state;                                             \
 	stats_block *stats = &v->thread_stats[threadid];                            \
 	DECLARE_DITHER_POINTERS;                                                    \
-	INT32 startx = extent->startx;                                              \
-	INT32 stopx = extent->stopx;                                                \
 	INT32 iterr, iterg, iterb, itera;                                           \
 	INT32 iterz;                                                                \
 	INT64 iterw, iterw0 = 0, iterw1 = 0;                                        \
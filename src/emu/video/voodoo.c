@@ -145,7 +145,7 @@ bits(7:4) and bit(24)), X, and Y:
 #define EXPAND_RASTERIZERS
 
 #include "emu.h"
-#include "video/polylgcy.h"
+#include "video/poly.h"
 #include "video/rgbutil.h"
 #include "voodoo.h"
 #include "vooddefs.h"
@@ -164,7 +164,6 @@ bits(7:4) and bit(24)), X, and Y:
 #define LOG_FIFO            (0)
 #define LOG_FIFO_VERBOSE    (0)
 #define LOG_REGISTERS       (0)
-#define LOG_WAITS           (0)
 #define LOG_LFB             (0)
 #define LOG_TEXTURE_RAM     (0)
 #define LOG_RASTERIZERS     (0)
@@ -232,10 +231,8 @@ static raster_info *find_rasterizer(voodoo_state *v, int texcount);
 static void dump_rasterizer_stats(voodoo_state *v);
 
 /* generic rasterizers */
-static void raster_fastfill(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
-static void raster_generic_0tmu(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
-static void raster_generic_1tmu(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
-static void raster_generic_2tmu(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
+static void raster_fastfill(void *dest, INT32 scanline, INT32 startx, INT32 stopx, const poly_extra_data *extra, int threadid);
+static voodoo_raster_func generic_rasterizer(const raster_info *info, int texcount);
 
 
 
@@ -2461,21 +2458,21 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 
 		/* mask off invalid bits for different cards */
 		case fbzColorPath:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type < TYPE_VOODOO_2)
 				data &= 0x0fffffff;
 			if (chips & 1) v->reg[fbzColorPath].u = data;
 			break;
 
 		case fbzMode:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type < TYPE_VOODOO_2)
 				data &= 0x001fffff;
 			if (chips & 1) v->reg[fbzMode].u = data;
 			break;
 
 		case fogMode:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type < TYPE_VOODOO_2)
 				data &= 0x0000003f;
 			if (chips & 1) v->reg[fogMode].u = data;
@@ -2504,7 +2501,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 
 		/* other commands */
 		case nopCMD:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (data & 1)
 				reset_counters(v);
 			if (data & 2)
@@ -2516,12 +2513,12 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 			break;
 
 		case swapbufferCMD:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			cycles = swapbuffer(v, data);
 			break;
 
 		case userIntrCMD:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			//fatalerror("userIntrCMD\n");
 
 			v->reg[intrCtrl].u |= 0x1800;
@@ -2536,7 +2533,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case clutData:
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				if (!FBIINIT1_VIDEO_TIMING_RESET(v->reg[fbiInit1].u))
 				{
 					int index = data >> 24;
@@ -2555,7 +2552,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case dacData:
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				if (!(data & 0x800))
 					dacdata_w(&v->dac, (data >> 8) & 7, data & 0xff);
 				else
@@ -2570,7 +2567,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case videoDimensions:
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				v->reg[regnum].u = data;
 				if (v->reg[hSync].u != 0 && v->reg[vSync].u != 0 && v->reg[videoDimensions].u != 0)
 				{
@@ -2659,7 +2656,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 
 		/* fbiInit0 can only be written if initEnable says we can -- Voodoo/Voodoo2 only */
 		case fbiInit0:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(v->pci.init_enable))
 			{
 				v->reg[fbiInit0].u = data;
@@ -2683,7 +2680,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case fbiInit1:
 		case fbiInit2:
 		case fbiInit4:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(v->pci.init_enable))
 			{
 				v->reg[regnum].u = data;
@@ -2693,7 +2690,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 			break;
 
 		case fbiInit3:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(v->pci.init_enable))
 			{
 				v->reg[regnum].u = data;
@@ -2707,7 +2704,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 /*      case swapPending: -- Banshee */
 			if (v->type == TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(v->pci.init_enable))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				v->reg[regnum].u = data;
 				v->fbi.cmdfifo[0].enable = FBIINIT7_CMDFIFO_ENABLE(data);
 				v->fbi.cmdfifo[0].count_holes = !FBIINIT7_DISABLE_CMDFIFO_HOLES(data);
@@ -2720,7 +2717,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case cmdFifoBaseAddr:
 			if (v->type == TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				v->reg[regnum].u = data;
 				v->fbi.cmdfifo[0].base = (data & 0x3ff) << 12;
 				v->fbi.cmdfifo[0].end = (((data >> 16) & 0x3ff) + 1) << 12;
@@ -2796,7 +2793,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case nccTable+9:
 		case nccTable+10:
 		case nccTable+11:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (chips & 2) ncc_table_write(&v->tmu[0].ncc[0], regnum - nccTable, data);
 			if (chips & 4) ncc_table_write(&v->tmu[1].ncc[0], regnum - nccTable, data);
 			break;
@@ -2813,7 +2810,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case nccTable+21:
 		case nccTable+22:
 		case nccTable+23:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (chips & 2) ncc_table_write(&v->tmu[0].ncc[1], regnum - (nccTable+12), data);
 			if (chips & 4) ncc_table_write(&v->tmu[1].ncc[1], regnum - (nccTable+12), data);
 			break;
@@ -2851,7 +2848,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case fogTable+29:
 		case fogTable+30:
 		case fogTable+31:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (chips & 1)
 			{
 				int base = 2 * (regnum - fogTable);
@@ -2870,7 +2867,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case texBaseAddr_1:
 		case texBaseAddr_2:
 		case texBaseAddr_3_8:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (chips & 2)
 			{
 				v->tmu[0].reg[regnum].u = data;
@@ -2899,7 +2896,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case color0:
 		case clipLowYHighY:
 		case clipLeftRight:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			/* fall through to default implementation */
 
 		/* by default, just feed the data to the chips */
@@ -3163,7 +3160,7 @@ static INT32 lfb_w(voodoo_state *v, offs_t offset, UINT32 data, UINT32 mem_mask,
 	depthmax = (v->fbi.mask + 1 - v->fbi.auxoffs) / 2;
 
 	/* wait for any outstanding work to finish */
-	poly_wait(v->poly, "LFB Write");
+	v->poly->wait("LFB Write");
 
 	/* simple case: no pipeline */
 	if (!LFBMODE_ENABLE_PIXEL_PIPELINE(v->reg[lfbMode].u))
@@ -3318,7 +3315,7 @@ static INT32 texture_w(voodoo_state *v, offs_t offset, UINT32 data)
 		fatalerror("Texture direct write!\n");
 
 	/* wait for any outstanding work to finish */
-	poly_wait(v->poly, "Texture write");
+	v->poly->wait("Texture write");
 
 	/* update texture info if dirty */
 	if (t->regdirty)
@@ -3962,7 +3959,7 @@ static UINT32 lfb_r(voodoo_state *v, offs_t offset, int forcefront)
 		return 0xffffffff;
 
 	/* wait for any outstanding work to finish */
-	poly_wait(v->poly, "LFB read");
+	v->poly->wait("LFB read");
 
 	/* compute the data */
 	data = buffer[bufoffs + 0] | (buffer[bufoffs + 1] << 16);
@@ -4883,7 +4880,7 @@ void voodoo_device::common_start_voodoo(UINT8 type)
 	v->device->m_stall.resolve();
 
 	/* create a multiprocessor work queue */
-	v->poly = poly_alloc(machine(), 64, sizeof(poly_extra_data), 0);
+	v->poly = global_alloc(voodoo_renderer(machine()));
 	v->thread_stats = auto_alloc_array(machine(), stats_block, WORK_MAX_THREADS);
 
 	/* create a table of precomputed 1/n and log2(n) values */
@@ -5061,7 +5058,7 @@ static INT32 fastfill(voodoo_state *v)
 	int ex = (v->reg[clipLeftRight].u >> 0) & 0x3ff;
 	int sy = (v->reg[clipLowYHighY].u >> 16) & 0x3ff;
 	int ey = (v->reg[clipLowYHighY].u >> 0) & 0x3ff;
-	poly_extent extents[64];
+	voodoo_renderer::extent_t extents[64];
 	UINT16 dithermatrix[16];
 	UINT16 *drawbuf = NULL;
 	UINT32 pixels = 0;
@@ -5116,13 +5113,15 @@ static INT32 fastfill(voodoo_state *v)
 	/* iterate over blocks of extents */
 	for (y = sy; y < ey; y += ARRAY_LENGTH(extents))
 	{
-		poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(v->poly);
+		poly_extra_data *extra = &v->poly->object_data_alloc();
 		int count = MIN(ey - y, ARRAY_LENGTH(extents));
 
 		extra->state = v;
+		extra->callback = raster_fastfill;
+		extra->destbase = drawbuf;
 		memcpy(extra->dither, dithermatrix, sizeof(extra->dither));
 
-		pixels += poly_render_triangle_custom(v->poly, drawbuf, global_cliprect, raster_fastfill, y, count, extents);
+		pixels += v->poly->render_triangle_custom(global_cliprect, voodoo_renderer::render_delegate(FUNC(voodoo_renderer::render_span), v->poly), y, count, extents);
 	}
 
 	/* 2 pixels per clock */
@@ -5210,7 +5209,7 @@ static INT32 triangle(voodoo_state *v)
 	}
 
 	/* wait for any outstanding work to finish */
-//  poly_wait(v->poly, "triangle");
+//  v->poly->wait("triangle");
 
 	/* determine the draw buffer */
 	destbuf = (v->type >= TYPE_VOODOO_BANSHEE) ? 1 : FBZMODE_DRAW_BUFFER(v->reg[fbzMode].u);
@@ -5457,9 +5456,9 @@ static INT32 setup_and_draw_triangle(voodoo_state *v)
 
 static INT32 triangle_create_work_item(voodoo_state *v, UINT16 *drawbuf, int texcount)
 {
-	poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(v->poly);
+	poly_extra_data *extra = &v->poly->object_data_alloc();
 	raster_info *info = find_rasterizer(v, texcount);
-	poly_vertex vert[3];
+	voodoo_renderer::vertex_t vert[3];
 
 	/* fill in the vertex data */
 	vert[0].x = (float)v->fbi.ax * (1.0f / 16.0f);
@@ -5529,7 +5528,9 @@ static INT32 triangle_create_work_item(voodoo_state *v, UINT16 *drawbuf, int tex
 
 	/* farm the rasterization out to other threads */
 	info->polys++;
-	return poly_render_triangle(v->poly, drawbuf, global_cliprect, info->callback, 0, &vert[0], &vert[1], &vert[2]);
+	extra->callback = info->callback;
+	extra->destbase = drawbuf;
+	return v->poly->render_triangle(global_cliprect, voodoo_renderer::render_delegate(FUNC(voodoo_renderer::render_span), v->poly), 0, vert[0], vert[1], vert[2]);
 }
 
 
@@ -5616,7 +5617,7 @@ static raster_info *find_rasterizer(voodoo_state *v, int texcount)
 		}
 
 	/* generate a new one using the generic entry */
-	curinfo.callback = (texcount == 0) ? raster_generic_0tmu : (texcount == 1) ? raster_generic_1tmu : raster_generic_2tmu;
+	curinfo.callback = generic_rasterizer(&curinfo, texcount);
 	curinfo.is_generic = TRUE;
 	curinfo.display = 0;
 	curinfo.polys = 0;
@@ -5636,6 +5637,8 @@ static void dump_rasterizer_stats(voodoo_state *v)
 {
 	static UINT8 display_index;
 	raster_info *cur, *best;
+	UINT32 special_polys = 0, special_hits = 0;
+	UINT32 generic_polys = 0, generic_hits = 0;
 	int hash;
 
 	printf("----\n");
@@ -5668,9 +5671,23 @@ static void dump_rasterizer_stats(voodoo_state *v)
 			best->polys,
 			best->hits);
 
+		/* tally the specialized and generic totals */
+		if (best->is_generic)
+		{
+			generic_polys += best->polys;
+			generic_hits += best->hits;
+		}
+		else
+		{
+			special_polys += best->polys;
+			special_hits += best->hits;
+		}
+
 		/* reset */
 		best->display = display_index;
 	}
+
+	printf("specialized: %d polys, %d hits / generic: %d polys, %d hits\n", special_polys, special_hits, generic_polys, generic_hits);
 }
 
 voodoo_device::voodoo_device(const machine_config &mconfig, device_type type, const char *name, const char *tag, device_t *owner, UINT32 clock, const char *shortname, const char *source)
@@ -5720,8 +5737,7 @@ void voodoo_device::device_stop()
 	voodoo_state *v = get_safe_token(this);
 
 	/* release the work queue, ensuring all work is finished */
-	if (v->poly != NULL)
-		poly_free(v->poly);
+	global_free(v->poly);
 }
 
 
@@ -5808,13 +5824,10 @@ void voodoo_3_device::device_start()
     implementation of the 'fastfill' command
 -------------------------------------------------*/
 
-static void raster_fastfill(void *destbase, INT32 y, const poly_extent *extent, const void *extradata, int threadid)
+static void raster_fastfill(void *destbase, INT32 y, INT32 startx, INT32 stopx, const poly_extra_data *extra, int threadid)
 {
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;
 	voodoo_state *v = extra->state;
 	stats_block *stats = &v->thread_stats[threadid];
-	INT32 startx = extent->startx;
-	INT32 stopx = extent->stopx;
 	int scry, x;
 
 	/* determine the screen Y */
@@ -5856,27 +5869,60 @@ static void raster_fastfill(void *destbase, INT32 y, const poly_extent *extent,
 
 
 /*-------------------------------------------------
-    generic_0tmu - generic rasterizer for 0 TMUs
+    generic rasterizers - one per TMU count for
+    each combination of the depth buffer, alpha
+    test, alpha blend and fog enables; fixing
+    those bits lets the compiler drop the stages
+    that are switched off, while everything else
+    is still read from the registers
 -------------------------------------------------*/
 
-RASTERIZER(generic_0tmu, 0, v->reg[fbzColorPath].u, v->reg[fbzMode].u, v->reg[alphaMode].u,
-			v->reg[fogMode].u, 0, 0)
+#define GENERIC_FBZMODE(index)      ((v->reg[fbzMode].u & ~(1 << 4)) | (((index) & 1) << 4))
+#define GENERIC_ALPHAMODE(index)    ((v->reg[alphaMode].u & ~((1 << 0) | (1 << 4))) | ((((index) >> 1) & 1) << 0) | ((((index) >> 2) & 1) << 4))
+#define GENERIC_FOGMODE(index)      ((v->reg[fogMode].u & ~(1 << 0)) | (((index) >> 3) & 1))
 
+#define GENERIC_RASTERIZER(tmus, index) \
+	RASTERIZER(generic_##tmus##tmu_##index, tmus, v->reg[fbzColorPath].u, GENERIC_FBZMODE(index), GENERIC_ALPHAMODE(index), \
+			GENERIC_FOGMODE(index), (tmus >= 1) ? v->tmu[0].reg[textureMode].u : 0, (tmus >= 2) ? v->tmu[1].reg[textureMode].u : 0)
 
-/*-------------------------------------------------
-    generic_1tmu - generic rasterizer for 1 TMU
--------------------------------------------------*/
+#define GENERIC_RASTERIZERS(tmus) \
+	GENERIC_RASTERIZER(tmus, 0)  GENERIC_RASTERIZER(tmus, 1)  GENERIC_RASTERIZER(tmus, 2)  GENERIC_RASTERIZER(tmus, 3) \
+	GENERIC_RASTERIZER(tmus, 4)  GENERIC_RASTERIZER(tmus, 5)  GENERIC_RASTERIZER(tmus, 6)  GENERIC_RASTERIZER(tmus, 7) \
+	GENERIC_RASTERIZER(tmus, 8)  GENERIC_RASTERIZER(tmus, 9)  GENERIC_RASTERIZER(tmus, 10) GENERIC_RASTERIZER(tmus, 11) \
+	GENERIC_RASTERIZER(tmus, 12) GENERIC_RASTERIZER(tmus, 13) GENERIC_RASTERIZER(tmus, 14) GENERIC_RASTERIZER(tmus, 15)
+
+GENERIC_RASTERIZERS(0)
+GENERIC_RASTERIZERS(1)
+GENERIC_RASTERIZERS(2)
 
-RASTERIZER(generic_1tmu, 1, v->reg[fbzColorPath].u, v->reg[fbzMode].u, v->reg[alphaMode].u,
-			v->reg[fogMode].u, v->tmu[0].reg[textureMode].u, 0)
+#define GENERIC_RASTERIZER_LIST(tmus) \
+	{ raster_generic_##tmus##tmu_0,  raster_generic_##tmus##tmu_1,  raster_generic_##tmus##tmu_2,  raster_generic_##tmus##tmu_3, \
+		raster_generic_##tmus##tmu_4,  raster_generic_##tmus##tmu_5,  raster_generic_##tmus##tmu_6,  raster_generic_##tmus##tmu_7, \
+		raster_generic_##tmus##tmu_8,  raster_generic_##tmus##tmu_9,  raster_generic_##tmus##tmu_10, raster_generic_##tmus##tmu_11, \
+		raster_generic_##tmus##tmu_12, raster_generic_##tmus##tmu_13, raster_generic_##tmus##tmu_14, raster_generic_##tmus##tmu_15 }
+
+static const voodoo_raster_func generic_raster_table[3][16] =
+{
+	GENERIC_RASTERIZER_LIST(0),
+	GENERIC_RASTERIZER_LIST(1),
+	GENERIC_RASTERIZER_LIST(2)
+};
 
 
 /*-------------------------------------------------
-    generic_2tmu - generic rasterizer for 2 TMUs
+    generic_rasterizer - pick the generic
+    rasterizer whose fixed enables match the
+    given parameters
 -------------------------------------------------*/
 
-RASTERIZER(generic_2tmu, 2, v->reg[fbzColorPath].u, v->reg[fbzMode].u, v->reg[alphaMode].u,
-			v->reg[fogMode].u, v->tmu[0].reg[textureMode].u, v->tmu[1].reg[textureMode].u)
+static voodoo_raster_func generic_rasterizer(const raster_info *info, int texcount)
+{
+	int index = (FBZMODE_ENABLE_DEPTHBUF(info->eff_fbz_mode) << 0) |
+				(ALPHAMODE_ALPHATEST(info->eff_alpha_mode) << 1) |
+				(ALPHAMODE_ALPHABLEND(info->eff_alpha_mode) << 2) |
+				(FOGMODE_ENABLE_FOG(info->eff_fog_mode) << 3);
+	return generic_raster_table[texcount][index];
+}
 
 
 #else
@@ -1232,7 +1232,7 @@ Notes:
 
 #include "emu.h"
 #include <float.h>
-#include "video/polylgcy.h"
+#include "video/poly.h"
 #include "cpu/mips/mips3.h"
 #include "cpu/h8/h83002.h"
 #include "cpu/h8/h83337.h"
@@ -1277,13 +1277,27 @@ struct namcos23_render_entry
 	};
 };
 
+enum { RENDER_MAX_ENTRIES = 1000, POLY_MAX_ENTRIES = 10000 };
+
 struct namcos23_render_data
 {
 	running_machine *machine;
+	bitmap_rgb32 *bitmap;
 	const pen_t *pens;
 	UINT32 (*texture_lookup)(running_machine &machine, const pen_t *pens, float x, float y);
 };
 
+class namcos23_renderer : public poly_manager<float, namcos23_render_data, 4, POLY_MAX_ENTRIES>
+{
+public:
+	namcos23_renderer(running_machine &machine)
+		: poly_manager<float, namcos23_render_data, 4, POLY_MAX_ENTRIES>(machine) { }
+
+	void render_scanline(INT32 scanline, const extent_t &extent, const namcos23_render_data &rd, int threadid);
+};
+
+typedef namcos23_renderer::vertex_t poly_vertex;
+
 struct namcos23_poly_entry
 {
 	namcos23_render_data rd;
@@ -1293,8 +1307,6 @@ struct namcos23_poly_entry
 	poly_vertex pv[16];
 };
 
-enum { RENDER_MAX_ENTRIES = 1000, POLY_MAX_ENTRIES = 10000 };
-
 
 struct c417_t
 {
@@ -1341,7 +1353,7 @@ struct c404_t
 
 struct render_t
 {
-	legacy_poly_manager *polymgr;
+	namcos23_renderer *polymgr;
 	int cur;
 	int poly_count;
 	int count[2];
@@ -1868,25 +1880,22 @@ WRITE32_MEMBER(namcos23_state::c435_w)
 
 
 
-static void render_scanline(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid)
+void namcos23_renderer::render_scanline(INT32 scanline, const extent_t &extent, const namcos23_render_data &rd, int threadid)
 {
-	const namcos23_render_data *rd = (const namcos23_render_data *)extradata;
-
-	float w = extent->param[0].start;
-	float u = extent->param[1].start;
-	float v = extent->param[2].start;
-	float l = extent->param[3].start;
-	float dw = extent->param[0].dpdx;
-	float du = extent->param[1].dpdx;
-	float dv = extent->param[2].dpdx;
-	float dl = extent->param[3].dpdx;
-	bitmap_rgb32 *bitmap = (bitmap_rgb32 *)dest;
-	UINT32 *img = &bitmap->pix32(scanline, extent->startx);
-
-	for(int x = extent->startx; x < extent->stopx; x++)
+	float w = extent.param[0].start;
+	float u = extent.param[1].start;
+	float v = extent.param[2].start;
+	float l = extent.param[3].start;
+	float dw = extent.param[0].dpdx;
+	float du = extent.param[1].dpdx;
+	float dv = extent.param[2].dpdx;
+	float dl = extent.param[3].dpdx;
+	UINT32 *img = &rd.bitmap->pix32(scanline, extent.startx);
+
+	for(int x = extent.startx; x < extent.stopx; x++)
 	{
 		float z = w ? 1/w : 0;
-		UINT32 pcol = rd->texture_lookup(*rd->machine, rd->pens, u*z, v*z);
+		UINT32 pcol = rd.texture_lookup(*rd.machine, rd.pens, u*z, v*z);
 		float ll = l*z;
 		*img = (light(pcol >> 16, ll) << 16) | (light(pcol >> 8, ll) << 8) | light(pcol, ll);
 
@@ -2031,7 +2040,7 @@ void namcos23_state::render_one_model(const namcos23_render_entry *re)
 
 		namcos23_poly_entry *p = render.polys + render.poly_count;
 
-		p->vertex_count = poly_zclip_if_less(ne, pv, p->pv, 4, 0.001f);
+		p->vertex_count = render.polymgr->zclip_if_less(ne, pv, p->pv, 4, 0.001f);
 
 		if(p->vertex_count >= 3)
 		{
@@ -2080,13 +2089,15 @@ void namcos23_state::render_flush(bitmap_rgb32 &bitmap)
 	qsort(render.poly_order, render.poly_count, sizeof(namcos23_poly_entry *), render_poly_compare);
 
 	const static rectangle scissor(0, 639, 0, 479);
+	namcos23_renderer::render_delegate callback(FUNC(namcos23_renderer::render_scanline), render.polymgr);
 
 	for(int i=0; i<render.poly_count; i++)
 	{
 		const namcos23_poly_entry *p = render.poly_order[i];
-		namcos23_render_data *rd = (namcos23_render_data *)poly_get_extra_data(render.polymgr);
-		*rd = p->rd;
-		poly_render_triangle_fan(render.polymgr, &bitmap, scissor, render_scanline, 4, p->vertex_count, p->pv);
+		namcos23_render_data &rd = render.polymgr->object_data_alloc();
+		rd = p->rd;
+		rd.bitmap = &bitmap;
+		render.polymgr->render_triangle_fan(scissor, callback, 4, p->vertex_count, p->pv);
 	}
 	render.poly_count = 0;
 }
@@ -2112,7 +2123,7 @@ void namcos23_state::render_run(bitmap_rgb32 &bitmap)
 	}
 	render_flush(bitmap);
 
-	poly_wait(render.polymgr, "render_run");
+	render.polymgr->wait("render_run");
 }
 
 
@@ -2185,7 +2196,7 @@ VIDEO_START_MEMBER(namcos23_state,s23)
 	m_bgtilemap = &machine().tilemap().create(m_gfxdecode, tilemap_get_info_delegate(FUNC(namcos23_state::TextTilemapGetInfo),this), TILEMAP_SCAN_ROWS, 16, 16, 64, 64);
 	m_bgtilemap->set_transparent_pen(0xf);
 	m_bgtilemap->set_scrolldx(860, 860);
-	m_render.polymgr = poly_alloc(machine(), 10000, sizeof(namcos23_render_data), 0);
+	m_render.polymgr = auto_alloc(machine(), namcos23_renderer(machine()));
 }
 
 
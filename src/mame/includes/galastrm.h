@@ -1,8 +1,9 @@
 #include "machine/eepromser.h"
-#include "video/polylgcy.h"
 #include "video/tc0100scn.h"
 #include "video/tc0480scp.h"
 
+class galastrm_renderer;
+
 struct tempsprite
 {
 	int gfx;
@@ -55,7 +56,7 @@ public:
 	struct tempsprite *m_sprite_ptr_pre;
 	bitmap_ind16 m_tmpbitmaps;
 	bitmap_ind16 m_polybitmap;
-	legacy_poly_manager *m_poly;
+	galastrm_renderer *m_poly;
 	int m_rsxb;
 	int m_rsyb;
 	int m_rsxoffs;
@@ -72,7 +73,6 @@ public:
 	virtual void video_start();
 	UINT32 screen_update_galastrm(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect);
 	INTERRUPT_GEN_MEMBER(galastrm_interrupt);
-	void galastrm_exit();
 	void draw_sprites_pre(int x_offs, int y_offs);
 	void draw_sprites(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect, const int *primasks, int priority);
 	void tc0610_rotate_draw(bitmap_ind16 &bitmap, bitmap_ind16 &srcbitmap, const rectangle &clip);
@@ -1,4 +1,3 @@
-#include "video/polylgcy.h"
 #include "audio/dsbz80.h"
 #include "audio/segam1audio.h"
 #include "machine/eepromser.h"
@@ -9,6 +8,7 @@
 
 struct raster_state;
 struct geo_state;
+class model2_renderer;
 
 
 class model2_state : public driver_device
@@ -105,7 +105,7 @@ public:
 	int m_jnet_time_out;
 	UINT32 m_geo_read_start_address;
 	UINT32 m_geo_write_start_address;
-	legacy_poly_manager *m_poly;
+	model2_renderer *m_poly;
 	raster_state *m_raster;
 	geo_state *m_geo;
 	bitmap_rgb32 m_sys24_bitmap;
@@ -217,7 +217,6 @@ public:
 	TIMER_DEVICE_CALLBACK_MEMBER(model2_timer_cb);
 	TIMER_DEVICE_CALLBACK_MEMBER(model2_interrupt);
 	TIMER_DEVICE_CALLBACK_MEMBER(model2c_interrupt);
-	void model2_exit();
 	DECLARE_WRITE8_MEMBER(scsp_irq);
 	DECLARE_READ_LINE_MEMBER(copro_tgp_fifoin_pop_ok);
 	DECLARE_READ32_MEMBER(copro_tgp_fifoin_pop);
@@ -30,6 +30,7 @@ public:
 	optional_shared_ptr<UINT32> m_bootleg_spritebuffer;
 	UINT32 *       m_spritebuf1;
 	UINT32 *       m_spritebuf2;
+	gfx_sprite_list *m_sprite_list;
 //      UINT32 *       m_paletteram;  // currently this uses generic palette handling
 
 	/* video-related */
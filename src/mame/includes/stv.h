@@ -82,6 +82,8 @@ public:
 	attotime  m_minit_boost_timeslice;
 	attotime  m_sinit_boost_timeslice;
 
+	struct stv_vdp1_command;
+
 	struct {
 		UINT16    **framebuffer_display_lines;
 		int       framebuffer_mode;
@@ -103,6 +105,15 @@ public:
 
 		int       local_x;
 		int       local_y;
+
+		/* deferred list drawing */
+		osd_work_queue *work_queue;
+		osd_work_item *draw_item;
+		dynamic_array<struct stv_vdp1_command> commands[2];
+		int       commands_filling;
+		int       commands_drawing;
+		int       draw_local_x;
+		int       draw_local_y;
 	}m_vdp1;
 
 	struct {
@@ -234,6 +245,13 @@ public:
 	void stv_vdp1_change_framebuffers( void );
 	void video_update_vdp1( void );
 	void stv_vdp1_process_list( void );
+	void stv_vdp1_begin_list( void );
+	void stv_vdp1_queue_command( struct stv_vdp1_command &cmd, const rectangle &cliprect );
+	void stv_vdp1_end_list( void );
+	void stv_vdp1_draw_command( const struct stv_vdp1_command &cmd );
+	static void *stv_vdp1_draw_list_callback( void *param, int threadid );
+	void stv_vdp1_sync( void );
+	void stv_vdp1_exit( void );
 	void stv_vdp1_set_drawpixel( void );
 
 	void stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sprite_type);
@@ -305,6 +323,15 @@ public:
 
 	} stv2_current_sprite;
 
+	/* a drawing command recorded for deferred drawing */
+	struct stv_vdp1_command
+	{
+		struct stv_vdp2_sprite_list sprite;
+		rectangle cliprect;
+		int local_x;
+		int local_y;
+	};
+
 	/* Gouraud shading */
 
 	struct _stv_gouraud_shading
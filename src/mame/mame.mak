@@ -322,7 +322,6 @@ VIDEOS += MC6845
 #VIDEOS += MSM6255
 #VIDEOS += MOS6566
 VIDEOS += PC_VGA
-VIDEOS += POLY
 VIDEOS += PSX
 VIDEOS += RAMDAC
 #VIDEOS += S2636
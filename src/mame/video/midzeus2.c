@@ -9,7 +9,7 @@
 #include "emu.h"
 #include "cpu/tms32031/tms32031.h"
 #include "includes/midzeus.h"
-#include "video/polylgcy.h"
+#include "video/poly.h"
 #include "video/rgbutil.h"
 
 
@@ -37,7 +37,7 @@
  *
  *************************************/
 
-struct poly_extra_data
+struct mz2_poly_extra_data
 {
 	const void *    palbase;
 	const void *    texbase;
@@ -50,6 +50,16 @@ struct poly_extra_data
 };
 
 
+class midzeus2_renderer : public poly_manager<float, mz2_poly_extra_data, 4, 10000>
+{
+public:
+	midzeus2_renderer(running_machine &machine)
+		: poly_manager<float, mz2_poly_extra_data, 4, 10000>(machine) { }
+
+	void render_poly_8bit(INT32 scanline, const extent_t &extent, const mz2_poly_extra_data &extra, int threadid);
+};
+
+
 
 /*************************************
  *
@@ -57,7 +67,7 @@ struct poly_extra_data
  *
  *************************************/
 
-static legacy_poly_manager *poly;
+static midzeus2_renderer *poly;
 static UINT8 log_fifo;
 
 static UINT32 zeus_fifo[20];
@@ -97,14 +107,6 @@ static int subregwrite_count[0x100];
 
 
 
-/*************************************
- *
- *  Function prototypes
- *
- *************************************/
-
-static void render_poly_8bit(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
-
 /*************************************
  *
  *  Macros
@@ -258,7 +260,7 @@ VIDEO_START_MEMBER(midzeus2_state,midzeus2)
 	waveram[1] = auto_alloc_array(machine(), UINT32, WAVERAM1_WIDTH * WAVERAM1_HEIGHT * 12/4);
 
 	/* initialize polygon engine */
-	poly = poly_alloc(machine(), 10000, sizeof(poly_extra_data), POLYFLAG_ALLOW_QUADS);
+	poly = auto_alloc(machine(), midzeus2_renderer(machine()));
 
 	/* we need to cleanup on exit */
 	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(midzeus2_state::exit_handler2), this));
@@ -334,8 +336,6 @@ void midzeus2_state::exit_handler2()
 		}
 }
 #endif
-
-	poly_free(poly);
 }
 
 
@@ -350,7 +350,7 @@ UINT32 midzeus2_state::screen_update_midzeus2(screen_device &screen, bitmap_rgb3
 {
 	int x, y;
 
-	poly_wait(poly, "VIDEO_UPDATE");
+	poly->wait("VIDEO_UPDATE");
 
 if (machine().input().code_pressed(KEYCODE_UP)) { zbase += 1.0f; popmessage("Zbase = %f", zbase); }
 if (machine().input().code_pressed(KEYCODE_DOWN)) { zbase -= 1.0f; popmessage("Zbase = %f", zbase); }
@@ -1026,10 +1026,10 @@ void midzeus2_state::zeus2_draw_model(UINT32 baseaddr, UINT16 count, int logit)
 
 void midzeus2_state::zeus2_draw_quad(const UINT32 *databuffer, UINT32 texoffs, int logit)
 {
-	poly_draw_scanline_func callback;
-	poly_extra_data *extra;
-	poly_vertex clipvert[8];
-	poly_vertex vert[4];
+	midzeus2_renderer::render_delegate callback;
+	mz2_poly_extra_data *extra;
+	midzeus2_renderer::vertex_t clipvert[8];
+	midzeus2_renderer::vertex_t vert[4];
 //  float uscale, vscale;
 	float maxy, maxx;
 //  int val1, val2, texwshift;
@@ -1052,7 +1052,7 @@ if (machine().input().code_pressed(KEYCODE_Y) && (texoffs & 0xffff) == 0x0dd) re
 //if (machine().input().code_pressed(KEYCODE_O) && (texoffs & 0xffff) == 0x119) return;
 //if (machine().input().code_pressed(KEYCODE_L) && (texoffs & 0x100)) return;
 
-	callback = render_poly_8bit;
+	callback = midzeus2_renderer::render_delegate(FUNC(midzeus2_renderer::render_poly_8bit), poly);
 
 /*
 0   38800000
@@ -1167,7 +1167,7 @@ In memory:
 		}
 	}
 
-	numverts = poly_zclip_if_less(4, &vert[0], &clipvert[0], 4, 1.0f / 512.0f / 4.0f);
+	numverts = poly->zclip_if_less(4, &vert[0], &clipvert[0], 4, 1.0f / 512.0f / 4.0f);
 	if (numverts < 3)
 		return;
 
@@ -1198,7 +1198,7 @@ In memory:
 			clipvert[i].y += 0.0005f;
 	}
 
-	extra = (poly_extra_data *)poly_get_extra_data(poly);
+	extra = &poly->object_data_alloc();
 	switch (texmode)
 	{
 		case 0x01d:     /* crusnexo: RHS of score bar */
@@ -1244,7 +1244,7 @@ In memory:
 	extra->texbase = WAVERAM_BLOCK0(zeus_texbase);
 	extra->palbase = waveram0_ptr_from_expanded_addr(m_zeusbase[0x41]);
 
-	poly_render_quad_fan(poly, NULL, zeus_cliprect, callback, 4, numverts, &clipvert[0]);
+	poly->render_quad_fan(zeus_cliprect, callback, 4, numverts, &clipvert[0]);
 }
 
 
@@ -1255,27 +1255,26 @@ In memory:
  *
  *************************************/
 
-static void render_poly_8bit(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid)
+void midzeus2_renderer::render_poly_8bit(INT32 scanline, const extent_t &extent, const mz2_poly_extra_data &extra, int threadid)
 {
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;
-	INT32 curz = extent->param[0].start;
-	INT32 curu = extent->param[1].start;
-	INT32 curv = extent->param[2].start;
-//  INT32 curi = extent->param[3].start;
-	INT32 dzdx = extent->param[0].dpdx;
-	INT32 dudx = extent->param[1].dpdx;
-	INT32 dvdx = extent->param[2].dpdx;
-//  INT32 didx = extent->param[3].dpdx;
-	const void *texbase = extra->texbase;
-	const void *palbase = extra->palbase;
-	UINT16 transcolor = extra->transcolor;
-	int texwidth = extra->texwidth;
+	INT32 curz = extent.param[0].start;
+	INT32 curu = extent.param[1].start;
+	INT32 curv = extent.param[2].start;
+//  INT32 curi = extent.param[3].start;
+	INT32 dzdx = extent.param[0].dpdx;
+	INT32 dudx = extent.param[1].dpdx;
+	INT32 dvdx = extent.param[2].dpdx;
+//  INT32 didx = extent.param[3].dpdx;
+	const void *texbase = extra.texbase;
+	const void *palbase = extra.palbase;
+	UINT16 transcolor = extra.transcolor;
+	int texwidth = extra.texwidth;
 	int x;
 
-	for (x = extent->startx; x < extent->stopx; x++)
+	for (x = extent.startx; x < extent.stopx; x++)
 	{
 		UINT16 *depthptr = WAVERAM_PTRDEPTH(zeus_renderbase, scanline, x);
-		INT32 depth = (curz >> 16) + extra->zoffset;
+		INT32 depth = (curz >> 16) + extra.zoffset;
 		if (depth > 0x7fff) depth = 0x7fff;
 		if (depth >= 0 && depth <= *depthptr)
 		{
@@ -87,11 +87,13 @@
 *********************************************************************************************************************************/
 #include "emu.h"
 #include "video/segaic24.h"
-#include "video/polylgcy.h"
+#include "video/poly.h"
 #include "includes/model2.h"
 
 #define MODEL2_VIDEO_DEBUG 0
 
+#define TRI_BATCH_SIZE      64
+
 
 #define pz      p[0]
 #define pu      p[1]
@@ -104,6 +106,70 @@
  *
  *******************************************/
 
+struct m2_poly_extra_data
+{
+	model2_state *  state;
+	bitmap_rgb32 *  destmap;
+	UINT32      lumabase;
+	UINT32      colorbase;
+	UINT32 *    texsheet;
+	UINT32      texwidth;
+	UINT32      texheight;
+	UINT32      texx, texy;
+	UINT8       texmirrorx;
+	UINT8       texmirrory;
+};
+
+class model2_renderer : public poly_manager<float, m2_poly_extra_data, 3, 4000>
+{
+public:
+	/* the frame is drawn in one go at the end, so bin it per band and set it up on the workers */
+	model2_renderer(model2_state &state)
+		: poly_manager<float, m2_poly_extra_data, 3, 4000>(state.machine(), POLYFLAG_DEFERRED_SETUP | POLYFLAG_TILE_BINNING),
+			m_batch_render(0),
+			m_batch_params(0),
+			m_batch_count(0)
+	{
+		m_render[0] = render_delegate(FUNC(model2_renderer::model2_3d_render_0), this);
+		m_render[1] = render_delegate(FUNC(model2_renderer::model2_3d_render_1), this);
+		m_render[2] = render_delegate(FUNC(model2_renderer::model2_3d_render_2), this);
+		m_render[3] = render_delegate(FUNC(model2_renderer::model2_3d_render_3), this);
+		m_render[4] = render_delegate(FUNC(model2_renderer::model2_3d_render_4), this);
+		m_render[5] = render_delegate(FUNC(model2_renderer::model2_3d_render_5), this);
+		m_render[6] = render_delegate(FUNC(model2_renderer::model2_3d_render_6), this);
+		m_render[7] = render_delegate(FUNC(model2_renderer::model2_3d_render_7), this);
+	}
+
+	/* scanline renderer for a given combination of checker/textured/translucent bits */
+	const render_delegate &renderer(int index) const { return m_render[index]; }
+
+	/* queue a triangle, returning its vertices and object data for the caller to fill in */
+	m2_poly_extra_data &batch_triangle(int render, int paramcount, const rectangle &cliprect, vertex_t *&v);
+	void flush_triangles();
+
+	void model2_3d_render_0(INT32 scanline, const extent_t &extent, const m2_poly_extra_data &extra, int threadid);
+	void model2_3d_render_1(INT32 scanline, const extent_t &extent, const m2_poly_extra_data &extra, int threadid);
+	void model2_3d_render_2(INT32 scanline, const extent_t &extent, const m2_poly_extra_data &extra, int threadid);
+	void model2_3d_render_3(INT32 scanline, const extent_t &extent, const m2_poly_extra_data &extra, int threadid);
+	void model2_3d_render_4(INT32 scanline, const extent_t &extent, const m2_poly_extra_data &extra, int threadid);
+	void model2_3d_render_5(INT32 scanline, const extent_t &extent, const m2_poly_extra_data &extra, int threadid);
+	void model2_3d_render_6(INT32 scanline, const extent_t &extent, const m2_poly_extra_data &extra, int threadid);
+	void model2_3d_render_7(INT32 scanline, const extent_t &extent, const m2_poly_extra_data &extra, int threadid);
+
+private:
+	render_delegate m_render[8];
+
+	/* run of triangles that share one scanline renderer and viewport */
+	int m_batch_render;
+	int m_batch_params;
+	rectangle m_batch_clip;
+	int m_batch_count;
+	vertex_t m_batch_vert[TRI_BATCH_SIZE * 3];
+	m2_poly_extra_data m_batch_data[TRI_BATCH_SIZE];
+};
+
+typedef model2_renderer::vertex_t poly_vertex;
+
 struct plane
 {
 	poly_vertex normal;
@@ -137,20 +203,6 @@ struct quad_m2
 	UINT8               luma;
 };
 
-struct poly_extra_data
-{
-	model2_state *  state;
-	UINT32      lumabase;
-	UINT32      colorbase;
-	UINT32 *    texsheet;
-	UINT32      texwidth;
-	UINT32      texheight;
-	UINT32      texx, texy;
-	UINT8       texmirrorx;
-	UINT8       texmirrory;
-};
-
-
 /*******************************************
  *
  *  Generic 3D Math Functions
@@ -910,22 +962,30 @@ INLINE UINT16 get_texel( UINT32 base_x, UINT32 base_y, int x, int y, UINT32 *she
 
 /***********************************************************************************************/
 
-static const poly_draw_scanline_func render_funcs[8] =
+void model2_renderer::flush_triangles()
 {
-	model2_3d_render_0, /* checker = 0, textured = 0, translucent = 0 */
-	model2_3d_render_1, /* checker = 0, textured = 0, translucent = 1 */
-	model2_3d_render_2, /* checker = 0, textured = 1, translucent = 0 */
-	model2_3d_render_3, /* checker = 0, textured = 1, translucent = 1 */
-	model2_3d_render_4, /* checker = 1, textured = 0, translucent = 0 */
-	model2_3d_render_5, /* checker = 1, textured = 0, translucent = 1 */
-	model2_3d_render_6, /* checker = 1, textured = 1, translucent = 0 */
-	model2_3d_render_7  /* checker = 1, textured = 1, translucent = 1 */
-};
+	if (m_batch_count > 0)
+		render_triangle_batch(m_batch_clip, m_render[m_batch_render], m_batch_params, m_batch_count, m_batch_vert, m_batch_data);
+	m_batch_count = 0;
+}
+
+m2_poly_extra_data &model2_renderer::batch_triangle(int render, int paramcount, const rectangle &cliprect, vertex_t *&v)
+{
+	/* submit the current run when it is full or the renderer or viewport changes */
+	if (m_batch_count > 0 && (m_batch_count == TRI_BATCH_SIZE || m_batch_render != render || m_batch_params != paramcount || m_batch_clip != cliprect))
+		flush_triangles();
+
+	m_batch_render = render;
+	m_batch_params = paramcount;
+	m_batch_clip = cliprect;
+	v = &m_batch_vert[m_batch_count * 3];
+	return m_batch_data[m_batch_count++];
+}
 
 static void model2_3d_render( model2_state *state, bitmap_rgb32 &bitmap, triangle *tri, const rectangle &cliprect )
 {
-	legacy_poly_manager *poly = state->m_poly;
-	poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(poly);
+	model2_renderer *poly = state->m_poly;
+	poly_vertex *v;
 	UINT8       renderer;
 
 	/* select renderer based on attributes (bit15 = checker, bit14 = textured, bit13 = transparent */
@@ -935,7 +995,13 @@ static void model2_3d_render( model2_state *state, bitmap_rgb32 &bitmap, triangl
 	rectangle vp(tri->viewport[0] - 8, tri->viewport[2] - 8, (384-tri->viewport[3])+90, (384-tri->viewport[1])+90);
 	vp &= cliprect;
 
+	m2_poly_extra_data *extra = &poly->batch_triangle(renderer, (renderer & 2) ? 3 : 0, vp, v);
+	v[0] = tri->v[0];
+	v[1] = tri->v[1];
+	v[2] = tri->v[2];
+
 	extra->state = state;
+	extra->destmap = &bitmap;
 	extra->lumabase = ((tri->texheader[1] & 0xFF) << 7) + ((tri->luma >> 5) ^ 0x7);
 	extra->colorbase = (tri->texheader[3] >> 6) & 0x3FF;
 
@@ -950,20 +1016,16 @@ static void model2_3d_render( model2_state *state, bitmap_rgb32 &bitmap, triangl
 		extra->texmirrory = 0;//(tri->texheader[0] >> 8) & 1;
 		extra->texsheet = (tri->texheader[2] & 0x1000) ? state->m_textureram1 : state->m_textureram0;
 
-		tri->v[0].pz = 1.0f / (1.0f + tri->v[0].pz);
-		tri->v[0].pu = tri->v[0].pu * tri->v[0].pz * (1.0f / 8.0f);
-		tri->v[0].pv = tri->v[0].pv * tri->v[0].pz * (1.0f / 8.0f);
-		tri->v[1].pz = 1.0f / (1.0f + tri->v[1].pz);
-		tri->v[1].pu = tri->v[1].pu * tri->v[1].pz * (1.0f / 8.0f);
-		tri->v[1].pv = tri->v[1].pv * tri->v[1].pz * (1.0f / 8.0f);
-		tri->v[2].pz = 1.0f / (1.0f + tri->v[2].pz);
-		tri->v[2].pu = tri->v[2].pu * tri->v[2].pz * (1.0f / 8.0f);
-		tri->v[2].pv = tri->v[2].pv * tri->v[2].pz * (1.0f / 8.0f);
-
-		poly_render_triangle(poly, &bitmap, vp, render_funcs[renderer], 3, &tri->v[0], &tri->v[1], &tri->v[2]);
+		v[0].pz = 1.0f / (1.0f + v[0].pz);
+		v[0].pu = v[0].pu * v[0].pz * (1.0f / 8.0f);
+		v[0].pv = v[0].pv * v[0].pz * (1.0f / 8.0f);
+		v[1].pz = 1.0f / (1.0f + v[1].pz);
+		v[1].pu = v[1].pu * v[1].pz * (1.0f / 8.0f);
+		v[1].pv = v[1].pv * v[1].pz * (1.0f / 8.0f);
+		v[2].pz = 1.0f / (1.0f + v[2].pz);
+		v[2].pu = v[2].pu * v[2].pz * (1.0f / 8.0f);
+		v[2].pv = v[2].pv * v[2].pz * (1.0f / 8.0f);
 	}
-	else
-		poly_render_triangle(poly, &bitmap, vp, render_funcs[renderer], 0, &tri->v[0], &tri->v[1], &tri->v[2]);
 }
 
 /*
@@ -1062,6 +1124,7 @@ void model2_state::model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &c
 #endif
 
 	/* go through the Z levels, and render each bucket */
+	g_profiler.start(PROFILER_3D_SETUP);
 	for( z = raster->max_z; z >= raster->min_z; z-- )
 	{
 		/* see if we have items at this z level */
@@ -1081,7 +1144,12 @@ void model2_state::model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &c
 			}
 		}
 	}
-	poly_wait(m_poly, "End of frame");
+	m_poly->flush_triangles();
+	g_profiler.stop();
+
+	g_profiler.start(PROFILER_3D_RASTER_WAIT);
+	m_poly->wait("End of frame");
+	g_profiler.stop();
 }
 
 /* 3D Rasterizer main data input port */
@@ -2692,11 +2760,6 @@ static void geo_parse( model2_state *state )
 /***********************************************************************************************/
 
 
-void model2_state::model2_exit()
-{
-	poly_free(m_poly);
-}
-
 VIDEO_START_MEMBER(model2_state,model2)
 {
 	const rectangle &visarea = m_screen->visible_area();
@@ -2705,8 +2768,7 @@ VIDEO_START_MEMBER(model2_state,model2)
 
 	m_sys24_bitmap.allocate(width, height+4);
 
-	m_poly = poly_alloc(machine(), 4000, sizeof(poly_extra_data), 0);
-	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(model2_state::model2_exit), this));
+	m_poly = auto_alloc(machine(), model2_renderer(*this));
 
 	/* initialize the hardware rasterizer */
 	model2_3d_init( machine(), (UINT16*)memregion("user3")->base() );
@@ -2737,7 +2799,9 @@ UINT32 model2_state::screen_update_model2(screen_device &screen, bitmap_rgb32 &b
 	model2_3d_frame_start(this);
 
 	/* let the geometry engine do it's thing */ /* TODO: don't do it here! */
+	g_profiler.start(PROFILER_3D_GEOMETRY);
 	geo_parse(this);
+	g_profiler.stop();
 
 	/* have the rasterizer output the frame */
 	model2_3d_frame_end( bitmap, cliprect );
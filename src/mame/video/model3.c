@@ -13,6 +13,7 @@
 
 #define TRI_BUFFER_SIZE                 35000
 #define TRI_ALPHA_BUFFER_SIZE           15000
+#define TRI_BATCH_SIZE                  64
 
 struct model3_polydata
 {
@@ -27,7 +28,10 @@ class model3_renderer : public poly_manager<float, model3_polydata, 6, 50000>
 {
 public:
 	model3_renderer(model3_state &state, int width, int height)
-		: poly_manager<float, model3_polydata, 6, 50000>(state.machine())
+		: poly_manager<float, model3_polydata, 6, 50000>(state.machine()),
+			m_batch_callback(NULL),
+			m_batch_params(0),
+			m_batch_count(0)
 	{
 		m_fb = auto_bitmap_rgb32_alloc(state.machine(), width, height);
 		m_zb = auto_bitmap_ind32_alloc(state.machine(), width, height);
@@ -46,8 +50,18 @@ public:
 	void wait_for_polys();
 
 private:
+	void batch_triangle(const m3_triangle *tri, const render_delegate &callback);
+	void flush_triangles();
+
 	bitmap_rgb32 *m_fb;
 	bitmap_ind32 *m_zb;
+
+	// run of set-up triangles that share one scanline renderer
+	const render_delegate *m_batch_callback;
+	int m_batch_params;
+	int m_batch_count;
+	vertex_t m_batch_vert[TRI_BATCH_SIZE * 3];
+	model3_polydata m_batch_data[TRI_BATCH_SIZE];
 };
 
 
@@ -1018,7 +1032,10 @@ void model3_state::real3d_display_list_end()
 	m_renderer->clear_fb();
 
 	reset_triangle_buffers();
+
+	g_profiler.start(PROFILER_3D_GEOMETRY);
 	real3d_traverse_display_list();
+	g_profiler.stop();
 
 	/*
 	m_renderer->draw_opaque_triangles(m_tri_buffer, m_tri_buffer_ptr);
@@ -1046,9 +1063,13 @@ void model3_state::real3d_display_list_end()
 		if (ticount > 0 || tiacount > 0)
 		{
 			m_renderer->clear_zb();
+			g_profiler.start(PROFILER_3D_SETUP);
 			m_renderer->draw_opaque_triangles(&m_tri_buffer[ti], ticount);
 			m_renderer->draw_alpha_triangles(&m_tri_alpha_buffer[tia], tiacount);
+			g_profiler.stop();
+			g_profiler.start(PROFILER_3D_RASTER_WAIT);
 			m_renderer->wait_for_polys();
+			g_profiler.stop();
 		}
 	}
 }
@@ -1152,15 +1173,6 @@ INLINE float dot_product3(VECTOR3 a, VECTOR3 b)
 	return (a[0] * b[0]) + (a[1] * b[1]) + (a[2] * b[2]);
 }
 
-/* multiplies a 4-element vector by a 4x4 matrix */
-static void matrix_multiply_vector(MATRIX matrix, const VECTOR v, VECTOR *p)
-{
-	(*p)[0] = (v[0] * matrix[0][0]) + (v[1] * matrix[1][0]) + (v[2] * matrix[2][0]) + (v[3] * matrix[3][0]);
-	(*p)[1] = (v[0] * matrix[0][1]) + (v[1] * matrix[1][1]) + (v[2] * matrix[2][1]) + (v[3] * matrix[3][1]);
-	(*p)[2] = (v[0] * matrix[0][2]) + (v[1] * matrix[1][2]) + (v[2] * matrix[2][2]) + (v[3] * matrix[3][2]);
-	(*p)[3] = (v[0] * matrix[0][3]) + (v[1] * matrix[1][3]) + (v[2] * matrix[2][3]) + (v[3] * matrix[3][3]);
-}
-
 /* multiplies a 4x4 matrix with another 4x4 matrix */
 static void matrix_multiply(MATRIX a, MATRIX b, MATRIX *out)
 {
@@ -1366,6 +1378,7 @@ void model3_state::draw_model(UINT32 addr)
 	m3_clip_vertex clip_vert[10];
 
 	MATRIX transform_matrix;
+	float coord_x, coord_y, coord_z;
 	float center_x, center_y;
 
 	if (m_step < 0x15)      // position coordinates are 17.7 fixed-point in Step 1.0
@@ -1375,6 +1388,11 @@ void model3_state::draw_model(UINT32 addr)
 
 	get_top_matrix(&transform_matrix);
 
+	/* coordinate system scale, applied after the model transform */
+	coord_x = m_coordinate_system[0][1];
+	coord_y = m_coordinate_system[1][2];
+	coord_z = m_coordinate_system[2][0];
+
 	/* current viewport center coordinates on screen */
 	center_x = (float)(m_viewport_region_x + (m_viewport_region_width / 2));
 	center_y = (float)(m_viewport_region_y + (m_viewport_region_height / 2));
@@ -1387,7 +1405,7 @@ void model3_state::draw_model(UINT32 addr)
 		UINT32 color;
 		VECTOR3 normal;
 		VECTOR3 sn;
-		VECTOR p[4];
+		float luminosity;
 		int polygon_transparency;
 
 		for (i = 0; i < 7; i++)
@@ -1450,60 +1468,38 @@ void model3_state::draw_model(UINT32 addr)
 		polygon_transparency =  (header[6] & 0x800000) ? 32 : ((header[6] >> 18) & 0x1f);
 
 		/* transform polygon normal to view-space */
-		sn[0] = (normal[0] * transform_matrix[0][0]) +
-				(normal[1] * transform_matrix[1][0]) +
-				(normal[2] * transform_matrix[2][0]);
-		sn[1] = (normal[0] * transform_matrix[0][1]) +
-				(normal[1] * transform_matrix[1][1]) +
-				(normal[2] * transform_matrix[2][1]);
-		sn[2] = (normal[0] * transform_matrix[0][2]) +
-				(normal[1] * transform_matrix[1][2]) +
-				(normal[2] * transform_matrix[2][2]);
-
-		sn[0] *= m_coordinate_system[0][1];
-		sn[1] *= m_coordinate_system[1][2];
-		sn[2] *= m_coordinate_system[2][0];
+		sn[0] = ((normal[0] * transform_matrix[0][0]) + (normal[1] * transform_matrix[1][0]) + (normal[2] * transform_matrix[2][0])) * coord_x;
+		sn[1] = ((normal[0] * transform_matrix[0][1]) + (normal[1] * transform_matrix[1][1]) + (normal[2] * transform_matrix[2][1])) * coord_y;
+		sn[2] = ((normal[0] * transform_matrix[0][2]) + (normal[1] * transform_matrix[1][2]) + (normal[2] * transform_matrix[2][2])) * coord_z;
+
+		/* self-luminous polygons skip the light model */
+		luminosity = -1.0f;
+		if (header[6] & 0x10000)
+			luminosity = ((float)((header[6] >> 11) & 0x1f) / 31.0f) * 255.0f;
 
 		// TODO: depth bias
 		// transform and light vertices
 		for (i = 0; i < num_vertices; i++)
 		{
-			VECTOR vect;
-
-			vect[0] = vertex[i].x;
-			vect[1] = vertex[i].y;
-			vect[2] = vertex[i].z;
-			vect[3] = 1.0f;
+			const float x = vertex[i].x, y = vertex[i].y, z = vertex[i].z;
 
-			// transform to world-space
-			matrix_multiply_vector(transform_matrix, vect, &p[i]);
-
-			// apply coordinate system
-			clip_vert[i].x = p[i][0] * m_coordinate_system[0][1];
-			clip_vert[i].y = p[i][1] * m_coordinate_system[1][2];
-			clip_vert[i].z = p[i][2] * m_coordinate_system[2][0];
+			// transform to world-space and apply coordinate system
+			clip_vert[i].x = ((x * transform_matrix[0][0]) + (y * transform_matrix[1][0]) + (z * transform_matrix[2][0]) + transform_matrix[3][0]) * coord_x;
+			clip_vert[i].y = ((x * transform_matrix[0][1]) + (y * transform_matrix[1][1]) + (z * transform_matrix[2][1]) + transform_matrix[3][1]) * coord_y;
+			clip_vert[i].z = ((x * transform_matrix[0][2]) + (y * transform_matrix[1][2]) + (z * transform_matrix[2][2]) + transform_matrix[3][2]) * coord_z;
 			clip_vert[i].u = vertex[i].u * texture_coord_scale;
 			clip_vert[i].v = vertex[i].v * texture_coord_scale;
 
-			// transform vertex normal
-			VECTOR3 n;
-			n[0] = (vertex[i].nx * transform_matrix[0][0]) +
-					(vertex[i].ny * transform_matrix[1][0]) +
-					(vertex[i].nz * transform_matrix[2][0]);
-			n[0] *= m_coordinate_system[0][1];
-			n[1] = (vertex[i].nx * transform_matrix[0][1]) +
-					(vertex[i].ny * transform_matrix[1][1]) +
-					(vertex[i].nz * transform_matrix[2][1]);
-			n[1] *= m_coordinate_system[1][2];
-			n[2] = (vertex[i].nx * transform_matrix[0][2]) +
-					(vertex[i].ny * transform_matrix[1][2]) +
-					(vertex[i].nz * transform_matrix[2][2]);
-			n[2] *= m_coordinate_system[2][0];
-
 			// lighting
-			float intensity;
-			if ((header[6] & 0x10000) == 0)
+			float intensity = luminosity;
+			if (intensity < 0.0f)
 			{
+				// transform vertex normal
+				VECTOR3 n;
+				n[0] = ((vertex[i].nx * transform_matrix[0][0]) + (vertex[i].ny * transform_matrix[1][0]) + (vertex[i].nz * transform_matrix[2][0])) * coord_x;
+				n[1] = ((vertex[i].nx * transform_matrix[0][1]) + (vertex[i].ny * transform_matrix[1][1]) + (vertex[i].nz * transform_matrix[2][1])) * coord_y;
+				n[2] = ((vertex[i].nx * transform_matrix[0][2]) + (vertex[i].ny * transform_matrix[1][2]) + (vertex[i].nz * transform_matrix[2][2])) * coord_z;
+
 				float dot = dot_product3(n, m_parallel_light);
 				intensity = ((dot * m_parallel_light_intensity) + m_ambient_light_intensity) * 255.0f;
 				if (intensity > 255.0f)
@@ -1515,11 +1511,6 @@ void model3_state::draw_model(UINT32 addr)
 					intensity = 0.0f;
 				}
 			}
-			else
-			{
-				// apply luminosity
-				intensity = ((float)((header[6] >> 11) & 0x1f) / 31.0f) * 255.0f;
-			}
 
 			clip_vert[i].i = intensity;
 		}
@@ -1869,7 +1860,7 @@ void model3_renderer::wait_for_polys()
 	wait();
 }
 
-void model3_renderer::draw_opaque_triangles(const m3_triangle* tris, int num_tris)
+void model3_renderer::flush_triangles()
 {
 	rectangle cliprect;
 	cliprect.min_x = 0;
@@ -1877,63 +1868,83 @@ void model3_renderer::draw_opaque_triangles(const m3_triangle* tris, int num_tri
 	cliprect.max_x = 495;
 	cliprect.max_y = 383;
 
-//  printf("draw opaque: %d\n", num_tris);
+	if (m_batch_count > 0)
+		render_triangle_batch(cliprect, *m_batch_callback, m_batch_params, m_batch_count, m_batch_vert, m_batch_data);
+	m_batch_count = 0;
+}
+
+void model3_renderer::batch_triangle(const m3_triangle *tri, const render_delegate &callback)
+{
+	// submit the current run when it is full or the renderer changes
+	if (m_batch_count == TRI_BATCH_SIZE || (m_batch_count > 0 && m_batch_callback != &callback))
+		flush_triangles();
 
-	vertex_t v[3];
+	vertex_t *v = &m_batch_vert[m_batch_count * 3];
+	model3_polydata &extra = m_batch_data[m_batch_count];
+	m_batch_callback = &callback;
+	m_batch_count++;
 
-	for (int t=0; t < num_tris; t++)
+	if (tri->param & TRI_PARAM_TEXTURE_ENABLE)
 	{
-		const m3_triangle* tri = &tris[t];
+		for (int i=0; i < 3; i++)
+		{
+			v[i].x = tri->v[i].x;
+			v[i].y = tri->v[i].y;
+			v[i].p[0] = tri->v[i].z;
+			v[i].p[1] = 1.0f / tri->v[i].z;
+			v[i].p[2] = tri->v[i].u * 256.0f;       // 8 bits of subtexel precision for bilinear filtering
+			v[i].p[3] = tri->v[i].v * 256.0f;
+			v[i].p[4] = tri->v[i].i;
+		}
 
-		if (tri->param & TRI_PARAM_TEXTURE_ENABLE)
+		extra.texture = tri->texture;
+		extra.transparency = tri->transparency;
+		extra.texture_param = tri->param;
+		m_batch_params = 5;
+	}
+	else
+	{
+		for (int i=0; i < 3; i++)
 		{
-			for (int i=0; i < 3; i++)
-			{
-				v[i].x = tri->v[i].x;
-				v[i].y = tri->v[i].y;
-				v[i].p[0] = tri->v[i].z;
-				v[i].p[1] = 1.0f / tri->v[i].z;
-				v[i].p[2] = tri->v[i].u * 256.0f;       // 8 bits of subtexel precision for bilinear filtering
-				v[i].p[3] = tri->v[i].v * 256.0f;
-				v[i].p[4] = tri->v[i].i;
-			}
+			v[i].x = tri->v[i].x;
+			v[i].y = tri->v[i].y;
+			v[i].p[0] = tri->v[i].z;
+			v[i].p[1] = tri->v[i].i;
+		}
+
+		extra.color = tri->color;
+		m_batch_params = 2;
+	}
+}
 
-			model3_polydata &extra = object_data_alloc();
-			extra.texture = tri->texture;
-			extra.transparency = tri->transparency;
-			extra.texture_param = tri->param;
+void model3_renderer::draw_opaque_triangles(const m3_triangle* tris, int num_tris)
+{
+//  printf("draw opaque: %d\n", num_tris);
 
-			render_triangle(cliprect, render_delegate(FUNC(model3_renderer::draw_scanline_tex), this), 5, v[0], v[1], v[2]);
-		}
-		else
-		{
-			for (int i=0; i < 3; i++)
-			{
-				v[i].x = tri->v[i].x;
-				v[i].y = tri->v[i].y;
-				v[i].p[0] = tri->v[i].z;
-				v[i].p[1] = tri->v[i].i;
-			}
+	// bind the scanline renderers once for the whole list
+	const render_delegate draw_tex(FUNC(model3_renderer::draw_scanline_tex), this);
+	const render_delegate draw_solid(FUNC(model3_renderer::draw_scanline_solid), this);
 
-			model3_polydata &extra = object_data_alloc();
-			extra.color = tri->color;
+	for (int t=0; t < num_tris; t++)
+	{
+		const m3_triangle* tri = &tris[t];
 
-			render_triangle(cliprect, render_delegate(FUNC(model3_renderer::draw_scanline_solid), this), 2, v[0], v[1], v[2]);
-		}
+		if (tri->param & TRI_PARAM_TEXTURE_ENABLE)
+			batch_triangle(tri, draw_tex);
+		else
+			batch_triangle(tri, draw_solid);
 	}
+	flush_triangles();
 }
 
 void model3_renderer::draw_alpha_triangles(const m3_triangle* tris, int num_tris)
 {
-	rectangle cliprect;
-	cliprect.min_x = 0;
-	cliprect.min_y = 0;
-	cliprect.max_x = 495;
-	cliprect.max_y = 383;
-
 //  printf("draw alpha: %d\n", num_tris);
 
-	vertex_t v[3];
+	// bind the scanline renderers once for the whole list
+	const render_delegate draw_tex_contour(FUNC(model3_renderer::draw_scanline_tex_contour), this);
+	const render_delegate draw_tex_alpha(FUNC(model3_renderer::draw_scanline_tex_alpha), this);
+	const render_delegate draw_solid(FUNC(model3_renderer::draw_scanline_solid), this);
 
 	for (int t=num_tris-1; t >= 0; t--)
 	{
@@ -1941,48 +1952,18 @@ void model3_renderer::draw_alpha_triangles(const m3_triangle* tris, int num_tris
 
 		if (tri->param & TRI_PARAM_TEXTURE_ENABLE)
 		{
-			for (int i=0; i < 3; i++)
-			{
-				v[i].x = tri->v[i].x;
-				v[i].y = tri->v[i].y;
-				v[i].p[0] = tri->v[i].z;
-				v[i].p[1] = 1.0f / tri->v[i].z;
-				v[i].p[2] = tri->v[i].u * 256.0f;       // 8 bits of subtexel precision for bilinear filtering
-				v[i].p[3] = tri->v[i].v * 256.0f;
-				v[i].p[4] = tri->v[i].i;
-			}
-
-			model3_polydata &extra = object_data_alloc();
-			extra.texture = tri->texture;
-			extra.transparency = tri->transparency;
-			extra.texture_param = tri->param;
-
 			if (tri->param & TRI_PARAM_ALPHA_TEST)
-			{
-				render_triangle(cliprect, render_delegate(FUNC(model3_renderer::draw_scanline_tex_contour), this), 5, v[0], v[1], v[2]);
-			}
+				batch_triangle(tri, draw_tex_contour);
 			else
-			{
-				render_triangle(cliprect, render_delegate(FUNC(model3_renderer::draw_scanline_tex_alpha), this), 5, v[0], v[1], v[2]);
-			}
+				batch_triangle(tri, draw_tex_alpha);
 		}
 		else
 		{
-			for (int i=0; i < 3; i++)
-			{
-				v[i].x = tri->v[i].x;
-				v[i].y = tri->v[i].y;
-				v[i].p[0] = tri->v[i].z;
-				v[i].p[1] = tri->v[i].i;
-			}
-
-			model3_polydata &extra = object_data_alloc();
-			extra.color = tri->color;
-
 			// TODO: scanline renderer for solid /w transparency
-			render_triangle(cliprect, render_delegate(FUNC(model3_renderer::draw_scanline_solid), this), 2, v[0], v[1], v[2]);
+			batch_triangle(tri, draw_solid);
 		}
 	}
+	flush_triangles();
 }
 
 void model3_renderer::draw_scanline_solid(INT32 scanline, const extent_t &extent, const model3_polydata &polydata, int threadid)
@@ -25,6 +25,14 @@ TODO:
 #include "emu.h"
 #include "video/n64.h"
 
+// use SSE2 for the color combiner under the same conditions as rgbutil.h
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define RDP_USE_SSE2        (1)
+#include <emmintrin.h>
+#else
+#define RDP_USE_SSE2        (0)
+#endif
+
 #define LOG_RDP_EXECUTION       0
 
 static FILE *rdp_exec;
@@ -430,6 +438,42 @@ INT32 n64_rdp::AlphaCombinerEquation(INT32 a, INT32 b, INT32 c, INT32 d)
 	return a;
 }
 
+// Every combiner input is an unsigned 8-bit value, so the sign extensions in
+// the equations above never fire and all four channels reduce to the same
+// ((a - b) * c + d * 256 + 0x80) >> 8 through the 9-bit clamp table; this
+// evaluates one whole cycle of the combiner at once.
+void n64_rdp::ColorCombiner(Color *result, int cycle, rdp_span_aux *userdata)
+{
+	const ColorInputsT &in = userdata->ColorInputs;
+
+#if RDP_USE_SSE2
+	__m128i suba = _mm_setr_epi16(*in.combiner_rgbsub_a_r[cycle], *in.combiner_rgbsub_a_g[cycle], *in.combiner_rgbsub_a_b[cycle], *in.combiner_alphasub_a[cycle], 0, 0, 0, 0);
+	__m128i subb = _mm_setr_epi16(*in.combiner_rgbsub_b_r[cycle], *in.combiner_rgbsub_b_g[cycle], *in.combiner_rgbsub_b_b[cycle], *in.combiner_alphasub_b[cycle], 0, 0, 0, 0);
+	__m128i mul = _mm_setr_epi16(*in.combiner_rgbmul_r[cycle], *in.combiner_rgbmul_g[cycle], *in.combiner_rgbmul_b[cycle], *in.combiner_alphamul[cycle], 0, 0, 0, 0);
+	__m128i add = _mm_setr_epi16(*in.combiner_rgbadd_r[cycle], *in.combiner_rgbadd_g[cycle], *in.combiner_rgbadd_b[cycle], *in.combiner_alphaadd[cycle], 0, 0, 0, 0);
+
+	// interleave (a - b, d) with (c, 256) so a single madd yields (a - b) * c + d * 256 per channel
+	__m128i sum = _mm_madd_epi16(_mm_unpacklo_epi16(_mm_sub_epi16(suba, subb), add), _mm_unpacklo_epi16(mul, _mm_set1_epi16(0x100)));
+	sum = _mm_and_si128(_mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(0x80)), 8), _mm_set1_epi32(0x1ff));
+
+	UINT32 index[4];
+	_mm_storeu_si128((__m128i *)index, sum);
+	result->i.r = s_special_9bit_clamptable[index[0]];
+	result->i.g = s_special_9bit_clamptable[index[1]];
+	result->i.b = s_special_9bit_clamptable[index[2]];
+	result->i.a = s_special_9bit_clamptable[index[3]];
+#else
+	INT32 r = ((*in.combiner_rgbsub_a_r[cycle] - *in.combiner_rgbsub_b_r[cycle]) * *in.combiner_rgbmul_r[cycle] + (*in.combiner_rgbadd_r[cycle] << 8) + 0x80) >> 8;
+	INT32 g = ((*in.combiner_rgbsub_a_g[cycle] - *in.combiner_rgbsub_b_g[cycle]) * *in.combiner_rgbmul_g[cycle] + (*in.combiner_rgbadd_g[cycle] << 8) + 0x80) >> 8;
+	INT32 b = ((*in.combiner_rgbsub_a_b[cycle] - *in.combiner_rgbsub_b_b[cycle]) * *in.combiner_rgbmul_b[cycle] + (*in.combiner_rgbadd_b[cycle] << 8) + 0x80) >> 8;
+	INT32 a = ((*in.combiner_alphasub_a[cycle] - *in.combiner_alphasub_b[cycle]) * *in.combiner_alphamul[cycle] + (*in.combiner_alphaadd[cycle] << 8) + 0x80) >> 8;
+	result->i.r = s_special_9bit_clamptable[r & 0x1ff];
+	result->i.g = s_special_9bit_clamptable[g & 0x1ff];
+	result->i.b = s_special_9bit_clamptable[b & 0x1ff];
+	result->i.a = s_special_9bit_clamptable[a & 0x1ff];
+#endif
+}
+
 void n64_rdp::SetSubAInputRGB(UINT8 **input_r, UINT8 **input_g, UINT8 **input_b, int code, rdp_span_aux *userdata)
 {
 	switch (code & 0xf)
@@ -458,6 +458,7 @@ class n64_rdp : public poly_manager<UINT32, rdp_poly_state, 8, 32000>
 		// Color Combiner
 		INT32       ColorCombinerEquation(INT32 a, INT32 b, INT32 c, INT32 d);
 		INT32       AlphaCombinerEquation(INT32 a, INT32 b, INT32 c, INT32 d);
+		void        ColorCombiner(Color *result, int cycle, rdp_span_aux *userdata);
 		void        SetSubAInputRGB(UINT8 **input_r, UINT8 **input_g, UINT8 **input_b, int code, rdp_span_aux *userdata);
 		void        SetSubBInputRGB(UINT8 **input_r, UINT8 **input_g, UINT8 **input_b, int code, rdp_span_aux *userdata);
 		void        SetMulInputRGB(UINT8 **input_r, UINT8 **input_g, UINT8 **input_b, int code, rdp_span_aux *userdata);
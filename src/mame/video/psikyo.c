@@ -168,6 +168,7 @@ VIDEO_START_MEMBER(psikyo_state,psikyo)
 
 	m_spritebuf1 = auto_alloc_array(machine(), UINT32, 0x2000 / 4);
 	m_spritebuf2 = auto_alloc_array(machine(), UINT32, 0x2000 / 4);
+	m_sprite_list = auto_alloc(machine(), gfx_sprite_list(machine()));
 
 	m_tilemap_0_size0->set_scroll_rows(0x80 * 16);  // line scrolling
 	m_tilemap_0_size0->set_scroll_cols(1);
@@ -263,6 +264,8 @@ void psikyo_state::draw_sprites( screen_device &screen, bitmap_ind16 &bitmap, co
 	int width = m_screen->width();
 	int height = m_screen->height();
 
+	m_sprite_list->reset();
+
 	/* Exit if sprites are disabled */
 	if (spritelist[BYTE_XOR_BE((0x800 - 2) / 2)] & 1)   return;
 
@@ -340,27 +343,21 @@ void psikyo_state::draw_sprites( screen_device &screen, bitmap_ind16 &bitmap, co
 			{
 				int addr = (code * 2) & (TILES_LEN - 1);
 
-				if (zoomx == 32 && zoomy == 32)
-					m_gfxdecode->gfx(0)->prio_transpen(bitmap,cliprect,
-							TILES[addr+1] * 256 + TILES[addr],
-							attr >> 8,
-							flipx, flipy,
-							x + dx * 16, y + dy * 16,
-							screen.priority(),
-							pri[(attr & 0xc0) >> 6],trans_pen);
-				else
-					m_gfxdecode->gfx(0)->prio_zoom_transpen(bitmap,cliprect,
-								TILES[addr+1] * 256 + TILES[addr],
-								attr >> 8,
-								flipx, flipy,
-								x + (dx * zoomx) / 2, y + (dy * zoomy) / 2,
-								zoomx << 11,zoomy << 11,
-								screen.priority(),pri[(attr & 0xc0) >> 6],trans_pen);
+				m_sprite_list->add(m_gfxdecode->gfx(0),
+						TILES[addr+1] * 256 + TILES[addr],
+						attr >> 8,
+						flipx, flipy,
+						x + (dx * zoomx) / 2, y + (dy * zoomy) / 2,
+						trans_pen,
+						zoomx << 11,zoomy << 11,
+						pri[(attr & 0xc0) >> 6]);
 
 				code++;
 			}
 		}
 	}
+
+	m_sprite_list->draw(bitmap, cliprect, screen.priority());
 }
 
 
@@ -304,7 +304,6 @@ VIDEOS += MSM6222B
 VIDEOS += MSM6255
 VIDEOS += MOS6566
 VIDEOS += PC_VGA
-#VIDEOS += POLY
 VIDEOS += PSX
 VIDEOS += RAMDAC
 VIDEOS += S2636
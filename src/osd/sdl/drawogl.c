@@ -22,6 +22,7 @@
 #include "emu.h"
 #include "options.h"
 #include "emuopts.h"
+#include "rendutil.h"
 
 // standard SDL headers
 #include "sdlinc.h"
@@ -2275,12 +2276,19 @@ INLINE void copyline_palette16(UINT32 *dst, const UINT16 *src, int width, const
 	assert(xborderpix == 0 || xborderpix == 1);
 	if (xborderpix)
 		*dst++ = 0xff000000 | palette[*src];
-	for (x = 0; x < width; x++)
+	if (xprescale == 1)
 	{
-		int srcpix = *src++;
-		for (int x2 = 0; x2 < xprescale; x2++)
-			*dst++ = 0xff000000 | palette[srcpix];
+		render_convert_palette16(dst, src, width, palette, 0xff000000);
+		dst += width;
+		src += width;
 	}
+	else
+		for (x = 0; x < width; x++)
+		{
+			int srcpix = *src++;
+			for (int x2 = 0; x2 < xprescale; x2++)
+				*dst++ = 0xff000000 | palette[srcpix];
+		}
 	if (xborderpix)
 		*dst++ = 0xff000000 | palette[*--src];
 }
@@ -67,7 +67,9 @@ public:
 	m_blitwidth(0),
 	m_blitheight(0),
 	m_last_width(0),
-	m_last_height(0)
+	m_last_height(0),
+	m_work_queue(NULL),
+	m_bands(0)
 	{ }
 
 	/* virtual */ int create();
@@ -122,6 +124,10 @@ private:
 	int                 m_blitheight;
 	int                 m_last_width;
 	int                 m_last_height;
+
+	// banded software rendering
+	osd_work_queue      *m_work_queue;
+	int                 m_bands;
 };
 
 struct sdl_scale_mode
@@ -489,6 +495,11 @@ int sdl_info::create()
 	m_yuv_lookup = NULL;
 	m_blittimer = 0;
 
+	// split the software rasterizer into bands if requested
+	m_bands = window().machine().options().render_bands();
+	if (m_bands > 1)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
 	yuv_init();
 	osd_printf_verbose("Leave sdl_info::create\n");
 	return 0;
@@ -505,6 +516,11 @@ void sdl_info::destroy()
 
 	destroy_all_textures();
 
+	if (m_work_queue != NULL)
+	{
+		osd_work_queue_free(m_work_queue);
+		m_work_queue = NULL;
+	}
 	if (m_yuv_lookup != NULL)
 	{
 		global_free_array(m_yuv_lookup);
@@ -742,23 +758,23 @@ int sdl_info::draw(UINT32 dc, int update)
 		switch (rmask)
 		{
 			case 0x0000ff00:
-				software_renderer<UINT32, 0,0,0, 8,16,24>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				software_renderer<UINT32, 0,0,0, 8,16,24>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 4, m_work_queue, m_bands);
 				break;
 
 			case 0x00ff0000:
-				software_renderer<UINT32, 0,0,0, 16,8,0>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				software_renderer<UINT32, 0,0,0, 16,8,0>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 4, m_work_queue, m_bands);
 				break;
 
 			case 0x000000ff:
-				software_renderer<UINT32, 0,0,0, 0,8,16>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				software_renderer<UINT32, 0,0,0, 0,8,16>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 4, m_work_queue, m_bands);
 				break;
 
 			case 0xf800:
-				software_renderer<UINT16, 3,2,3, 11,5,0>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 2);
+				software_renderer<UINT16, 3,2,3, 11,5,0>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 2, m_work_queue, m_bands);
 				break;
 
 			case 0x7c00:
-				software_renderer<UINT16, 3,3,3, 10,5,0>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 2);
+				software_renderer<UINT16, 3,3,3, 10,5,0>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 2, m_work_queue, m_bands);
 				break;
 
 			default:
@@ -2182,13 +2182,12 @@ void texture_info::compute_size(int texwidth, int texheight)
 
 INLINE void copyline_palette16(UINT32 *dst, const UINT16 *src, int width, const rgb_t *palette, int xborderpix)
 {
-	int x;
-
 	assert(xborderpix == 0 || xborderpix == 1);
 	if (xborderpix)
 		*dst++ = 0xff000000 | palette[*src];
-	for (x = 0; x < width; x++)
-		*dst++ = 0xff000000 | palette[*src++];
+	render_convert_palette16(dst, src, width, palette, 0xff000000);
+	dst += width;
+	src += width;
 	if (xborderpix)
 		*dst++ = 0xff000000 | palette[*--src];
 }